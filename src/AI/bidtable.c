@@ -0,0 +1,289 @@
+/**
+ * @file bidtable.c
+ * @brief In this file are defined the functions used for BidTable-related
+ *        operations, these functions are declared in the header file
+ *        bidtable.h.
+ */
+
+#include "bidtable.h"
+#include "robot.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct BidTable *bidtable_createBidTable(int bits)
+{
+    if (bits < 4 || bits > 30)
+        return NULL;
+
+    struct BidTable *table = malloc(sizeof(struct BidTable));
+    if (table == NULL)
+        return NULL;
+
+    table->entries = calloc((size_t)1 << bits, sizeof(struct BidTableEntry));
+    if (table->entries == NULL) {
+        free(table);
+        return NULL;
+    }
+
+    memcpy(table->header.magic, BIDTABLE_MAGIC, sizeof(table->header.magic));
+    table->header.version       = BIDTABLE_VERSION;
+    table->header.entrySize     = sizeof(struct BidTableEntry);
+    table->header.bits          = bits;
+    table->header.entriesNumber = 0;
+
+    return table;
+}
+
+int bidtable_deleteBidTable(struct BidTable** table)
+{
+    if (table == NULL)
+        return POINTER_NULL;
+    if (*table == NULL)
+        return POINTER_NULL;
+
+    free((*table)->entries);
+    free(*table);
+    *table = NULL;
+
+    return FUNCTION_NO_ERROR;
+}
+
+struct BidTable *bidtable_loadBidTable(const char* path)
+{
+    if (path == NULL)
+        return NULL;
+
+    FILE *file = fopen(path, "rb");
+    if (file == NULL)
+        return NULL;
+
+    struct BidTableHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 ||
+        memcmp(header.magic, BIDTABLE_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != BIDTABLE_VERSION ||
+        header.entrySize != sizeof(struct BidTableEntry)) {
+        fclose(file);
+        return NULL;
+    }
+
+    struct BidTable *table = bidtable_createBidTable(header.bits);
+    if (table == NULL) {
+        fclose(file);
+        return NULL;
+    }
+
+    size_t size = (size_t)1 << header.bits;
+    if (fread(table->entries, sizeof(struct BidTableEntry), size, file) !=
+        size) {
+        bidtable_deleteBidTable(&table);
+        fclose(file);
+        return NULL;
+    }
+    fclose(file);
+
+    /* bidtable_findEntry() stops only at an empty entry, so a table without
+     * the empty entries kept by bidtable_getEntry() isn't used. */
+    size_t entriesNumber = 0;
+    for (size_t i = 0; i < size; i++)
+        if (table->entries[i].key != 0)
+            entriesNumber++;
+    size_t mask = size - 1;
+    if (entriesNumber != header.entriesNumber ||
+        entriesNumber > mask - mask / 8) {
+        bidtable_deleteBidTable(&table);
+        return NULL;
+    }
+    table->header = header;
+
+    return table;
+}
+
+int bidtable_saveBidTable(const struct BidTable* table, const char* path)
+{
+    if (table == NULL || path == NULL)
+        return POINTER_NULL;
+
+    FILE *file = fopen(path, "wb");
+    if (file == NULL)
+        return NOT_FOUND;
+
+    size_t size = (size_t)1 << table->header.bits;
+    int written =
+        fwrite(&(table->header), sizeof(table->header), 1, file) == 1 &&
+        fwrite(table->entries, sizeof(struct BidTableEntry), size, file) ==
+        size;
+
+    if (fclose(file) != 0 || !written)
+        return ILLEGAL_VALUE;
+
+    return FUNCTION_NO_ERROR;
+}
+
+int bidtable_getKey(const struct Player* player, const struct Round* round,
+                    uint64_t* key)
+{
+    if (player == NULL)
+        return PLAYER_NULL;
+    if (round == NULL)
+        return ROUND_NULL;
+    if (key == NULL)
+        return POINTER_NULL;
+
+    int playerId = round_getPlayerId(round, player);
+    if (playerId < 0)
+        return playerId;
+
+    /* In the canonical hand the trump is the last suit and the other suits
+     * are ordered ascending by their cards. */
+    uint64_t hand = bitboard_getPlayerCards(player);
+    enum Suit trump = deck_getCardSuit(round->trump);
+    int check = isomorphism_canonicalize(&hand, 1, trump, NULL);
+    if (check != FUNCTION_NO_ERROR)
+        return check;
+
+    int offset = SuitEnd * RANKS_NUMBER;
+    *key = hand |
+           (uint64_t)round->roundType << offset |
+           (uint64_t)round->playersNumber << (offset + 4) |
+           (uint64_t)playerId << (offset + 7) |
+           (uint64_t)(trump != SuitEnd) << (offset + 10);
+
+    return FUNCTION_NO_ERROR;
+}
+
+/**
+ * @brief Function gets the position from which is searched a key.
+ */
+static inline size_t bidtable_getIndex(const struct BidTable* table,
+                                       uint64_t key)
+{
+    return (key * UINT64_C(0x9E3779B97F4A7C15)) >> (64 - table->header.bits);
+}
+
+const struct BidTableEntry *bidtable_findEntry(const struct BidTable* table,
+                                               uint64_t key)
+{
+    if (table == NULL || key == 0)
+        return NULL;
+
+    size_t mask = ((size_t)1 << table->header.bits) - 1;
+    for (size_t i = bidtable_getIndex(table, key); ; i = (i + 1) & mask) {
+        const struct BidTableEntry *entry = &(table->entries[i]);
+        if (entry->key == key)
+            return entry;
+        if (entry->key == 0)
+            return NULL;
+    }
+}
+
+/**
+ * @brief Function gets the entry of a key, the entry is created if it
+ *        doesn't exist. It returns NULL if the table is too full.
+ */
+static struct BidTableEntry *bidtable_getEntry(struct BidTable* table,
+                                               uint64_t key)
+{
+    size_t mask = ((size_t)1 << table->header.bits) - 1;
+    for (size_t i = bidtable_getIndex(table, key); ; i = (i + 1) & mask) {
+        struct BidTableEntry *entry = &(table->entries[i]);
+        if (entry->key == key)
+            return entry;
+        if (entry->key != 0)
+            continue;
+
+        /* An empty entry is kept for every eight entries, so that the
+         * searches stay short. */
+        if (table->header.entriesNumber >= mask - mask / 8)
+            return NULL;
+        entry->key = key;
+        table->header.entriesNumber++;
+        return entry;
+    }
+}
+
+int bidtable_addSample(struct BidTable* table, uint64_t key, int hands)
+{
+    if (table == NULL)
+        return POINTER_NULL;
+    if (key == 0 || hands < 0 || hands > MAX_CARDS)
+        return ILLEGAL_VALUE;
+
+    struct BidTableEntry *entry = bidtable_getEntry(table, key);
+    if (entry == NULL)
+        return FULL;
+
+    entry->samplesNumber++;
+    entry->hands[hands]++;
+
+    return FUNCTION_NO_ERROR;
+}
+
+int bidtable_addBidTable(struct BidTable* destination,
+                         const struct BidTable* source)
+{
+    if (destination == NULL || source == NULL)
+        return POINTER_NULL;
+
+    int check = FUNCTION_NO_ERROR;
+    size_t size = (size_t)1 << source->header.bits;
+    for (size_t i = 0; i < size; i++) {
+        const struct BidTableEntry *entry = &(source->entries[i]);
+        if (entry->key == 0)
+            continue;
+
+        struct BidTableEntry *sum = bidtable_getEntry(destination,
+                                                      entry->key);
+        if (sum == NULL) {
+            check = FULL;
+            continue;
+        }
+
+        sum->samplesNumber += entry->samplesNumber;
+        for (int j = 0; j <= MAX_CARDS; j++)
+            sum->hands[j] += entry->hands[j];
+    }
+
+    return check;
+}
+
+int bidtable_getBid(const struct BidTable* table, const struct Player* player,
+                    const struct Round* round)
+{
+    uint64_t key;
+    int check = bidtable_getKey(player, round, &key);
+    if (check != FUNCTION_NO_ERROR)
+        return check;
+
+    const struct BidTableEntry *entry = bidtable_findEntry(table, key);
+    if (entry == NULL || entry->samplesNumber < BIDTABLE_MIN_SAMPLES)
+        return robot_getBid(player, round);
+
+    /* The points of a bid are added for every number of hands, the sums
+     * being proportional with the average points. */
+    int bid = -1;
+    long bestPoints = 0;
+    for (int i = 0; i <= round->roundType; i++) {
+        if (round_checkBid(round, player, i) != FUNCTION_NO_ERROR)
+            continue;
+
+        long points = 0;
+        for (int j = 0; j <= round->roundType; j++) {
+            if (j == i)
+                points += (long)entry->hands[j] * (POINTS_PER_ROUND + i);
+            else
+                points -= (long)entry->hands[j] * abs(j - i);
+        }
+
+        if (bid < 0 || points > bestPoints) {
+            bid        = i;
+            bestPoints = points;
+        }
+    }
+
+    if (bid < 0)
+        return robot_getBid(player, round);
+
+    return bid;
+}
@@ -0,0 +1,210 @@
+/**
+ * @file bidtable.h
+ * @brief BidTable structure, as well as the functions of the robot which bids
+ *        from a table generated with the simulator. For every hand with
+ *        which a player bid in the simulated games, the table keeps how many
+ *        times he won each number of hands. The hands which differ only by
+ *        the order of the suits other than the trump are the same entry, in
+ *        which the trump is the last suit.
+ */
+
+#ifndef BIDTABLE_H
+#define BIDTABLE_H
+
+#include <libWhistGame.h>
+
+#include <stdint.h>
+
+/**
+ * @brief The value with which starts a file of a bid table.
+ */
+#define BIDTABLE_MAGIC "WHISTBID"
+
+/**
+ * @brief The version of the format of the files of the bid tables. It is
+ *        changed when BidTableEntry or the key of an entry is changed.
+ */
+#define BIDTABLE_VERSION 1
+
+/**
+ * @brief The minimum number of samples of an entry with which the robot bids
+ *        from the table, for fewer samples the robot bids with
+ *        robot_getBid().
+ */
+#define BIDTABLE_MIN_SAMPLES 16
+
+/**
+ * @struct BidTableEntry
+ *
+ * @brief BidTableEntry structure.
+ *
+ * @var BidTableEntry::key
+ *      The key of the entry (see bidtable_getKey()), 0 for an empty entry.
+ * @var BidTableEntry::samplesNumber
+ *      The number of the rounds added in the entry.
+ * @var BidTableEntry::hands
+ *      For every number of hands, the number of the rounds in which the
+ *      player won so many hands.
+ */
+struct BidTableEntry {
+    uint64_t key;
+    uint32_t samplesNumber;
+    uint32_t hands[MAX_CARDS + 1];
+};
+
+/**
+ * @struct BidTableHeader
+ *
+ * @brief BidTableHeader structure. The start of a file of a bid table, the
+ *        entries follow it as they are in memory.
+ *
+ * @var BidTableHeader::magic
+ *      BIDTABLE_MAGIC, without the null character.
+ * @var BidTableHeader::version
+ *      BIDTABLE_VERSION.
+ * @var BidTableHeader::entrySize
+ *      The size of a BidTableEntry, so that a file written on a machine with
+ *      other sizes isn't read.
+ * @var BidTableHeader::bits
+ *      The number of the entries of the table is 2 to the power bits.
+ * @var BidTableHeader::entriesNumber
+ *      The number of the entries which aren't empty.
+ */
+struct BidTableHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t entrySize;
+    uint32_t bits;
+    uint32_t entriesNumber;
+};
+
+/**
+ * @struct BidTable
+ *
+ * @brief BidTable structure. A hash table with open addressing, an entry is
+ *        searched from the position given by its key to the first empty
+ *        entry.
+ *
+ * @var BidTable::header
+ *      The header of the table, as in file.
+ * @var BidTable::entries
+ *      The entries of the table.
+ */
+struct BidTable {
+    struct BidTableHeader header;
+    struct BidTableEntry *entries;
+};
+
+/**
+ * @brief Function allocates and initializes an empty bid table.
+ *
+ * @param bits The table has 2 to the power bits entries (between 4 and 30).
+ *
+ * @return Pointer to the new table on success, NULL on failure.
+ */
+struct BidTable *bidtable_createBidTable(int bits);
+
+/**
+ * @brief Function releases the memory of a bid table and makes the pointer
+ *        NULL.
+ *
+ * @param table Pointer to pointer to the table which to be released.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int bidtable_deleteBidTable(struct BidTable** table);
+
+/**
+ * @brief Function reads a bid table from a file written by
+ *        bidtable_saveBidTable() on the same kind of machine. The entries are
+ *        read as they are, without parsing, but the file is rejected if the
+ *        number of the entries which aren't empty isn't
+ *        BidTableHeader::entriesNumber or if the table is fuller than
+ *        bidtable_addSample() allows.
+ *
+ * @param path The path of the file.
+ *
+ * @return Pointer to the new table on success, NULL on failure.
+ */
+struct BidTable *bidtable_loadBidTable(const char* path);
+
+/**
+ * @brief Function writes a bid table in a file.
+ *
+ * @param table Pointer to the table.
+ * @param path The path of the file.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int bidtable_saveBidTable(const struct BidTable* table, const char* path);
+
+/**
+ * @brief Function gets the key of the hand with which a player bids. The key
+ *        has the cards of the player, the other suits ordered by their cards
+ *        and the suit of the trump last, the position of the player in
+ *        Round::players, the number of the players, the type of the round
+ *        and if the round has a trump.
+ *
+ * @param player Pointer to the player.
+ * @param round Pointer to the round in which is the player.
+ * @param key Pointer to the variable in which is saved the key.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int bidtable_getKey(const struct Player* player, const struct Round* round,
+                    uint64_t* key);
+
+/**
+ * @brief Function searches the entry of a key.
+ *
+ * @param table Pointer to the table.
+ * @param key The key of the entry.
+ *
+ * @return Pointer to the entry or NULL if the table doesn't have it.
+ */
+const struct BidTableEntry *bidtable_findEntry(const struct BidTable* table,
+                                               uint64_t key);
+
+/**
+ * @brief Function adds a round in the entry of a key, the entry is created if
+ *        it doesn't exist.
+ *
+ * @param table Pointer to the table.
+ * @param key The key of the hand with which the player bid.
+ * @param hands The number of the hands won by the player.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, FULL if the entry can't be
+ *         created, other value on failure.
+ */
+int bidtable_addSample(struct BidTable* table, uint64_t key, int hands);
+
+/**
+ * @brief Function adds all the entries of a bid table in another table.
+ *
+ * @param destination Pointer to the table in which are added the entries.
+ * @param source Pointer to the table from which are got the entries.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, FULL if some entries can't be
+ *         created, other value on failure.
+ */
+int bidtable_addBidTable(struct BidTable* destination,
+                         const struct BidTable* source);
+
+/**
+ * @brief Function determines the bid of a robot: from the entry of his hand
+ *        is chosen the allowed bid with the most points on average. If the
+ *        table doesn't have the hand or it has fewer than
+ *        BIDTABLE_MIN_SAMPLES rounds for it, the bid is determined by
+ *        robot_getBid().
+ *
+ * @param table Pointer to the table, it can be NULL.
+ * @param player Pointer to the player which is robot.
+ * @param round Pointer to the round in which is the robot.
+ *
+ * @return A value between 0 and roundType on success, a negative value on
+ *         failure.
+ */
+int bidtable_getBid(const struct BidTable* table, const struct Player* player,
+                    const struct Round* round);
+
+#endif
@@ -0,0 +1,594 @@
+/**
+ * @file ismcts.c
+ * @brief In this file are defined the functions of the ISMCTS robot, these
+ *        functions are declared in the header file ismcts.h.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "ismcts.h"
+
+#include <math.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * @brief The difference between the biggest and the smallest reward.
+ */
+#define ISMCTS_REWARD_RANGE (POINTS_PER_ROUND + 2 * MAX_CARDS)
+
+struct Ismcts *ismcts_createIsmcts(int threadsNumber, enum IsmctsMode mode,
+                                   uint64_t seed)
+{
+    if (threadsNumber == 0) {
+        long processors = sysconf(_SC_NPROCESSORS_ONLN);
+        threadsNumber = processors > 0 ? processors : 1;
+    }
+    if (threadsNumber < 0)
+        return NULL;
+    if (threadsNumber > ISMCTS_MAX_THREADS)
+        threadsNumber = ISMCTS_MAX_THREADS;
+    if (mode < ISMCTS_ROOT_PARALLEL || mode >= IsmctsModeEnd)
+        return NULL;
+
+    struct Ismcts *ismcts = malloc(sizeof(struct Ismcts));
+    if (ismcts == NULL)
+        return NULL;
+
+    ismcts->threadsNumber   = threadsNumber;
+    ismcts->mode            = mode;
+    ismcts->playoutsLimit   = 0;
+    ismcts->decisionsNumber = 0;
+    ismcts->playoutsNumber  = 0;
+    ismcts->seconds         = 0;
+    ismcts->maxSeconds      = 0;
+    random_setSeed(&(ismcts->random), seed);
+
+    for (int i = 0; i < ISMCTS_MAX_THREADS; i++) {
+        ismcts->trees[i].nodes       = NULL;
+        ismcts->trees[i].size        = 0;
+        ismcts->trees[i].nodesNumber = 0;
+        ismcts->workers[i].ismcts    = ismcts;
+        ismcts->workers[i].tree      = &(ismcts->trees[0]);
+    }
+
+    /* The shared tree has the nodes of all the threads. */
+    int treesNumber = threadsNumber;
+    int size = ISMCTS_NODES_NUMBER;
+    if (mode == ISMCTS_TREE_PARALLEL) {
+        treesNumber = 1;
+        size = ISMCTS_NODES_NUMBER * threadsNumber;
+    }
+
+    for (int i = 0; i < treesNumber; i++) {
+        ismcts->trees[i].nodes = malloc(size * sizeof(struct IsmctsNode));
+        if (ismcts->trees[i].nodes == NULL) {
+            ismcts_deleteIsmcts(&ismcts);
+            return NULL;
+        }
+        ismcts->trees[i].size   = size;
+        ismcts->workers[i].tree = &(ismcts->trees[i]);
+    }
+
+    return ismcts;
+}
+
+int ismcts_deleteIsmcts(struct Ismcts** ismcts)
+{
+    if (ismcts == NULL)
+        return POINTER_NULL;
+    if (*ismcts == NULL)
+        return POINTER_NULL;
+
+    for (int i = 0; i < ISMCTS_MAX_THREADS; i++)
+        free((*ismcts)->trees[i].nodes);
+
+    free(*ismcts);
+    *ismcts = NULL;
+
+    return FUNCTION_NO_ERROR;
+}
+
+/**
+ * @brief Function gets the time of the monotonic clock in seconds.
+ */
+static double ismcts_getTime()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+
+    return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Function gets the id of the player which makes the next move.
+ */
+static inline int ismcts_getPlayerId(const struct IsmctsState* state)
+{
+    if (state->bidsNumber < state->playersNumber)
+        return state->bidsNumber;
+
+    return (state->leader + state->cardsOnTable) % state->playersNumber;
+}
+
+/**
+ * @brief Function gets the moves which can be made: a mask of the bids while
+ *        the players bid, a mask of the cards after, 0 if the round ended.
+ */
+static inline uint64_t ismcts_getMoves(const struct IsmctsState* state)
+{
+    if (state->bidsNumber < state->playersNumber) {
+        uint64_t bids = (UINT64_C(2) << state->roundType) - 1;
+        int forbidden = state->roundType - state->bidsSum;
+        if (state->bidsNumber == state->playersNumber - 1 && forbidden >= 0)
+            bids &= ~(UINT64_C(1) << forbidden);
+        return bids;
+    }
+
+    int playerId = ismcts_getPlayerId(state);
+
+    return bitboard_getLegalCards(state->hands[playerId], state->leadSuit,
+                                  state->trump);
+}
+
+/**
+ * @brief Function makes a move which can be made. When the last card of a
+ *        hand is put down, the winner of the hand starts the next hand.
+ */
+static inline void ismcts_applyMove(struct IsmctsState* state, int move)
+{
+    int playerId = ismcts_getPlayerId(state);
+
+    if (state->bidsNumber < state->playersNumber) {
+        state->bids[playerId] = move;
+        state->bidsSum += move;
+        state->bidsNumber++;
+        return;
+    }
+
+    uint64_t mask = UINT64_C(1) << move;
+    if (state->cardsOnTable == 0)
+        state->leadSuit = bitboard_getSuit(move);
+    state->hands[playerId] &= ~mask;
+    state->table           |= mask;
+    state->owners[move]     = playerId;
+    state->cardsOnTable++;
+
+    if (state->cardsOnTable < state->playersNumber)
+        return;
+
+    int card;
+    if (bitboard_getSuitCards(state->table, state->trump) != 0)
+        card = bitboard_getHighestCard(state->table, state->trump);
+    else
+        card = bitboard_getHighestCard(state->table, state->leadSuit);
+
+    state->leader = state->owners[card];
+    state->handsNumber[state->leader]++;
+    state->table        = 0;
+    state->cardsOnTable = 0;
+    state->leadSuit     = SuitEnd;
+}
+
+/**
+ * @brief Function gets the rewards of the players at the end of the round:
+ *        the points of the round, plus MAX_CARDS so that they are positive.
+ */
+static void ismcts_getRewards(const struct IsmctsState* state, int* rewards)
+{
+    for (int i = 0; i < state->playersNumber; i++) {
+        int points = state->handsNumber[i] - state->bids[i];
+        if (points == 0)
+            points = POINTS_PER_ROUND + state->bids[i];
+        else if (points > 0)
+            points = -points;
+
+        rewards[i] = points + MAX_CARDS;
+    }
+}
+
+/**
+ * @brief Function makes a random move.
+ */
+static inline void ismcts_applyRandomMove(struct IsmctsState* state,
+                                          struct Random* random,
+                                          uint64_t moves)
+{
+    int index = random_getBoundedNumber(random, bitboard_countCards(moves));
+    ismcts_applyMove(state, world_getCard(moves, index));
+}
+
+/**
+ * @brief Function initializes the state of a round as a player knows it, the
+ *        cards of the other players are dealt at every iteration.
+ */
+static int ismcts_loadState(struct IsmctsState* state,
+                            const struct Round* round, int playerId)
+{
+    state->playersNumber = round->playersNumber;
+    state->roundType     = round->roundType;
+    state->trump         = deck_getCardSuit(round->trump);
+    state->leadSuit      = SuitEnd;
+    state->table         = 0;
+    state->leader        = 0;
+    state->cardsOnTable  = 0;
+    state->bidsSum       = 0;
+
+    for (int i = 0; i < MAX_GAME_PLAYERS; i++) {
+        state->hands[i]       = 0;
+        state->bids[i]        = round->bids[i];
+        state->handsNumber[i] = round->handsNumber[i];
+        if (i < round->playersNumber)
+            state->bidsSum += round->bids[i];
+    }
+    state->hands[playerId] = bitboard_getPlayerCards(round->players[playerId]);
+
+    const struct Hand *hand = round->hand;
+    if (hand == NULL) {
+        state->bidsNumber = playerId;
+        return FUNCTION_NO_ERROR;
+    }
+
+    state->bidsNumber = round->playersNumber;
+    if (hand->playersNumber == 0)
+        return FUNCTION_NO_ERROR;
+
+    state->leader = round_getPlayerId(round, hand->players[0]);
+    if (state->leader < 0)
+        return state->leader;
+
+    for (int i = 0; i < hand->playersNumber; i++) {
+        if (!deck_isCard(hand->cards[i]))
+            break;
+        state->table |= bitboard_getCardMask(hand->cards[i]);
+        state->owners[hand->cards[i].id] = round_getPlayerId(round,
+                                                             hand->players[i]);
+        state->cardsOnTable++;
+    }
+    if (state->cardsOnTable > 0)
+        state->leadSuit = deck_getCardSuit(hand->cards[0]);
+
+    return FUNCTION_NO_ERROR;
+}
+
+/**
+ * @brief Function searches the children of a node from first until last
+ *        (excluded) for the child which is reached with a move and counts its
+ *        visit. It returns -1 if the child isn't found.
+ */
+static int ismcts_findChild(struct IsmctsTree* tree, int first, int last,
+                            int move)
+{
+    for (int i = first; i >= 0 && i != last; i = tree->nodes[i].sibling) {
+        struct IsmctsNode *child = &(tree->nodes[i]);
+        if (child->move != move)
+            continue;
+        __atomic_fetch_add(&(child->visits), 1, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&(child->availability), 1, __ATOMIC_RELAXED);
+        return i;
+    }
+
+    return -1;
+}
+
+/**
+ * @brief Function takes a node from the pool of a tree and initializes it with
+ *        a visit. IsmctsTree::nodesNumber isn't incremented past
+ *        IsmctsTree::size, so it returns -1 if all the nodes are used.
+ */
+static int ismcts_reserveNode(struct IsmctsTree* tree, int move, int playerId)
+{
+    int index = __atomic_load_n(&(tree->nodesNumber), __ATOMIC_RELAXED);
+    do {
+        if (index >= tree->size)
+            return -1;
+    } while (!__atomic_compare_exchange_n(&(tree->nodesNumber), &index,
+                                          index + 1, 1, __ATOMIC_RELAXED,
+                                          __ATOMIC_RELAXED));
+
+    struct IsmctsNode *node = &(tree->nodes[index]);
+    node->child        = -1;
+    node->sibling      = -1;
+    node->move         = move;
+    node->playerId     = playerId;
+    node->visits       = 1;
+    node->availability = 1;
+    node->rewards      = 0;
+
+    return index;
+}
+
+/**
+ * @brief Function adds the child of a node which is reached with a move and
+ *        counts a visit of the child. If the child exists or another thread
+ *        added it meanwhile, that child is used. A node is taken from the
+ *        pool only when the child isn't found, and it is given back if
+ *        another thread added the child before it could be linked. It
+ *        returns -1 if all the nodes are used.
+ */
+static int ismcts_addNode(struct IsmctsTree* tree, int parent, int move,
+                          int playerId)
+{
+    if (parent < 0)
+        return ismcts_reserveNode(tree, move, playerId);
+
+    int *first = &(tree->nodes[parent].child);
+    int head = __atomic_load_n(first, __ATOMIC_ACQUIRE);
+    int child = ismcts_findChild(tree, head, -1, move);
+    if (child >= 0)
+        return child;
+
+    int index = ismcts_reserveNode(tree, move, playerId);
+    if (index < 0)
+        return -1;
+
+    /* The children are added in front of the list, so after a failed
+     * exchange only the children added meanwhile are searched. */
+    int last = head;
+    tree->nodes[index].sibling = head;
+    while (!__atomic_compare_exchange_n(first, &head, index, 1,
+                                        __ATOMIC_RELEASE, __ATOMIC_ACQUIRE)) {
+        child = ismcts_findChild(tree, head, last, move);
+        if (child >= 0) {
+            int next = index + 1;
+            __atomic_compare_exchange_n(&(tree->nodesNumber), &next, index, 0,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+            return child;
+        }
+        last = head;
+        tree->nodes[index].sibling = head;
+    }
+
+    return index;
+}
+
+/**
+ * @brief Function chooses the child of a node with the moves which can be
+ *        made (UCB1 in which the number of the visits of the parent is
+ *        replaced with the availability of the child) and counts its visit.
+ *        It returns -1 if a move which can be made doesn't have a child yet,
+ *        in untried are saved these moves.
+ */
+static int ismcts_selectChild(struct IsmctsTree* tree, int parent,
+                              uint64_t moves, uint64_t* untried)
+{
+    int best = -1;
+    float bestValue = 0;
+
+    *untried = moves;
+    for (int i = __atomic_load_n(&(tree->nodes[parent].child),
+                                 __ATOMIC_ACQUIRE);
+         i >= 0; i = tree->nodes[i].sibling) {
+        struct IsmctsNode *node = &(tree->nodes[i]);
+        if (((moves >> node->move) & 1) == 0)
+            continue;
+
+        *untried &= ~(UINT64_C(1) << node->move);
+        int availability = __atomic_add_fetch(&(node->availability), 1,
+                                              __ATOMIC_RELAXED);
+        int visits = __atomic_load_n(&(node->visits), __ATOMIC_RELAXED);
+        long rewards = __atomic_load_n(&(node->rewards), __ATOMIC_RELAXED);
+
+        float value = (float)rewards / (visits * ISMCTS_REWARD_RANGE) +
+                      ISMCTS_EXPLORATION *
+                      sqrtf(logf(availability) / visits);
+        if (best < 0 || value > bestValue) {
+            best      = i;
+            bestValue = value;
+        }
+    }
+
+    if (*untried != 0)
+        return -1;
+
+    __atomic_fetch_add(&(tree->nodes[best].visits), 1, __ATOMIC_RELAXED);
+
+    return best;
+}
+
+/**
+ * @brief Function makes an iteration of the search.
+ */
+static void ismcts_runIteration(struct IsmctsWorker* worker)
+{
+    struct IsmctsTree *tree = worker->tree;
+    struct Random *random = &(worker->random);
+
+    struct IsmctsState state = worker->ismcts->known;
+    world_dealCards(&(worker->ismcts->world), random, state.hands);
+
+    int path[ROUND_MOVES_NUMBER];
+    int depth = 0;
+    int node = 0;
+
+    uint64_t moves;
+    while ((moves = ismcts_getMoves(&state)) != 0) {
+        uint64_t untried;
+        int child = ismcts_selectChild(tree, node, moves, &untried);
+        if (child < 0) {
+            int index = random_getBoundedNumber(random,
+                                                bitboard_countCards(untried));
+            int move = world_getCard(untried, index);
+            child = ismcts_addNode(tree, node, move,
+                                   ismcts_getPlayerId(&state));
+            if (child >= 0) {
+                ismcts_applyMove(&state, move);
+                path[depth++] = child;
+            }
+            break;
+        }
+
+        ismcts_applyMove(&state, tree->nodes[child].move);
+        path[depth++] = child;
+        node = child;
+    }
+
+    while ((moves = ismcts_getMoves(&state)) != 0)
+        ismcts_applyRandomMove(&state, random, moves);
+
+    int rewards[MAX_GAME_PLAYERS];
+    ismcts_getRewards(&state, rewards);
+
+    for (int i = 0; i < depth; i++) {
+        struct IsmctsNode *current = &(tree->nodes[path[i]]);
+        __atomic_fetch_add(&(current->rewards), rewards[current->playerId],
+                           __ATOMIC_RELAXED);
+    }
+}
+
+static void *ismcts_runWorker(void* data)
+{
+    struct IsmctsWorker *worker = data;
+    struct Ismcts *ismcts = worker->ismcts;
+
+    long playoutsLimit = 0;
+    if (ismcts->playoutsLimit > 0)
+        playoutsLimit = (ismcts->playoutsLimit + ismcts->threadsNumber - 1) /
+                        ismcts->threadsNumber;
+
+    worker->playoutsNumber = 0;
+    do {
+        ismcts_runIteration(worker);
+        worker->playoutsNumber++;
+    } while (ismcts_getTime() < ismcts->deadline &&
+             (playoutsLimit == 0 || worker->playoutsNumber < playoutsLimit));
+
+    return NULL;
+}
+
+/**
+ * @brief Function searches on all the threads until the deadline or until
+ *        all the threads reach Ismcts::playoutsLimit, the first thread being
+ *        the calling thread.
+ */
+static void ismcts_runWorkers(struct Ismcts* ismcts)
+{
+    for (int i = 0; i < ismcts->threadsNumber; i++) {
+        struct IsmctsWorker *worker = &(ismcts->workers[i]);
+        random_setSeed(&(worker->random), random_getNumber(&(ismcts->random)));
+        worker->playoutsNumber = 0;
+    }
+
+    pthread_t threads[ISMCTS_MAX_THREADS];
+    int threadsNumber = 1;
+    for (; threadsNumber < ismcts->threadsNumber; threadsNumber++)
+        if (pthread_create(&threads[threadsNumber], NULL, ismcts_runWorker,
+                           &(ismcts->workers[threadsNumber])) != 0)
+            break;
+
+    ismcts_runWorker(&(ismcts->workers[0]));
+
+    for (int i = 1; i < threadsNumber; i++)
+        pthread_join(threads[i], NULL);
+}
+
+/**
+ * @brief Function searches the move of a player until the deadline and
+ *        returns the move with the most visits of the children of the roots.
+ */
+static int ismcts_search(struct Ismcts* ismcts, const struct Round* round,
+                         int playerId, int milliseconds)
+{
+    double start = ismcts_getTime();
+    ismcts->deadline = start + milliseconds / 1000.0;
+
+    int check = world_readRound(&(ismcts->world), round, playerId);
+    if (check != FUNCTION_NO_ERROR)
+        return check;
+
+    check = ismcts_loadState(&(ismcts->known), round, playerId);
+    if (check != FUNCTION_NO_ERROR)
+        return check;
+
+    uint64_t moves = ismcts_getMoves(&(ismcts->known));
+    if (moves == 0)
+        return NOT_FOUND;
+    /* A single move doesn't need a search. */
+    if ((moves & (moves - 1)) == 0)
+        return __builtin_ctzll(moves);
+
+    int treesNumber = 1;
+    if (ismcts->mode == ISMCTS_ROOT_PARALLEL)
+        treesNumber = ismcts->threadsNumber;
+    for (int i = 0; i < treesNumber; i++) {
+        ismcts->trees[i].nodesNumber = 0;
+        ismcts_addNode(&(ismcts->trees[i]), -1, -1, -1);
+    }
+
+    ismcts_runWorkers(ismcts);
+
+    long visits[DECK_SIZE] = {0};
+    for (int i = 0; i < treesNumber; i++) {
+        const struct IsmctsTree *tree = &(ismcts->trees[i]);
+        for (int j = tree->nodes[0].child; j >= 0; j = tree->nodes[j].sibling)
+            visits[tree->nodes[j].move] += tree->nodes[j].visits;
+    }
+
+    int best = __builtin_ctzll(moves);
+    for (int i = best + 1; i < DECK_SIZE; i++)
+        if (((moves >> i) & 1) && visits[i] > visits[best])
+            best = i;
+
+    long playouts = 0;
+    for (int i = 0; i < ismcts->threadsNumber; i++)
+        playouts += ismcts->workers[i].playoutsNumber;
+
+    double seconds = ismcts_getTime() - start;
+    ismcts->decisionsNumber++;
+    ismcts->playoutsNumber += playouts;
+    ismcts->seconds        += seconds;
+    if (seconds > ismcts->maxSeconds)
+        ismcts->maxSeconds = seconds;
+
+    return best;
+}
+
+int ismcts_getBid(struct Ismcts* ismcts, const struct Player* player,
+                  const struct Round* round, int milliseconds)
+{
+    if (ismcts == NULL)
+        return POINTER_NULL;
+    if (player == NULL)
+        return PLAYER_NULL;
+    if (round == NULL)
+        return ROUND_NULL;
+    if (round->hand != NULL || milliseconds < 0)
+        return ILLEGAL_VALUE;
+
+    int playerId = round_getPlayerId(round, player);
+    if (playerId < 0)
+        return playerId;
+
+    return ismcts_search(ismcts, round, playerId, milliseconds);
+}
+
+int ismcts_getCardId(struct Ismcts* ismcts, const struct Player* player,
+                     const struct Round* round, int milliseconds)
+{
+    if (ismcts == NULL)
+        return POINTER_NULL;
+    if (player == NULL)
+        return PLAYER_NULL;
+    if (round == NULL)
+        return ROUND_NULL;
+    if (round->hand == NULL)
+        return HAND_NULL;
+    if (milliseconds < 0)
+        return ILLEGAL_VALUE;
+
+    int playerId = round_getPlayerId(round, player);
+    if (playerId < 0)
+        return playerId;
+
+    int card = ismcts_search(ismcts, round, playerId, milliseconds);
+    if (card < 0)
+        return card;
+
+    for (int i = 0; i < MAX_CARDS; i++)
+        if (deck_isCard(player->hand[i]) && player->hand[i].id == card)
+            return i;
+
+    return NOT_FOUND;
+}
@@ -0,0 +1,282 @@
+/**
+ * @file ismcts.h
+ * @brief Ismcts structure, as well as the functions of the robot which uses
+ *        Information Set Monte Carlo Tree Search. At every iteration the
+ *        cards which the robot doesn't see are dealt again, a path is chosen
+ *        in the tree with the moves which are possible with these cards and
+ *        the round is finished with random moves (a playout). The robot makes
+ *        the move which was visited the most times.
+ *
+ *        The search can use more threads: every thread can grow its own tree
+ *        (root parallelism, the visits of the moves from all the trees are
+ *        added at the end) or all the threads grow the same tree (tree
+ *        parallelism, the nodes are updated with atomic operations, without
+ *        locks).
+ */
+
+#ifndef ISMCTS_H
+#define ISMCTS_H
+
+#include "world.h"
+
+#include <libWhistGame.h>
+
+#include <stdint.h>
+
+/**
+ * @brief The maximum number of threads which an Ismcts can use.
+ */
+#define ISMCTS_MAX_THREADS 64
+
+/**
+ * @brief The number of the nodes of a tree for every thread which grows it.
+ *        The nodes are allocated together with the Ismcts, when all are used
+ *        the tree isn't expanded anymore.
+ */
+#define ISMCTS_NODES_NUMBER (1 << 18)
+
+/**
+ * @brief The weight of the exploration in the choice of a node.
+ */
+#define ISMCTS_EXPLORATION 0.7
+
+/**
+ * @enum IsmctsMode
+ *
+ * @brief The ways in which the threads of an Ismcts share the search.
+ */
+enum IsmctsMode {ISMCTS_ROOT_PARALLEL = 0, ISMCTS_TREE_PARALLEL, IsmctsModeEnd};
+
+/**
+ * @struct IsmctsNode
+ *
+ * @brief IsmctsNode structure. A node of the tree, the children of a node
+ *        are kept as a list. A thread counts its visit when it passes through
+ *        the node and adds the reward only at the end of the iteration, so
+ *        until then the node looks worse to the other threads (virtual loss).
+ *
+ * @var IsmctsNode::child
+ *      The index of the first child or -1.
+ * @var IsmctsNode::sibling
+ *      The index of the next child of the parent or -1.
+ * @var IsmctsNode::move
+ *      The move which leads to the node: a bid or the id of a card.
+ * @var IsmctsNode::playerId
+ *      The id in round of the player which made the move, -1 for the root.
+ * @var IsmctsNode::visits
+ *      The number of the iterations which passed through the node.
+ * @var IsmctsNode::availability
+ *      The number of the iterations in which the move was possible when the
+ *      parent was visited.
+ * @var IsmctsNode::rewards
+ *      The sum of the rewards of the player from the iterations which passed
+ *      through the node, a reward being the points of the player plus
+ *      MAX_CARDS.
+ */
+struct IsmctsNode {
+    int child;
+    int sibling;
+    signed char move;
+    signed char playerId;
+    int visits;
+    int availability;
+    long rewards;
+};
+
+/**
+ * @struct IsmctsTree
+ *
+ * @brief IsmctsTree structure.
+ *
+ * @var IsmctsTree::nodes
+ *      The nodes of the tree, the first is the root.
+ * @var IsmctsTree::size
+ *      The number of the nodes which can be used.
+ * @var IsmctsTree::nodesNumber
+ *      The number of the nodes taken by the threads, at most size.
+ */
+struct IsmctsTree {
+    struct IsmctsNode *nodes;
+    int size;
+    int nodesNumber;
+};
+
+/**
+ * @struct IsmctsWorker
+ *
+ * @brief IsmctsWorker structure. The data of a thread of an Ismcts.
+ *
+ * @var IsmctsWorker::ismcts
+ *      Pointer to the Ismcts of the thread.
+ * @var IsmctsWorker::tree
+ *      Pointer to the tree grown by the thread.
+ * @var IsmctsWorker::random
+ *      The generator used by the thread to deal the cards and for the
+ *      playouts.
+ * @var IsmctsWorker::playoutsNumber
+ *      The number of the playouts of the thread in the current decision.
+ */
+struct IsmctsWorker {
+    struct Ismcts *ismcts;
+    struct IsmctsTree *tree;
+    struct Random random;
+    long playoutsNumber;
+};
+
+/**
+ * @struct IsmctsState
+ *
+ * @brief IsmctsState structure. The state of a round in a search, with the
+ *        cards as bitboards. The players have the ids from Round::players.
+ *
+ * @var IsmctsState::hands
+ *      The cards of each player.
+ * @var IsmctsState::table
+ *      The cards put down in the current hand.
+ * @var IsmctsState::owners
+ *      For every card from table, the id of the player which put it down.
+ * @var IsmctsState::bids
+ *      The bids of the players.
+ * @var IsmctsState::handsNumber
+ *      The number of the hands won by each player.
+ * @var IsmctsState::playersNumber
+ *      The number of the players.
+ * @var IsmctsState::roundType
+ *      The number of the cards of each player at the start of the round.
+ * @var IsmctsState::bidsNumber
+ *      The number of the players which bid.
+ * @var IsmctsState::bidsSum
+ *      The sum of the bids.
+ * @var IsmctsState::leader
+ *      The id of the player which starts the current hand.
+ * @var IsmctsState::cardsOnTable
+ *      The number of the cards from table.
+ * @var IsmctsState::trump
+ *      The suit of the trump or SuitEnd.
+ * @var IsmctsState::leadSuit
+ *      The suit of the first card of the hand or SuitEnd.
+ */
+struct IsmctsState {
+    uint64_t hands[MAX_GAME_PLAYERS];
+    uint64_t table;
+    signed char owners[DECK_SIZE];
+    int bids[MAX_GAME_PLAYERS];
+    int handsNumber[MAX_GAME_PLAYERS];
+    int playersNumber;
+    int roundType;
+    int bidsNumber;
+    int bidsSum;
+    int leader;
+    int cardsOnTable;
+    enum Suit trump;
+    enum Suit leadSuit;
+};
+
+/**
+ * @struct Ismcts
+ *
+ * @brief Ismcts structure. An Ismcts can be used for the decisions of all
+ *        the robots from a game, but only by a thread at a time.
+ *
+ * @var Ismcts::threadsNumber
+ *      The number of the threads which search.
+ * @var Ismcts::mode
+ *      The way in which the threads share the search.
+ * @var Ismcts::playoutsLimit
+ *      The maximum number of playouts of a decision, divided equally between
+ *      the threads, 0 if the threads search until the deadline.
+ * @var Ismcts::trees
+ *      The trees of the threads for ISMCTS_ROOT_PARALLEL, only the first for
+ *      ISMCTS_TREE_PARALLEL.
+ * @var Ismcts::workers
+ *      The data of the threads.
+ * @var Ismcts::random
+ *      The generator from which are seeded the threads for every decision.
+ * @var Ismcts::world
+ *      What the player knows in the current decision.
+ * @var Ismcts::known
+ *      The state of the round in the current decision, without the cards of
+ *      the other players.
+ * @var Ismcts::deadline
+ *      The time of the monotonic clock, in seconds, when the current
+ *      decision must end.
+ * @var Ismcts::decisionsNumber
+ *      The number of the decisions made by the Ismcts.
+ * @var Ismcts::playoutsNumber
+ *      The number of the playouts of all the decisions.
+ * @var Ismcts::seconds
+ *      The time of all the decisions.
+ * @var Ismcts::maxSeconds
+ *      The time of the longest decision.
+ */
+struct Ismcts {
+    int threadsNumber;
+    enum IsmctsMode mode;
+    long playoutsLimit;
+    struct IsmctsTree trees[ISMCTS_MAX_THREADS];
+    struct IsmctsWorker workers[ISMCTS_MAX_THREADS];
+    struct Random random;
+    struct World world;
+    struct IsmctsState known;
+    double deadline;
+    long decisionsNumber;
+    long playoutsNumber;
+    double seconds;
+    double maxSeconds;
+};
+
+/**
+ * @brief Function allocates and initializes an Ismcts.
+ *
+ * @param threadsNumber The number of the threads which search, if it is 0
+ *                      then are used all the processors.
+ * @param mode The way in which the threads share the search.
+ * @param seed The seed of the generator of the Ismcts.
+ *
+ * @return Pointer to the new Ismcts on success, NULL on failure.
+ */
+struct Ismcts *ismcts_createIsmcts(int threadsNumber, enum IsmctsMode mode,
+                                   uint64_t seed);
+
+/**
+ * @brief Function releases the memory of an Ismcts and makes the pointer
+ *        NULL.
+ *
+ * @param ismcts Pointer to pointer to the Ismcts which to be released.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int ismcts_deleteIsmcts(struct Ismcts** ismcts);
+
+/**
+ * @brief Function determines the bid of a robot. The players bid in the
+ *        order from Round::players.
+ *
+ * @param ismcts Pointer to the Ismcts.
+ * @param player Pointer to the player which is robot.
+ * @param round Pointer to the round in which is the robot.
+ * @param milliseconds The time after which the robot must bid.
+ *
+ * @return A value between 0 and roundType on success, a negative value on
+ *         failure.
+ */
+int ismcts_getBid(struct Ismcts* ismcts, const struct Player* player,
+                  const struct Round* round, int milliseconds);
+
+/**
+ * @brief Function determines the position of the card which the robot puts
+ *        down. The round must be played with round_applyMove(), because the
+ *        robot finds the cards already played in Round::moves.
+ *
+ * @param ismcts Pointer to the Ismcts.
+ * @param player Pointer to the player which is robot.
+ * @param round Pointer to the round in which is the robot.
+ * @param milliseconds The time after which the robot must put down the card.
+ *
+ * @return A value between 0 and MAX_CARDS - 1 on success, a negative value on
+ *         failure.
+ */
+int ismcts_getCardId(struct Ismcts* ismcts, const struct Player* player,
+                     const struct Round* round, int milliseconds);
+
+#endif
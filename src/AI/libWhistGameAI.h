@@ -2,6 +2,11 @@
 #define LIBWHISTGAMEAI_H
 
 #include "robot.h"
+#include "solver.h"
+#include "world.h"
+#include "pimc.h"
+#include "ismcts.h"
+#include "bidtable.h"
 
 #endif
 
@@ -0,0 +1,307 @@
+/**
+ * @file pimc.c
+ * @brief In this file are defined the functions of the Monte Carlo robot,
+ *        these functions are declared in the header file pimc.h.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "pimc.h"
+#include "robot.h"
+
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * @brief The factor of the points of a round in the scores of the cards, it
+ *        must be bigger than the number of hands of a round.
+ */
+#define PIMC_SCORE_SCALE 16
+
+struct Pimc *pimc_createPimc(int threadsNumber, uint64_t seed)
+{
+    if (threadsNumber == 0) {
+        long processors = sysconf(_SC_NPROCESSORS_ONLN);
+        threadsNumber = processors > 0 ? processors : 1;
+    }
+    if (threadsNumber < 0)
+        return NULL;
+    if (threadsNumber > PIMC_MAX_THREADS)
+        threadsNumber = PIMC_MAX_THREADS;
+
+    struct Pimc *pimc = malloc(sizeof(struct Pimc));
+    if (pimc == NULL)
+        return NULL;
+
+    pimc->threadsNumber   = threadsNumber;
+    pimc->worldsLimit     = 0;
+    pimc->round           = NULL;
+    pimc->deadline        = 0;
+    pimc->stop            = 0;
+    pimc->decisionsNumber = 0;
+    pimc->worldsNumber    = 0;
+    pimc->seconds         = 0;
+    pimc->maxSeconds      = 0;
+    random_setSeed(&(pimc->random), seed);
+
+    for (int i = 0; i < PIMC_MAX_THREADS; i++) {
+        pimc->workers[i].pimc   = pimc;
+        pimc->workers[i].solver = NULL;
+    }
+
+    for (int i = 0; i < threadsNumber; i++) {
+        struct Solver *solver = solver_createSolver();
+        if (solver == NULL) {
+            pimc_deletePimc(&pimc);
+            return NULL;
+        }
+        solver->stop = &(pimc->stop);
+        pimc->workers[i].solver = solver;
+    }
+
+    return pimc;
+}
+
+int pimc_deletePimc(struct Pimc** pimc)
+{
+    if (pimc == NULL)
+        return POINTER_NULL;
+    if (*pimc == NULL)
+        return POINTER_NULL;
+
+    for (int i = 0; i < PIMC_MAX_THREADS; i++)
+        if ((*pimc)->workers[i].solver != NULL)
+            solver_deleteSolver(&((*pimc)->workers[i].solver));
+
+    free(*pimc);
+    *pimc = NULL;
+
+    return FUNCTION_NO_ERROR;
+}
+
+/**
+ * @brief Function gets the time of the monotonic clock in seconds.
+ */
+static double pimc_getTime()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+
+    return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Function checks if the deadline of the current decision came. The
+ *        thread which finds it first stops the solvers of the others.
+ */
+static int pimc_isStopped(struct Pimc* pimc)
+{
+    if (__atomic_load_n(&(pimc->stop), __ATOMIC_RELAXED) != 0)
+        return 1;
+    if (pimc_getTime() < pimc->deadline)
+        return 0;
+
+    __atomic_store_n(&(pimc->stop), 1, __ATOMIC_RELAXED);
+
+    return 1;
+}
+
+/**
+ * @brief Function gets the score of a player which bid bid hands and must
+ *        still win need hands, if he can win between lower and upper hands.
+ *        The points of the round are multiplied by PIMC_SCORE_SCALE and, when
+ *        the player can make his bid, the margin which he has on both sides
+ *        is added, so that from the cards which make the bid is preferred the
+ *        one which leaves him more choices.
+ */
+static int pimc_getScore(int bid, int need, int lower, int upper)
+{
+    if (need < lower)
+        return (need - lower) * PIMC_SCORE_SCALE;
+    if (need > upper)
+        return (upper - need) * PIMC_SCORE_SCALE;
+
+    int margin = need - lower;
+    if (upper - need < margin)
+        margin = upper - need;
+
+    return (POINTS_PER_ROUND + bid) * PIMC_SCORE_SCALE + margin;
+}
+
+/**
+ * @brief Function solves a world for every card which the player can put
+ *        down and saves the scores.
+ */
+static int pimc_solveWorld(struct Pimc* pimc, struct Solver* solver,
+                           long* scores)
+{
+    const struct Round *round = pimc->round;
+    const struct Player *player = round->players[pimc->playerId];
+    int bid  = round->bids[pimc->playerId];
+    int need = bid - round->handsNumber[pimc->playerId];
+
+    struct SolverState world = solver->state;
+    solver->nodesLimit = solver->nodesNumber + PIMC_NODES_LIMIT;
+
+    for (int i = 0; i < MAX_CARDS; i++) {
+        if (((pimc->cards >> i) & 1) == 0)
+            continue;
+        if (pimc_isStopped(pimc))
+            return LIMIT_REACHED;
+
+        solver->state = world;
+        int check = solver_playCard(solver, player->hand[i].id);
+        if (check != FUNCTION_NO_ERROR)
+            return check;
+
+        int upper = solver_getHands(solver, pimc->playerId, 1);
+        if (upper < 0)
+            return upper;
+        int lower = solver_getHands(solver, pimc->playerId, 0);
+        if (lower < 0)
+            return lower;
+
+        scores[i] = pimc_getScore(bid, need, lower, upper);
+    }
+
+    return FUNCTION_NO_ERROR;
+}
+
+static void *pimc_runWorker(void* data)
+{
+    struct PimcWorker *worker = data;
+    struct Pimc *pimc = worker->pimc;
+    struct Solver *solver = worker->solver;
+
+    long worldsLimit = 0;
+    if (pimc->worldsLimit > 0)
+        worldsLimit = (pimc->worldsLimit + pimc->threadsNumber - 1) /
+                      pimc->threadsNumber;
+
+    worker->worldsNumber = 0;
+    for (int i = 0; i < MAX_CARDS; i++)
+        worker->scores[i] = 0;
+
+    solver->deadline = pimc->deadline;
+    if (solver_loadRound(solver, pimc->round) == FUNCTION_NO_ERROR) {
+        struct SolverState known = solver->state;
+
+        while (!pimc_isStopped(pimc) &&
+               (worldsLimit == 0 || worker->worldsNumber < worldsLimit)) {
+            solver->state = known;
+
+            if (world_dealCards(&(pimc->world), &(worker->random),
+                                solver->state.hands) != FUNCTION_NO_ERROR)
+                break;
+
+            long scores[MAX_CARDS];
+            if (pimc_solveWorld(pimc, solver, scores) != FUNCTION_NO_ERROR)
+                continue;
+
+            for (int i = 0; i < MAX_CARDS; i++)
+                if ((pimc->cards >> i) & 1)
+                    worker->scores[i] += scores[i];
+            worker->worldsNumber++;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Function solves worlds on all the threads until the deadline or
+ *        until all the threads reach Pimc::worldsLimit. The calling thread is
+ *        the first worker, so that the deadline is checked by a thread which
+ *        is running and doesn't wait to be woken up.
+ */
+static void pimc_runWorkers(struct Pimc* pimc, int milliseconds)
+{
+    pimc->deadline = pimc_getTime() + milliseconds / 1000.0;
+    pimc->stop     = 0;
+
+    for (int i = 0; i < pimc->threadsNumber; i++)
+        random_setSeed(&(pimc->workers[i].random),
+                       random_getNumber(&(pimc->random)));
+
+    pthread_t threads[PIMC_MAX_THREADS];
+    int threadsNumber = 1;
+    for (; threadsNumber < pimc->threadsNumber; threadsNumber++)
+        if (pthread_create(&threads[threadsNumber], NULL, pimc_runWorker,
+                           &(pimc->workers[threadsNumber])) != 0)
+            break;
+
+    pimc_runWorker(&(pimc->workers[0]));
+
+    for (int i = 1; i < threadsNumber; i++)
+        pthread_join(threads[i], NULL);
+
+    for (int i = threadsNumber; i < pimc->threadsNumber; i++)
+        pimc->workers[i].worldsNumber = 0;
+}
+
+int pimc_getCardId(struct Pimc* pimc, const struct Player* player,
+                   const struct Round* round, int milliseconds)
+{
+    if (pimc == NULL)
+        return POINTER_NULL;
+    if (player == NULL)
+        return PLAYER_NULL;
+    if (round == NULL)
+        return ROUND_NULL;
+    if (round->hand == NULL)
+        return HAND_NULL;
+    if (milliseconds < 0)
+        return ILLEGAL_VALUE;
+
+    int playerId = round_getPlayerId(round, player);
+    if (playerId < 0)
+        return playerId;
+
+    int cards = hand_getLegalCards(round->hand, player, round->trump);
+    if (cards < 0)
+        return cards;
+    if (cards == 0)
+        return NOT_FOUND;
+    if ((cards & (cards - 1)) == 0)
+        return __builtin_ctz(cards);
+
+    double start = pimc_getTime();
+
+    pimc->round    = round;
+    pimc->playerId = playerId;
+    pimc->cards    = cards;
+    int check = world_readRound(&(pimc->world), round, playerId);
+    if (check != FUNCTION_NO_ERROR)
+        return check;
+    pimc_runWorkers(pimc, milliseconds);
+
+    long worldsNumber = 0;
+    long scores[MAX_CARDS] = {0};
+    for (int i = 0; i < pimc->threadsNumber; i++) {
+        const struct PimcWorker *worker = &(pimc->workers[i]);
+        if (worker->worldsNumber == 0)
+            continue;
+        worldsNumber += worker->worldsNumber;
+        for (int j = 0; j < MAX_CARDS; j++)
+            scores[j] += worker->scores[j];
+    }
+
+    /* Between the cards with the same score is chosen the card of the
+     * heuristic robot. */
+    int cardId = robot_getCardId(player, round);
+    if (cardId < 0 || ((cards >> cardId) & 1) == 0)
+        cardId = __builtin_ctz(cards);
+    for (int i = 0; i < MAX_CARDS; i++)
+        if (((cards >> i) & 1) && scores[i] > scores[cardId])
+            cardId = i;
+
+    double seconds = pimc_getTime() - start;
+    pimc->decisionsNumber++;
+    pimc->worldsNumber += worldsNumber;
+    pimc->seconds      += seconds;
+    if (seconds > pimc->maxSeconds)
+        pimc->maxSeconds = seconds;
+
+    return cardId;
+}
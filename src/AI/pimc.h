@@ -0,0 +1,152 @@
+/**
+ * @file pimc.h
+ * @brief Pimc structure, as well as the functions of the Monte Carlo robot.
+ *        For every decision the robot deals many times the cards which he
+ *        doesn't see (the worlds), in the same way with what he saw in the
+ *        round, solves every world with the double-dummy solver and puts down
+ *        the card which has the best score on average.
+ */
+
+#ifndef PIMC_H
+#define PIMC_H
+
+#include "solver.h"
+#include "world.h"
+
+#include <libWhistGame.h>
+
+#include <pthread.h>
+
+/**
+ * @brief The maximum number of threads which a Pimc can use.
+ */
+#define PIMC_MAX_THREADS 64
+
+/**
+ * @brief The maximum number of positions which are searched in a world. The
+ *        worlds which need more are dropped, so that a single world can't
+ *        take all the time of a decision.
+ */
+#define PIMC_NODES_LIMIT 2000000L
+
+/**
+ * @struct PimcWorker
+ *
+ * @brief PimcWorker structure. The data of a thread of a Pimc, every thread
+ *        solves its own worlds.
+ *
+ * @var PimcWorker::pimc
+ *      Pointer to the Pimc of the thread.
+ * @var PimcWorker::solver
+ *      The solver used by the thread.
+ * @var PimcWorker::random
+ *      The generator with which are dealt the worlds of the thread.
+ * @var PimcWorker::worldsNumber
+ *      The number of the worlds solved by the thread in the current decision.
+ * @var PimcWorker::scores
+ *      For every card of the player, the sum of the scores from the worlds
+ *      solved by the thread.
+ */
+struct PimcWorker {
+    struct Pimc *pimc;
+    struct Solver *solver;
+    struct Random random;
+    long worldsNumber;
+    long scores[MAX_CARDS];
+};
+
+/**
+ * @struct Pimc
+ *
+ * @brief Pimc structure. A Pimc can be used for the decisions of all the
+ *        robots from a game, but only by a thread at a time.
+ *
+ * @var Pimc::threadsNumber
+ *      The number of the threads which solve worlds.
+ * @var Pimc::worldsLimit
+ *      The maximum number of worlds of a decision, divided equally between
+ *      the threads, 0 if the worlds are solved until the deadline.
+ * @var Pimc::random
+ *      The generator from which are seeded the threads for every decision.
+ * @var Pimc::workers
+ *      The data of the threads.
+ * @var Pimc::round
+ *      The round of the current decision.
+ * @var Pimc::playerId
+ *      The id in round of the player of the current decision.
+ * @var Pimc::cards
+ *      The mask of the positions from player's hand of the cards which he can
+ *      put down in the current decision.
+ * @var Pimc::world
+ *      What the player knows in the current decision.
+ * @var Pimc::deadline
+ *      The time of the monotonic clock, in seconds, at which the current
+ *      decision must be made. Every thread checks it between the worlds.
+ * @var Pimc::stop
+ *      The flag which stops the solvers of all the threads in the middle of
+ *      a world, it is set when the deadline comes.
+ * @var Pimc::decisionsNumber
+ *      The number of the decisions made by the Pimc.
+ * @var Pimc::worldsNumber
+ *      The number of the worlds solved in all the decisions.
+ * @var Pimc::seconds
+ *      The time of all the decisions.
+ * @var Pimc::maxSeconds
+ *      The time of the longest decision.
+ */
+struct Pimc {
+    int threadsNumber;
+    long worldsLimit;
+    struct Random random;
+    struct PimcWorker workers[PIMC_MAX_THREADS];
+    const struct Round *round;
+    int playerId;
+    int cards;
+    struct World world;
+    double deadline;
+    int stop;
+    long decisionsNumber;
+    long worldsNumber;
+    double seconds;
+    double maxSeconds;
+};
+
+/**
+ * @brief Function allocates and initializes a Pimc.
+ *
+ * @param threadsNumber The number of the threads which solve worlds, if it is
+ *                      0 then are used all the processors.
+ * @param seed The seed of the generator of the worlds.
+ *
+ * @return Pointer to the new Pimc on success, NULL on failure.
+ */
+struct Pimc *pimc_createPimc(int threadsNumber, uint64_t seed);
+
+/**
+ * @brief Function releases the memory of a Pimc and makes the pointer NULL.
+ *
+ * @param pimc Pointer to pointer to the Pimc which to be released.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int pimc_deletePimc(struct Pimc** pimc);
+
+/**
+ * @brief Function determines the position of the card which the robot puts
+ *        down. The round must be played with round_applyMove(), because the
+ *        robot finds the cards already played in Round::moves. If no world
+ *        is solved until the deadline, the card is chosen by
+ *        robot_getCardId().
+ *
+ * @param pimc Pointer to the Pimc.
+ * @param player Pointer to the player which is robot.
+ * @param round Pointer to the round in which is the robot.
+ * @param milliseconds The time after which the robot must put down the card.
+ *
+ * @return A value between 0 and MAX_CARDS - 1 on success, a negative value on
+ *         failure.
+ */
+int pimc_getCardId(struct Pimc* pimc, const struct Player* player,
+                   const struct Round* round, int milliseconds);
+
+#endif
@@ -16,10 +16,12 @@ int robot_getBid(const struct Player* player, const struct Round* round)
     if (round == NULL)
         return ROUND_NULL;
 
+    enum Suit trump = deck_getCardSuit(round->trump);
+
     if (round->roundType == 1) {
         for (int i = 0; i < MAX_CARDS; i++)
-            if (player->hand[i] != NULL &&
-                player->hand[i]->suit == round->trump->suit) {
+            if (deck_isCard(player->hand[i]) &&
+                deck_getCardSuit(player->hand[i]) == trump) {
                 if (round_checkBid(round, player, 1) == FUNCTION_NO_ERROR)
                     return 1;
                 else
@@ -34,9 +36,9 @@ int robot_getBid(const struct Player* player, const struct Round* round)
     if (round->roundType == 8) {
         int bids = 0;
         for (int i = 0; i < MAX_CARDS; i++)
-            if (player->hand[i] != NULL) {
-                if (player->hand[i]->value == 15 ||
-                    player->hand[i]->value == 14)
+            if (deck_isCard(player->hand[i])) {
+                if (deck_getCardValue(player->hand[i]) == 15 ||
+                    deck_getCardValue(player->hand[i]) == 14)
                     bids++;
             }
         if (round_checkBid(round, player, bids) == FUNCTION_NO_ERROR)
@@ -49,9 +51,10 @@ int robot_getBid(const struct Player* player, const struct Round* round)
 
     int bids = 0;
     for (int i = 0; i < MAX_CARDS; i++)
-        if (player->hand[i] != NULL) {
-            if ((player->hand[i]->suit == round->trump->suit &&
-                player->hand[i]->value >= 10) || player->hand[i]->value == 15)
+        if (deck_isCard(player->hand[i])) {
+            int value = deck_getCardValue(player->hand[i]);
+            if ((deck_getCardSuit(player->hand[i]) == trump && value >= 10) ||
+                value == 15)
                 bids++;
         }
     if (round_checkBid(round, player, bids) == FUNCTION_NO_ERROR)
@@ -80,9 +83,9 @@ int robot_getCardId(const struct Player* player, const struct Round* round)
             int max = 0;
             int position = -1;
             for (int i = 0; i < MAX_CARDS; i++)
-                if (player->hand[i] != NULL) {
-                    if (player->hand[i]->value > max) {
-                        max = player->hand[i]->value;
+                if (deck_isCard(player->hand[i])) {
+                    if (deck_getCardValue(player->hand[i]) > max) {
+                        max = deck_getCardValue(player->hand[i]);
                         position = i;
                     }
                 }
@@ -92,9 +95,9 @@ int robot_getCardId(const struct Player* player, const struct Round* round)
             int min = 16;
             int position  = -1;
             for (int i = 0; i < MAX_CARDS; i++)
-                if (player->hand[i] != NULL)
-                    if (player->hand[i]->value < min) {
-                        min = player->hand[i]->value;
+                if (deck_isCard(player->hand[i]))
+                    if (deck_getCardValue(player->hand[i]) < min) {
+                        min = deck_getCardValue(player->hand[i]);
                         position = i;
                     }
             if (position > -1)
@@ -114,33 +117,39 @@ int robot_getCardId(const struct Player* player, const struct Round* round)
     int minValueFirstCard    = 16;
     int posMinValueFirstCard = -1;
 
+    enum Suit trump     = deck_getCardSuit(round->trump);
+    enum Suit firstCard = deck_getCardSuit(round->hand->cards[0]);
+
     for (int i = 0; i < MAX_CARDS; i++) {
-        if (player->hand[i] != NULL) {
-            if (round->trump != NULL)
-                if (player->hand[i]->suit == round->trump->suit) {
+        if (deck_isCard(player->hand[i])) {
+            enum Suit suit = deck_getCardSuit(player->hand[i]);
+            int value      = deck_getCardValue(player->hand[i]);
+
+            if (trump != SuitEnd)
+                if (suit == trump) {
                     numberOfTrumps++;
 
-                    if (maxValueTrump < player->hand[i]->value) {
-                        maxValueTrump = player->hand[i]->value;
+                    if (maxValueTrump < value) {
+                        maxValueTrump = value;
                         posMaxValueTrump = i;
                     }
 
-                    if (minValueTrump > player->hand[i]->value) {
-                        minValueTrump = player->hand[i]->value;
+                    if (minValueTrump > value) {
+                        minValueTrump = value;
                         posMinValueTrump = i;
                     }
                 }
 
-            if (player->hand[i]->suit == round->hand->cards[0]->suit) {
+            if (suit == firstCard) {
                 numberOfFirstCard++;
 
-                if (maxValueFirstCard < player->hand[i]->value) {
-                    maxValueFirstCard = player->hand[i]->value;
+                if (maxValueFirstCard < value) {
+                    maxValueFirstCard = value;
                     posMaxValueFirstCard = i;
                 }
 
-                if (minValueFirstCard > player->hand[i]->value) {
-                    minValueFirstCard = player->hand[i]->value;
+                if (minValueFirstCard > value) {
+                    minValueFirstCard = value;
                     posMinValueFirstCard = i;
                 }
             }
@@ -157,9 +166,9 @@ int robot_getCardId(const struct Player* player, const struct Round* round)
                 int min = 16;
                 int pos = -1;
                 for (int i = 0; i < MAX_CARDS; i++)
-                    if (player->hand[i] != NULL)
-                        if (player->hand[i]->value < min) {
-                            min = player->hand[i]->value;
+                    if (deck_isCard(player->hand[i]))
+                        if (deck_getCardValue(player->hand[i]) < min) {
+                            min = deck_getCardValue(player->hand[i]);
                             pos = i;
                         }
                 if (pos > -1)
@@ -176,9 +185,9 @@ int robot_getCardId(const struct Player* player, const struct Round* round)
                 int max = 0;
                 int pos = -1;
                 for (int i = 0; i < MAX_CARDS; i++)
-                    if (player->hand[i] != NULL)
-                        if (player->hand[i]->value > max) {
-                            max = player->hand[i]->value;
+                    if (deck_isCard(player->hand[i]))
+                        if (deck_getCardValue(player->hand[i]) > max) {
+                            max = deck_getCardValue(player->hand[i]);
                             pos = i;
                         }
                 if (pos > -1)
@@ -186,5 +195,6 @@ int robot_getCardId(const struct Player* player, const struct Round* round)
             }
         }
     }
-}
 
+    return NOT_FOUND;
+}
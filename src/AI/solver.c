@@ -0,0 +1,596 @@
+/**
+ * @file solver.c
+ * @brief In this file are defined the functions of the double-dummy solver,
+ *        these functions are declared in the header file solver.h.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "solver.h"
+
+#include <stdlib.h>
+#include <time.h>
+
+/**
+ * @brief The first index of the Zobrist keys used for the searchKey of a
+ *        solver, after the keys used for the rounds.
+ */
+#define SOLVER_KEYS (ZOBRIST_NEED_KEYS + MAX_GAME_PLAYERS * (2 * MAX_CARDS + 1))
+
+struct Solver *solver_createSolver()
+{
+    struct Solver *solver = malloc(sizeof(struct Solver));
+    if (solver == NULL)
+        return NULL;
+
+    solver->target      = 0;
+    solver->maximize    = 1;
+    solver->searchKey   = 0;
+    solver->nodesNumber = 0;
+    solver->nodesLimit  = 0;
+    solver->stop        = NULL;
+    solver->deadline    = 0;
+
+    for (int i = 0; i < SOLVER_TABLE_SIZE; i++) {
+        solver->table[i].key      = 0;
+        solver->table[i].lower    = 0;
+        solver->table[i].upper    = MAX_CARDS;
+        solver->table[i].bestCard = -1;
+    }
+
+    return solver;
+}
+
+int solver_deleteSolver(struct Solver** solver)
+{
+    if (solver == NULL)
+        return POINTER_NULL;
+    if (*solver == NULL)
+        return POINTER_NULL;
+
+    free(*solver);
+    *solver = NULL;
+
+    return FUNCTION_NO_ERROR;
+}
+
+int solver_loadRound(struct Solver* solver, const struct Round* round)
+{
+    if (solver == NULL)
+        return POINTER_NULL;
+    if (round == NULL)
+        return ROUND_NULL;
+    if (round->playersNumber < MIN_GAME_PLAYERS)
+        return INSUFFICIENT_PLAYERS;
+
+    struct SolverState *state = &(solver->state);
+    state->playersNumber = round->playersNumber;
+    state->trump         = deck_getCardSuit(round->trump);
+    state->leadSuit      = SuitEnd;
+    state->leader        = 0;
+    state->cardsOnTable  = 0;
+    state->table         = 0;
+
+    for (int i = 0; i < MAX_GAME_PLAYERS; i++)
+        state->hands[i] = bitboard_getPlayerCards(round->players[i]);
+
+    const struct Hand *hand = round->hand;
+    if (hand == NULL || hand->playersNumber == 0)
+        return FUNCTION_NO_ERROR;
+
+    state->leader = round_getPlayerId(round, hand->players[0]);
+    if (state->leader < 0)
+        return state->leader;
+
+    for (int i = 0; i < hand->playersNumber; i++) {
+        if (!deck_isCard(hand->cards[i]))
+            break;
+        state->table |= bitboard_getCardMask(hand->cards[i]);
+        state->owners[hand->cards[i].id] = round_getPlayerId(round,
+                                                             hand->players[i]);
+        state->cardsOnTable++;
+    }
+    state->leadSuit = deck_getCardSuit(hand->cards[0]);
+
+    return FUNCTION_NO_ERROR;
+}
+
+int solver_getPlayerToMove(const struct Solver* solver)
+{
+    if (solver == NULL)
+        return POINTER_NULL;
+
+    const struct SolverState *state = &(solver->state);
+    if (state->cardsOnTable == state->playersNumber)
+        return NOT_FOUND;
+
+    return (state->leader + state->cardsOnTable) % state->playersNumber;
+}
+
+/**
+ * @brief Function gets the number of the hands which are still played.
+ */
+static inline int solver_getHandsLeft(const struct SolverState* state)
+{
+    return bitboard_countCards(state->hands[state->leader]) +
+           (state->cardsOnTable > 0);
+}
+
+/**
+ * @brief Function puts down a card, the card must be legal.
+ */
+static inline void solver_putCard(struct SolverState* state, int player,
+                                  int card)
+{
+    uint64_t mask = UINT64_C(1) << card;
+
+    if (state->cardsOnTable == 0)
+        state->leadSuit = bitboard_getSuit(card);
+
+    state->hands[player] &= ~mask;
+    state->table         |= mask;
+    state->owners[card]   = player;
+    state->cardsOnTable++;
+}
+
+/**
+ * @brief Function takes back a card put down with solver_putCard().
+ */
+static inline void solver_takeCard(struct SolverState* state, int player,
+                                   int card)
+{
+    uint64_t mask = UINT64_C(1) << card;
+
+    state->hands[player] |= mask;
+    state->table         &= ~mask;
+    state->cardsOnTable--;
+
+    if (state->cardsOnTable == 0)
+        state->leadSuit = SuitEnd;
+}
+
+/**
+ * @brief Function gets the key of a position from the start of a hand. The
+ *        cards are keyed by their rank among the cards of their suit which
+ *        are still in hands and not by their id, because the result of the
+ *        position depends only on these ranks. So the positions reached after
+ *        different cards were played, but which have the same ranks, have the
+ *        same key.
+ */
+static uint64_t solver_getKey(const struct SolverState* state)
+{
+    uint64_t cards = 0;
+    for (int i = 0; i < state->playersNumber; i++)
+        cards |= state->hands[i];
+
+    uint64_t key = zobrist_getLeaderKey(state->leader);
+    for (int i = 0; i < state->playersNumber; i++)
+        for (uint64_t rest = state->hands[i]; rest != 0; rest &= rest - 1) {
+            int card = __builtin_ctzll(rest);
+            uint64_t mask = UINT64_C(1) << card;
+            uint64_t suit = bitboard_getSuitMask(bitboard_getSuit(card));
+            int rank = bitboard_countCards(cards & suit & ~(mask | (mask - 1)));
+            key ^= zobrist_getHandKey(i, card - card % RANKS_NUMBER + rank);
+        }
+
+    return key;
+}
+
+/**
+ * @brief Function keeps from the legal cards of a player only the highest card
+ *        of every sequence of equivalent cards. Two cards of the same suit are
+ *        equivalent if between them there isn't a card which is still in the
+ *        hand of another player or on table.
+ */
+static uint64_t solver_getDistinctCards(const struct SolverState* state,
+                                        int player, uint64_t cards)
+{
+    uint64_t others = state->table;
+    for (int i = 0; i < state->playersNumber; i++)
+        if (i != player)
+            others |= state->hands[i];
+
+    uint64_t distinct = 0;
+    while (cards != 0) {
+        int card = 63 - __builtin_clzll(cards);
+        uint64_t mask  = UINT64_C(1) << card;
+        uint64_t suit  = bitboard_getSuitMask(bitboard_getSuit(card));
+        uint64_t below = others & suit & (mask - 1);
+        uint64_t low   = 0;
+        if (below != 0)
+            low = (UINT64_C(2) << (63 - __builtin_clzll(below))) - 1;
+
+        distinct |= mask;
+        cards    &= ~((mask | (mask - 1)) & ~low & suit);
+    }
+
+    return distinct;
+}
+
+/**
+ * @brief Function checks if a card would win the current hand, if it is put
+ *        down now.
+ */
+static inline int solver_isWinningCard(const struct SolverState* state,
+                                       int card)
+{
+    uint64_t mask = UINT64_C(1) << card;
+    uint64_t higher = ~(mask | (mask - 1));
+    enum Suit suit = bitboard_getSuit(card);
+
+    if (bitboard_getSuitCards(state->table, state->trump) != 0)
+        return suit == state->trump &&
+               (bitboard_getSuitCards(state->table, suit) & higher) == 0;
+    if (suit == state->trump)
+        return 1;
+
+    return suit == state->leadSuit &&
+           (bitboard_getSuitCards(state->table, suit) & higher) == 0;
+}
+
+/**
+ * @brief Function orders the cards which are searched. The best card from the
+ *        transposition table is the first. On the first card of a hand the
+ *        cards are searched from the highest, else are searched first the
+ *        cards after which the hand is won by the side which the player wants
+ *        (the target or one of the other players), from the lowest, and then
+ *        the other cards, from the lowest.
+ */
+static int solver_orderCards(const struct Solver* solver, int player,
+                             uint64_t cards, int bestCard, int* order)
+{
+    const struct SolverState *state = &(solver->state);
+    int number = 0;
+
+    if (bestCard >= 0 && (cards >> bestCard) & 1) {
+        order[number++] = bestCard;
+        cards &= ~(UINT64_C(1) << bestCard);
+    }
+
+    if (state->cardsOnTable == 0) {
+        for (; cards != 0; cards &= ~(UINT64_C(1) << order[number - 1]))
+            order[number++] = 63 - __builtin_clzll(cards);
+        return number;
+    }
+
+    int winner;
+    if (bitboard_getSuitCards(state->table, state->trump) != 0)
+        winner = bitboard_getHighestCard(state->table, state->trump);
+    else
+        winner = bitboard_getHighestCard(state->table, state->leadSuit);
+    winner = state->owners[winner];
+
+    int maximize = (player == solver->target) == solver->maximize;
+    uint64_t good = 0;
+    for (uint64_t rest = cards; rest != 0; rest &= rest - 1) {
+        int card = __builtin_ctzll(rest);
+        int owner = solver_isWinningCard(state, card) ? player : winner;
+        if ((owner == solver->target) == maximize)
+            good |= UINT64_C(1) << card;
+    }
+
+    for (uint64_t rest = good; rest != 0; rest &= rest - 1)
+        order[number++] = __builtin_ctzll(rest);
+    for (uint64_t rest = cards & ~good; rest != 0; rest &= rest - 1)
+        order[number++] = __builtin_ctzll(rest);
+
+    return number;
+}
+
+/**
+ * @brief Function gets bounds of the number of the hands won by the target
+ *        from the start of a hand, without search. Every trump of the target
+ *        higher than all the trumps of the other players wins a hand, and
+ *        every trump of another player higher than all the trumps of the
+ *        target makes the target lose a hand (the cards of a player are put
+ *        down in different hands).
+ */
+static void solver_getBounds(const struct Solver* solver, int* lower,
+                             int* upper)
+{
+    const struct SolverState *state = &(solver->state);
+    if (state->trump == SuitEnd)
+        return;
+
+    uint64_t trumps = bitboard_getSuitCards(state->hands[solver->target],
+                                            state->trump);
+    uint64_t others = 0;
+    for (int i = 0; i < state->playersNumber; i++)
+        if (i != solver->target)
+            others |= bitboard_getSuitCards(state->hands[i], state->trump);
+
+    if (trumps != 0 && others != 0) {
+        int highest = 63 - __builtin_clzll(others);
+        *lower = bitboard_countCards(trumps >> highest);
+        highest = 63 - __builtin_clzll(trumps);
+        others = 0 - (UINT64_C(2) << highest);
+    } else {
+        *lower = bitboard_countCards(trumps);
+        others = ~UINT64_C(0);
+    }
+
+    int lost = 0;
+    for (int i = 0; i < state->playersNumber; i++) {
+        int number = bitboard_countCards(bitboard_getSuitCards(state->hands[i],
+                                         state->trump) & others);
+        if (i != solver->target && number > lost)
+            lost = number;
+    }
+    *upper -= lost;
+}
+
+/**
+ * @brief Function checks if the deadline of a solver came, it is called
+ *        every SOLVER_CLOCK_NODES positions.
+ */
+static int solver_checkDeadline(struct Solver* solver)
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    if (time.tv_sec + time.tv_nsec / 1e9 < solver->deadline)
+        return 0;
+
+    solver->nodesLimit = solver->nodesNumber;
+
+    return 1;
+}
+
+/**
+ * @brief Function checks if the searches of a solver must be stopped.
+ */
+static inline int solver_isStopped(const struct Solver* solver)
+{
+    if (solver->stop != NULL &&
+        __atomic_load_n(solver->stop, __ATOMIC_RELAXED) != 0)
+        return 1;
+
+    return solver->nodesLimit > 0 &&
+           solver->nodesNumber >= solver->nodesLimit;
+}
+
+static int solver_search(struct Solver* solver, int alpha, int beta);
+
+/**
+ * @brief Function ends the current hand: the winner starts the next hand.
+ */
+static int solver_endHand(struct Solver* solver, int alpha, int beta)
+{
+    struct SolverState *state = &(solver->state);
+
+    int card;
+    if (bitboard_getSuitCards(state->table, state->trump) != 0)
+        card = bitboard_getHighestCard(state->table, state->trump);
+    else
+        card = bitboard_getHighestCard(state->table, state->leadSuit);
+
+    uint64_t  table    = state->table;
+    int       leader   = state->leader;
+    enum Suit leadSuit = state->leadSuit;
+    int       won      = state->owners[card] == solver->target;
+
+    state->leader       = state->owners[card];
+    state->table        = 0;
+    state->cardsOnTable = 0;
+    state->leadSuit     = SuitEnd;
+
+    int value = won + solver_search(solver, alpha - won, beta - won);
+
+    state->leader       = leader;
+    state->table        = table;
+    state->cardsOnTable = state->playersNumber;
+    state->leadSuit     = leadSuit;
+
+    return value;
+}
+
+/**
+ * @brief Function searches a position with alpha-beta and returns the number
+ *        of the hands won by the target from the position (fail-soft).
+ */
+static int solver_search(struct Solver* solver, int alpha, int beta)
+{
+    struct SolverState *state = &(solver->state);
+    if (solver_isStopped(solver))
+        return alpha;
+    solver->nodesNumber++;
+    if (solver->deadline > 0 &&
+        solver->nodesNumber % SOLVER_CLOCK_NODES == 0 &&
+        solver_checkDeadline(solver))
+        return alpha;
+
+    if (state->cardsOnTable == state->playersNumber)
+        return solver_endHand(solver, alpha, beta);
+
+    int handsLeft = solver_getHandsLeft(state);
+    if (handsLeft == 0)
+        return 0;
+
+    struct SolverEntry *entry = NULL;
+    uint64_t key = 0;
+    int bestCard = -1;
+    int lower = 0;
+    int upper = handsLeft;
+
+    if (state->cardsOnTable == 0) {
+        key = solver_getKey(state) ^ solver->searchKey;
+        entry = &(solver->table[key & (SOLVER_TABLE_SIZE - 1)]);
+        if (entry->key == key) {
+            lower    = entry->lower;
+            upper    = entry->upper;
+            bestCard = entry->bestCard;
+        } else {
+            solver_getBounds(solver, &lower, &upper);
+        }
+    }
+
+    if (lower >= beta || lower == upper)
+        return lower;
+    if (upper <= alpha)
+        return upper;
+    if (lower > alpha)
+        alpha = lower;
+    if (upper < beta)
+        beta = upper;
+
+    int player = (state->leader + state->cardsOnTable) % state->playersNumber;
+    int maximize = (player == solver->target) == solver->maximize;
+
+    uint64_t cards = bitboard_getLegalCards(state->hands[player],
+                                            state->leadSuit, state->trump);
+    cards = solver_getDistinctCards(state, player, cards);
+
+    int order[MAX_CARDS];
+    int number = solver_orderCards(solver, player, cards, bestCard, order);
+
+    int windowAlpha = alpha;
+    int windowBeta  = beta;
+    int best = maximize ? -1 : handsLeft + 1;
+
+    for (int i = 0; i < number; i++) {
+        solver_putCard(state, player, order[i]);
+        int value = solver_search(solver, alpha, beta);
+        solver_takeCard(state, player, order[i]);
+
+        if (maximize) {
+            if (value > best) {
+                best     = value;
+                bestCard = order[i];
+            }
+            if (best > alpha)
+                alpha = best;
+        } else {
+            if (value < best) {
+                best     = value;
+                bestCard = order[i];
+            }
+            if (best < beta)
+                beta = best;
+        }
+        if (alpha >= beta)
+            break;
+    }
+
+    if (entry != NULL && !solver_isStopped(solver)) {
+        if (entry->key != key) {
+            entry->key   = key;
+            entry->lower = 0;
+            entry->upper = handsLeft;
+        }
+        if (best <= windowAlpha) {
+            if (best < entry->upper)
+                entry->upper = best;
+        } else if (best >= windowBeta) {
+            if (best > entry->lower)
+                entry->lower = best;
+        } else {
+            entry->lower = best;
+            entry->upper = best;
+        }
+        entry->bestCard = bestCard;
+    }
+
+    return best;
+}
+
+int solver_playCard(struct Solver* solver, int card)
+{
+    int player = solver_getPlayerToMove(solver);
+    if (player < 0)
+        return player;
+    if (card < 0 || card >= DECK_SIZE)
+        return ILLEGAL_VALUE;
+
+    struct SolverState *state = &(solver->state);
+    uint64_t cards = bitboard_getLegalCards(state->hands[player],
+                                            state->leadSuit, state->trump);
+    if (((cards >> card) & 1) == 0)
+        return ILLEGAL_VALUE;
+
+    solver_putCard(state, player, card);
+
+    return FUNCTION_NO_ERROR;
+}
+
+int solver_getHands(struct Solver* solver, int playerId, int maximize)
+{
+    if (solver == NULL)
+        return POINTER_NULL;
+    if (playerId < 0 || playerId >= solver->state.playersNumber)
+        return ILLEGAL_VALUE;
+
+    solver->target    = playerId;
+    solver->maximize  = maximize != 0;
+    solver->searchKey = zobrist_getKey(SOLVER_KEYS + 2 * playerId +
+                                       solver->maximize) ^
+                        zobrist_getKey(SOLVER_KEYS + 2 * MAX_GAME_PLAYERS +
+                                       solver->state.trump);
+
+    /* Null-window searches which narrow the bounds of the value, the
+     * transposition table keeps the work of the previous searches. */
+    int lower = 0;
+    int upper = solver_getHandsLeft(&(solver->state));
+    while (lower < upper) {
+        int middle = (lower + upper + 1) / 2;
+        int value = solver_search(solver, middle - 1, middle);
+        if (solver_isStopped(solver))
+            return LIMIT_REACHED;
+        if (value >= middle)
+            lower = value;
+        else
+            upper = value;
+    }
+
+    return lower;
+}
+
+int solver_solveRound(struct Solver* solver, const struct Round* round,
+                      struct SolverResult* result)
+{
+    if (result == NULL)
+        return POINTER_NULL;
+
+    int check = solver_loadRound(solver, round);
+    if (check != FUNCTION_NO_ERROR)
+        return check;
+
+    struct SolverState start = solver->state;
+    int player = solver_getPlayerToMove(solver);
+
+    result->playersNumber = start.playersNumber;
+    result->playerId      = player;
+
+    for (int i = 0; i < MAX_CARDS; i++) {
+        result->cardMaxHands[i] = -1;
+        result->cardMinHands[i] = -1;
+    }
+
+    for (int i = 0; i < start.playersNumber; i++) {
+        result->maxHands[i] = solver_getHands(solver, i, 1);
+        if (result->maxHands[i] < 0)
+            return result->maxHands[i];
+        result->minHands[i] = solver_getHands(solver, i, 0);
+        if (result->minHands[i] < 0)
+            return result->minHands[i];
+    }
+
+    if (player < 0)
+        return FUNCTION_NO_ERROR;
+
+    const struct Player *owner = round->players[player];
+    for (int i = 0; i < MAX_CARDS; i++) {
+        if (!deck_isCard(owner->hand[i]))
+            continue;
+        if (solver_playCard(solver, owner->hand[i].id) != FUNCTION_NO_ERROR)
+            continue;
+
+        result->cardMaxHands[i] = solver_getHands(solver, player, 1);
+        result->cardMinHands[i] = solver_getHands(solver, player, 0);
+        solver->state = start;
+        if (result->cardMaxHands[i] < 0)
+            return result->cardMaxHands[i];
+        if (result->cardMinHands[i] < 0)
+            return result->cardMinHands[i];
+    }
+
+    return FUNCTION_NO_ERROR;
+}
@@ -0,0 +1,244 @@
+/**
+ * @file solver.h
+ * @brief Solver structure, as well as the functions of the double-dummy
+ *        solver. The solver knows the cards of all the players and finds how
+ *        many hands a player can win when all the other players play against
+ *        him (alpha-beta search with a transposition table and with pruning
+ *        of the equivalent cards).
+ */
+
+#ifndef SOLVER_H
+#define SOLVER_H
+
+#include <libWhistGame.h>
+
+#include <stdint.h>
+
+/**
+ * @brief The logarithm in base 2 of the number of entries from the
+ *        transposition table of a solver.
+ */
+#define SOLVER_TABLE_BITS 18
+
+/**
+ * @brief The number of entries from the transposition table of a solver.
+ */
+#define SOLVER_TABLE_SIZE (1 << SOLVER_TABLE_BITS)
+
+/**
+ * @brief The number of the positions searched between two checks of
+ *        Solver::deadline, the clock is too slow to be read in every
+ *        position.
+ */
+#define SOLVER_CLOCK_NODES 4096
+
+/**
+ * @struct SolverEntry
+ *
+ * @brief SolverEntry structure. An entry of the transposition table, it keeps
+ *        the bounds of the value of a position from the start of a hand.
+ *
+ * @var SolverEntry::key
+ *      The key of the position.
+ * @var SolverEntry::lower
+ *      The lower bound of the number of hands won from the position.
+ * @var SolverEntry::upper
+ *      The upper bound of the number of hands won from the position.
+ * @var SolverEntry::bestCard
+ *      The card which was the best in the position or -1.
+ */
+struct SolverEntry {
+    uint64_t key;
+    signed char lower;
+    signed char upper;
+    signed char bestCard;
+};
+
+/**
+ * @struct SolverState
+ *
+ * @brief SolverState structure. The position searched by a solver. The
+ *        players have the ids from Round::players.
+ *
+ * @var SolverState::hands
+ *      The cards of each player.
+ * @var SolverState::table
+ *      The cards put down in the current hand.
+ * @var SolverState::owners
+ *      For every card from table, the id of the player which put it down.
+ * @var SolverState::playersNumber
+ *      The number of the players.
+ * @var SolverState::leader
+ *      The id of the player which put down the first card of the hand.
+ * @var SolverState::cardsOnTable
+ *      The number of the cards from table.
+ * @var SolverState::trump
+ *      The suit of the trump or SuitEnd.
+ * @var SolverState::leadSuit
+ *      The suit of the first card of the hand or SuitEnd.
+ */
+struct SolverState {
+    uint64_t hands[MAX_GAME_PLAYERS];
+    uint64_t table;
+    signed char owners[DECK_SIZE];
+    int playersNumber;
+    int leader;
+    int cardsOnTable;
+    enum Suit trump;
+    enum Suit leadSuit;
+};
+
+/**
+ * @struct Solver
+ *
+ * @brief Solver structure. A solver can be used only by a thread at a time.
+ *
+ * @var Solver::state
+ *      The position which is searched.
+ * @var Solver::target
+ *      The id of the player whose hands are counted.
+ * @var Solver::maximize
+ *      1 if the target wants to win as many hands as he can, 0 if he wants to
+ *      win as few hands as he can. The other players have the opposite goal.
+ * @var Solver::searchKey
+ *      The key which identifies the target, the goal and the trump in the
+ *      transposition table.
+ * @var Solver::nodesNumber
+ *      The number of the positions searched since the solver was created.
+ * @var Solver::nodesLimit
+ *      The value of nodesNumber at which the searches are stopped, 0 if the
+ *      searches aren't stopped.
+ * @var Solver::stop
+ *      Pointer to a flag which can be set by another thread, the searches are
+ *      stopped when it isn't 0. NULL if it isn't used.
+ * @var Solver::deadline
+ *      The time of the monotonic clock, in seconds, at which the searches are
+ *      stopped, 0 if it isn't used. When it comes, nodesLimit is set to
+ *      nodesNumber, so the searches stay stopped until nodesLimit is changed.
+ * @var Solver::table
+ *      The transposition table.
+ */
+struct Solver {
+    struct SolverState state;
+    int target;
+    int maximize;
+    uint64_t searchKey;
+    long nodesNumber;
+    long nodesLimit;
+    const int *stop;
+    double deadline;
+    struct SolverEntry table[SOLVER_TABLE_SIZE];
+};
+
+/**
+ * @struct SolverResult
+ *
+ * @brief SolverResult structure. The result of solver_solveRound(). The
+ *        numbers of hands don't include Round::handsNumber.
+ *
+ * @var SolverResult::playersNumber
+ *      The number of the players from round.
+ * @var SolverResult::playerId
+ *      The id of the player which must put down the next card.
+ * @var SolverResult::maxHands
+ *      For every player, the number of hands which he wins if he wants to win
+ *      as many hands as he can and the others play against him.
+ * @var SolverResult::minHands
+ *      For every player, the number of hands which he wins if he wants to win
+ *      as few hands as he can and the others play against him.
+ * @var SolverResult::cardMaxHands
+ *      For every card from the hand of the player which must put down the
+ *      next card, maxHands of the player after he puts down the card, -1 if
+ *      the card can't be put down.
+ * @var SolverResult::cardMinHands
+ *      Like cardMaxHands, for minHands.
+ */
+struct SolverResult {
+    int playersNumber;
+    int playerId;
+    int maxHands[MAX_GAME_PLAYERS];
+    int minHands[MAX_GAME_PLAYERS];
+    int cardMaxHands[MAX_CARDS];
+    int cardMinHands[MAX_CARDS];
+};
+
+/**
+ * @brief Function allocates and initializes a solver.
+ *
+ * @return Pointer to the new solver on success, NULL on failure.
+ */
+struct Solver *solver_createSolver();
+
+/**
+ * @brief Function releases the memory of a solver and makes the pointer NULL.
+ *
+ * @param solver Pointer to pointer to the solver which to be released.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int solver_deleteSolver(struct Solver** solver);
+
+/**
+ * @brief Function loads the cards of a round in a solver. If the round
+ *        doesn't have a hand, the first hand is started by the first player.
+ *
+ * @param solver Pointer to the solver.
+ * @param round Pointer to the round.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int solver_loadRound(struct Solver* solver, const struct Round* round);
+
+/**
+ * @brief Function gets the id of the player which must put down the next card
+ *        in the position loaded in a solver.
+ *
+ * @param solver Pointer to the solver.
+ *
+ * @return The id of the player on success, a negative value on failure.
+ */
+int solver_getPlayerToMove(const struct Solver* solver);
+
+/**
+ * @brief Function puts down a card in the position loaded in a solver.
+ *
+ * @param solver Pointer to the solver.
+ * @param card The position of the bit of the card (struct Card::id), it must
+ *             be a card which the player to move can put down.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int solver_playCard(struct Solver* solver, int card);
+
+/**
+ * @brief Function calculates how many of the remaining hands a player wins
+ *        from the position loaded in a solver.
+ *
+ * @param solver Pointer to the solver.
+ * @param playerId The id of the player in round.
+ * @param maximize 1 if the player wants to win as many hands as he can, 0 if
+ *                 he wants to win as few as he can. The other players have the
+ *                 opposite goal.
+ *
+ * @return The number of the hands on success, LIMIT_REACHED if the search
+ *         was stopped by Solver::nodesLimit, Solver::stop or
+ *         Solver::deadline, other negative value on failure.
+ */
+int solver_getHands(struct Solver* solver, int playerId, int maximize);
+
+/**
+ * @brief Function solves a round: the minimum and the maximum number of hands
+ *        of each player and the outcome of every card of the player which
+ *        must put down the next card.
+ *
+ * @param solver Pointer to the solver.
+ * @param round Pointer to the round, the cards of all the players must be
+ *              known.
+ * @param result Pointer to the structure in which is saved the result.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int solver_solveRound(struct Solver* solver, const struct Round* round,
+                      struct SolverResult* result);
+
+#endif
@@ -0,0 +1,125 @@
+/**
+ * @file world.c
+ * @brief In this file are defined the functions used for World-related
+ *        operations, these functions are declared in the header file world.h.
+ */
+
+#include "world.h"
+
+#include <stdlib.h>
+
+int world_readRound(struct World* world, const struct Round* round,
+                    int playerId)
+{
+    if (world == NULL)
+        return POINTER_NULL;
+    if (round == NULL)
+        return ROUND_NULL;
+    if (playerId < 0 || playerId >= round->playersNumber)
+        return ILLEGAL_VALUE;
+
+    enum Suit trump = deck_getCardSuit(round->trump);
+
+    struct Deck deck;
+    int check = deck_initializeDeck(&deck, round->playersNumber);
+    if (check != FUNCTION_NO_ERROR)
+        return check;
+
+    world->playersNumber = round->playersNumber;
+    world->playerId      = playerId;
+
+    uint64_t seen = bitboard_getCardMask(round->trump) |
+                    bitboard_getPlayerCards(round->players[playerId]);
+    for (int i = 0; i < MAX_GAME_PLAYERS; i++)
+        world->voids[i] = 0;
+
+    int cardsNumber = 0;
+    enum Suit leadSuit = SuitEnd;
+    for (int i = 0; i < round->movesNumber; i++) {
+        const struct RoundMove *move = &(round->moves[i]);
+        if (move->type != CARD_MOVE)
+            continue;
+
+        enum Suit suit = deck_getCardSuit(move->card);
+        if (cardsNumber % round->playersNumber == 0) {
+            leadSuit = suit;
+        } else if (suit != leadSuit) {
+            world->voids[move->playerId] |= bitboard_getSuitMask(leadSuit);
+            if (suit != trump)
+                world->voids[move->playerId] |= bitboard_getSuitMask(trump);
+        }
+
+        seen |= bitboard_getCardMask(move->card);
+        cardsNumber++;
+    }
+
+    if (round->hand != NULL)
+        for (int i = 0; i < round->hand->playersNumber; i++)
+            seen |= bitboard_getCardMask(round->hand->cards[i]);
+
+    world->unknown = bitboard_getDeckCards(&deck) & ~seen;
+
+    int number = 0;
+    for (int i = 0; i < round->playersNumber; i++) {
+        world->cardsNumber[i] = player_getCardsNumber(round->players[i]);
+        if (i == playerId)
+            continue;
+
+        int count = bitboard_countCards(world->unknown & ~world->voids[i]);
+        int j = number++;
+        while (j > 0 && bitboard_countCards(world->unknown &
+                        ~world->voids[world->order[j - 1]]) > count) {
+            world->order[j] = world->order[j - 1];
+            j--;
+        }
+        world->order[j] = i;
+    }
+
+    return FUNCTION_NO_ERROR;
+}
+
+/**
+ * @brief Function deals the cards once, it fails if a player doesn't have
+ *        enough cards from the suits which he can have.
+ */
+static int world_tryDealCards(const struct World* world, struct Random* random,
+                              uint64_t* hands, int useVoids)
+{
+    uint64_t rest = world->unknown;
+
+    for (int i = 0; i < world->playersNumber - 1; i++) {
+        int playerId = world->order[i];
+        uint64_t cards = rest;
+        if (useVoids)
+            cards &= ~world->voids[playerId];
+
+        int count = bitboard_countCards(cards);
+        if (count < world->cardsNumber[playerId])
+            return NOT_FOUND;
+
+        hands[playerId] = 0;
+        for (int j = 0; j < world->cardsNumber[playerId]; j++) {
+            int card = world_getCard(cards,
+                                     random_getBoundedNumber(random, count--));
+            uint64_t mask = UINT64_C(1) << card;
+            hands[playerId] |= mask;
+            cards &= ~mask;
+            rest  &= ~mask;
+        }
+    }
+
+    return FUNCTION_NO_ERROR;
+}
+
+int world_dealCards(const struct World* world, struct Random* random,
+                    uint64_t* hands)
+{
+    if (world == NULL || random == NULL || hands == NULL)
+        return POINTER_NULL;
+
+    for (int i = 0; i < WORLD_DEAL_ATTEMPTS; i++)
+        if (world_tryDealCards(world, random, hands, 1) == FUNCTION_NO_ERROR)
+            return FUNCTION_NO_ERROR;
+
+    return world_tryDealCards(world, random, hands, 0);
+}
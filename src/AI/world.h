@@ -0,0 +1,99 @@
+/**
+ * @file world.h
+ * @brief World structure, as well as helper functions. A world is what a
+ *        player knows about the cards of a round, from which can be dealt the
+ *        cards which he doesn't see, in the same way with what he saw.
+ */
+
+#ifndef WORLD_H
+#define WORLD_H
+
+#include <libWhistGame.h>
+
+#include <stdint.h>
+
+/**
+ * @brief The number of times which is tried to deal the cards so that the
+ *        players don't get the suits which they showed that they don't
+ *        have, before this condition is ignored.
+ */
+#define WORLD_DEAL_ATTEMPTS 32
+
+/**
+ * @struct World
+ *
+ * @brief World structure. The players have the ids from Round::players.
+ *
+ * @var World::playersNumber
+ *      The number of the players.
+ * @var World::playerId
+ *      The id of the player who knows the world.
+ * @var World::unknown
+ *      The cards which the player doesn't see: the cards of the other players
+ *      and the cards which weren't distributed.
+ * @var World::voids
+ *      For every player, the suits which he doesn't have anymore (as masks).
+ * @var World::cardsNumber
+ *      The number of the cards of every player.
+ * @var World::order
+ *      The ids of the other players, in the order in which they get cards
+ *      (the players with fewer possible cards first).
+ */
+struct World {
+    int playersNumber;
+    int playerId;
+    uint64_t unknown;
+    uint64_t voids[MAX_GAME_PLAYERS];
+    int cardsNumber[MAX_GAME_PLAYERS];
+    int order[MAX_GAME_PLAYERS];
+};
+
+/**
+ * @brief Function gets the card which has the bit on the position index among
+ *        the bits of a bitboard.
+ *
+ * @param cards The bitboard, it must have more than index bits.
+ * @param index The position of the card among the cards of the bitboard.
+ *
+ * @return The position of the bit of the card.
+ */
+static inline int world_getCard(uint64_t cards, int index)
+{
+    while (index-- > 0)
+        cards &= cards - 1;
+
+    return __builtin_ctzll(cards);
+}
+
+/**
+ * @brief Function finds what a player saw in a round: the cards which he
+ *        doesn't see anymore and the suits which the other players don't
+ *        have anymore (a player which doesn't follow the suit of the hand
+ *        doesn't have that suit and, if he doesn't put down a trump, neither
+ *        trumps). The cards already played are read from Round::moves.
+ *
+ * @param world Pointer to the world which is initialized.
+ * @param round Pointer to the round.
+ * @param playerId The id in round of the player.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int world_readRound(struct World* world, const struct Round* round,
+                    int playerId);
+
+/**
+ * @brief Function deals the cards which the player doesn't see to the other
+ *        players. The suits which the players don't have are kept if it is
+ *        possible in WORLD_DEAL_ATTEMPTS attempts.
+ *
+ * @param world Pointer to the world.
+ * @param random Pointer to the generator used to deal the cards.
+ * @param hands The cards of the players, the cards of the other players are
+ *              replaced.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int world_dealCards(const struct World* world, struct Random* random,
+                    uint64_t* hands);
+
+#endif
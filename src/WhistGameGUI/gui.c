@@ -4,13 +4,8 @@
  */
 
 #include <string.h>
-#ifdef WIN32
-#include <Windows.h>
-#include <unistd.h>
-#endif
 
 #include "gui.h"
-#include "resources.h"
 
 #define square(a) (a) * (a)
 
@@ -66,9 +61,10 @@ int gui_init(GtkWidget **window, GtkWidget **fixed, char *title,
     gtk_window_set_position(GTK_WINDOW(*window), GTK_WIN_POS_CENTER);
     gtk_window_set_title(GTK_WINDOW(*window), title);
 
-    GError *error;
-    gtk_window_set_icon_from_file(GTK_WINDOW(*window),
-                                  "pictures/logo_game.png", &error);
+    GdkPixbuf *icon = gui_pixbufNewFromFile("pictures/logo_game.png");
+    gtk_window_set_icon(GTK_WINDOW(*window), icon);
+    if (icon != NULL)
+        g_object_unref(icon);
 
     *fixed = gtk_fixed_new();
     gtk_container_add(GTK_CONTAINER(*window), *fixed);
@@ -320,15 +316,15 @@ int gui_createButtonShowScore(GtkWidget *fixed, GtkWidget **showScore,
     return FUNCTION_NO_ERROR;
 }
 
-int gui_getPictureName(struct Card *card, char *name)
+int gui_getPictureName(struct Card card, char *name)
 {
-    if (card == NULL)
+    if (!deck_isCard(card))
         return CARD_NULL;
     if (name == NULL)
         return POINTER_NULL;
 
     char suit[2] = {'\0'};
-    switch(card->suit) {
+    switch(deck_getCardSuit(card)) {
         case DIAMONDS:
             suit[0] = 'D';
             break;
@@ -345,11 +341,12 @@ int gui_getPictureName(struct Card *card, char *name)
             break;
         }
     char value[4] = {'\0'};
-    if (card->value > 9) {
-        value[0] = (char)(((int)'0') + card->value / 10);
-        value[1] = (char)(((int)'0') + card->value % 10);
+    int cardValue = deck_getCardValue(card);
+    if (cardValue > 9) {
+        value[0] = (char)(((int)'0') + cardValue / 10);
+        value[1] = (char)(((int)'0') + cardValue % 10);
     } else {
-        value[0] = (char)(((int)'0') + card->value);
+        value[0] = (char)(((int)'0') + cardValue);
     }
     strcpy(name, value);
     strcat(name, suit);
@@ -358,45 +355,60 @@ int gui_getPictureName(struct Card *card, char *name)
     return FUNCTION_NO_ERROR;
 }
 
-int gui_initTrump(GtkWidget *fixed, GtkWidget **image)
+int gui_getCardPath(struct Card card, enum CardSize size, char *path)
 {
-    if (fixed == NULL || image == NULL)
+    if (path == NULL)
         return POINTER_NULL;
+    if (size < SMALL_CARD || size >= CardSizeEnd)
+        return ILLEGAL_VALUE;
 
-    *image = gtk_image_new();
-    gtk_fixed_put(GTK_FIXED(fixed), *image, 45, 15);
+    const char *sizeName = size == SMALL_CARD ? "45x60" : "80x110";
+    strcpy(path, "pictures/");
+    strcat(path, sizeName);
+    strcat(path, "/");
+    if (!deck_isCard(card)) {
+        strcat(path, sizeName);
+        strcat(path, ".jpg");
+        return FUNCTION_NO_ERROR;
+    }
+
+    char pictureName[10] = { '\0' };
+    int check = gui_getPictureName(card, pictureName);
+    if (check != FUNCTION_NO_ERROR)
+        return check;
+    strcat(path, pictureName);
 
     return FUNCTION_NO_ERROR;
 }
 
-int gui_hideTrump(GtkWidget *image)
+int gui_initTrump(struct TableRenderer *renderer, int *slot)
 {
-    if (image == NULL)
+    if (renderer == NULL || slot == NULL)
         return POINTER_NULL;
 
-    gtk_widget_hide(image);
+    *slot = gui_addTableSlot(renderer, 45, 15);
+    if (*slot < 0)
+        return *slot;
 
-    return 0;
+    return FUNCTION_NO_ERROR;
 }
 
-int gui_showTrump(struct Card *trump, GtkWidget *image)
+int gui_hideTrump(struct TableRenderer *renderer, int slot)
 {
-    if (image == NULL)
+    if (renderer == NULL)
         return POINTER_NULL;
 
-    char pathTrump[30] = "pictures/45x60/";
-    if (trump == NULL)
-        strcat(pathTrump, "45x60.jpg");
-    else {
-        char pictureName[8] = {0};
-        gui_getPictureName(trump, pictureName);
-        strcat(pathTrump, pictureName);
-    }
+    gui_hideTableSlot(renderer, slot);
 
-    gui_imageSetFromFile(image, pathTrump);
-    gtk_widget_show(image);
+    return 0;
+}
 
-    return FUNCTION_NO_ERROR;
+int gui_showTrump(struct Card trump, struct TableRenderer *renderer, int slot)
+{
+    if (renderer == NULL)
+        return POINTER_NULL;
+
+    return gui_setTableCard(renderer, slot, trump, SMALL_CARD);
 }
 
 int gui_deletePlayerCards(struct PlayerCards **playerCards)
@@ -410,18 +422,16 @@ int gui_deletePlayerCards(struct PlayerCards **playerCards)
     return FUNCTION_NO_ERROR;
 }
 
-struct PlayerCards *gui_initializePlayerCards(GtkWidget *fixed)
+struct PlayerCards *gui_initializePlayerCards(struct TableRenderer *renderer)
 {
-    if (fixed == NULL)
+    if (renderer == NULL)
         return NULL;
 
     struct PlayerCards *playerCards = malloc(sizeof(struct PlayerCards));
 
-    for (int i = 0; i < MAX_CARDS; i++) {
-        playerCards->images[i] = gtk_image_new();
-        gtk_fixed_put(GTK_FIXED(fixed), playerCards->images[i],
-                      10 + i * 90, 400);
-    }
+    playerCards->renderer = renderer;
+    for (int i = 0; i < MAX_CARDS; i++)
+        playerCards->slots[i] = gui_addTableSlot(renderer, 10 + i * 90, 400);
 
     return playerCards;
 }
@@ -432,7 +442,7 @@ int gui_hidePlayerCards(struct PlayerCards *playerCards)
         return POINTER_NULL;
 
     for (int i = 0; i < MAX_CARDS; i++) {
-        gtk_widget_hide(playerCards->images[i]);
+        gui_hideTableSlot(playerCards->renderer, playerCards->slots[i]);
     }
 
     return 0;
@@ -447,16 +457,17 @@ int gui_showPlayerCards(struct PlayerCards *playerCards, struct Player *player)
 
     int noOfCards = 0;
     for (int i = 0; i < MAX_CARDS; i++)
-        if (player->hand[i] != NULL) {
-            char pictureName[10] = { '\0' };
-            gui_getPictureName(player->hand[i], pictureName);
-            char pathImage [30] = "pictures/80x110/";
-            strcat(pathImage, pictureName);
-            gui_imageSetFromFile(playerCards->images[noOfCards], pathImage);
-            gtk_widget_show(playerCards->images[noOfCards]);
+        if (deck_isCard(player->hand[i])) {
+            gui_setTableCard(playerCards->renderer,
+                             playerCards->slots[noOfCards], player->hand[i],
+                             BIG_CARD);
             noOfCards++;
         }
 
+    /* Only the cards which were moved and the last slot are drawn again. */
+    for (int i = noOfCards; i < MAX_CARDS; i++)
+        gui_hideTableSlot(playerCards->renderer, playerCards->slots[i]);
+
     return FUNCTION_NO_ERROR;
 }
 
@@ -576,11 +587,11 @@ int gui_clickMouseOnCard(struct GameGUI *gameGUI, int x, int y)
         gui_hideLimitTimeGUI(gameGUI->limitTimeGUI);
         (gameGUI->cardPlayerId)++;
 
-        hand_addCard(round->hand, player, &(player->hand[position]));
+        round_playCard(round, player, position);
         gui_showCardsOnTable(gameGUI->cardsFromTable, game);
-        gui_hidePlayerCards(gameGUI->playerCards);
         gui_showPlayerCards(gameGUI->playerCards, player);
-        gtk_widget_hide(gameGUI->select->imageSelectedCard);
+        gui_hideTableSlot(gameGUI->renderer,
+                          gameGUI->select->slotSelectedCard);
         gui_showPlayerTurn(gameGUI, gameGUI->cardPlayerId);
 
         if (gameGUI->cardPlayerId == game->playersNumber)
@@ -621,7 +632,8 @@ int gui_clickMouseOnBid(struct GameGUI *gameGUI, int x, int y)
                        gameGUI->select->player, bidValue);
 
         gui_hideBidGUI(gameGUI->bidGUI);
-        gtk_widget_hide(gameGUI->select->imageSelectedBid);
+        gui_hideTableSlot(gameGUI->renderer,
+                          gameGUI->select->slotSelectedBid);
 
         gui_showInformationsPlayers(gameGUI->playersGUI, gameGUI->game);
         gui_setNoOfBids(gameGUI->labelNoOfBids,
@@ -653,27 +665,22 @@ int gui_clickMouse(GtkWidget *window, GdkEvent *event, struct GameGUI *gameGUI)
     return FUNCTION_NO_ERROR;
 }
 
-struct Select *gui_createSelect(GtkWidget *fixed, struct Player *player,
-                                struct Game *game)
+struct Select *gui_createSelect(struct TableRenderer *renderer,
+                                struct Player *player, struct Game *game)
 {
-    if (player == NULL || fixed == NULL || game == NULL)
+    if (player == NULL || renderer == NULL || game == NULL)
         return NULL;
 
     struct Select *select;
 
     select = malloc(sizeof(struct Select));
-    select->imageSelectedCard = gui_imageNewFromFile
-                                ("pictures/select_card.png");
-    select->imageSelectedBid = gui_imageNewFromFile
-                               ("pictures/select_bid.png");
-    select->fixed          = fixed;
-    select->player         = player;
-    select->game           = game;
-    select->cardPlayerTurn = 0;
-    select->bidPlayerTurn  = 0;
-
-    gtk_fixed_put(GTK_FIXED(fixed), select->imageSelectedCard, 10, 400);
-    gtk_fixed_put(GTK_FIXED(fixed), select->imageSelectedBid, 304, 253);
+    select->slotSelectedCard = gui_addTableSlot(renderer, 10, 400);
+    select->slotSelectedBid  = gui_addTableSlot(renderer, 304, 254);
+    select->renderer         = renderer;
+    select->player           = player;
+    select->game             = game;
+    select->cardPlayerTurn   = 0;
+    select->bidPlayerTurn    = 0;
 
     return select;
 }
@@ -684,19 +691,22 @@ int gui_selectedCard(struct Select *select)
         return POINTER_NULL;
     if (select->player == NULL)
         return PLAYER_NULL;
-    if (select->fixed == NULL || select->imageSelectedCard == NULL)
+    if (select->renderer == NULL)
         return POINTER_NULL;
 
+    /* The slot isn't changed while the mouse moves over the same card, so
+     * nothing is drawn again. */
     int cardId = gui_getCardId(select->x, select->y);
     int position = player_getIdNumberthCardWhichIsNotNull(select->player,
                                                           cardId + 1);
-    if (position >= 0 && select->player->hand[position] != NULL &&
+    if (position >= 0 && deck_isCard(select->player->hand[position]) &&
         select->cardPlayerTurn == 1) {
-        gtk_fixed_move(GTK_FIXED(select->fixed), select->imageSelectedCard,
-                       10 + 90 * cardId, 400);
-        gtk_widget_show(select->imageSelectedCard);
+        gui_moveTableSlot(select->renderer, select->slotSelectedCard,
+                          10 + 90 * cardId, 400);
+        gui_setTableSprite(select->renderer, select->slotSelectedCard,
+                           SELECTED_CARD_SPRITE, 1);
     } else {
-        gtk_widget_hide(select->imageSelectedCard);
+        gui_hideTableSlot(select->renderer, select->slotSelectedCard);
     }
 
     return FUNCTION_NO_ERROR;
@@ -720,9 +730,10 @@ struct PlayersGUI *gui_createPlayersGUI()
 {
     struct PlayersGUI *playersGUI = malloc(sizeof(struct PlayersGUI));
 
+    playersGUI->renderer = NULL;
     for (int i = 0; i < MAX_GAME_PLAYERS; i++) {
-        playersGUI->rewardImage[i] = NULL;
-        playersGUI->image[i]       = NULL;
+        playersGUI->rewardSlots[i] = -1;
+        playersGUI->slots[i]       = -1;
         playersGUI->nameLabel[i]   = NULL;
         playersGUI->bidsLabel[i]   = NULL;
         playersGUI->tookLabel[i]   = NULL;
@@ -733,9 +744,11 @@ struct PlayersGUI *gui_createPlayersGUI()
 }
 
 int gui_showPlayers(struct Game *game, GtkWidget *fixed,
+                    struct TableRenderer *renderer,
                     struct PlayersGUI *playersGUI)
 {
-    if (game == NULL || fixed == NULL || playersGUI == NULL)
+    if (game == NULL || fixed == NULL || renderer == NULL ||
+        playersGUI == NULL)
         return POINTER_NULL;
 
     int coordinates[MAX_GAME_PLAYERS][2] = { {25 ,275},
@@ -745,13 +758,14 @@ int gui_showPlayers(struct Game *game, GtkWidget *fixed,
                                              {625 ,145},
                                              {625 ,275} };
 
+    playersGUI->renderer = renderer;
     for (int i = 0; i < MAX_GAME_PLAYERS; i++) {
         if (game->players[i] != NULL) {
-            playersGUI->image[i] = gui_imageNewFromFile
-                                   ("pictures/player.png");
-            gtk_fixed_put(GTK_FIXED(fixed), playersGUI->image[i],
-                          coordinates[i][0], coordinates[i][1]);
-            gtk_widget_show(playersGUI->image[i]);
+            playersGUI->slots[i] = gui_addTableSlot(renderer,
+                                                    coordinates[i][0],
+                                                    coordinates[i][1]);
+            gui_setTableSprite(renderer, playersGUI->slots[i],
+                               PLAYER_SPRITE, 1);
 
             playersGUI->nameLabel[i] = gtk_label_new(game->players[i]->name);
             gtk_fixed_put(GTK_FIXED(fixed), playersGUI->nameLabel[i],
@@ -773,9 +787,9 @@ int gui_showPlayers(struct Game *game, GtkWidget *fixed,
                           coordinates[i][0] + 53, coordinates[i][1] + 28);
             gtk_widget_show(playersGUI->scoreLabel[i]);
 
-            playersGUI->rewardImage[i] = gtk_image_new();
-            gtk_fixed_put(GTK_FIXED(fixed), playersGUI->rewardImage[i],
-                          coordinates[i][0] + 100, coordinates[i][1] + 16);
+            playersGUI->rewardSlots[i] = gui_addTableSlot(renderer,
+                                                    coordinates[i][0] + 100,
+                                                    coordinates[i][1] + 16);
         }
     }
 
@@ -821,8 +835,9 @@ struct CardsFromTable *gui_createCardsFromTable()
     struct CardsFromTable *cardsFromTable;
     cardsFromTable = malloc(sizeof(struct CardsFromTable));
 
+    cardsFromTable->renderer = NULL;
     for (int i = 0; i < MAX_GAME_PLAYERS; i++) {
-        cardsFromTable->images[i] = NULL;
+        cardsFromTable->slots[i] = -1;
     }
 
     return cardsFromTable;
@@ -840,9 +855,9 @@ int gui_deleteCardsFromTable(struct CardsFromTable **cardsFromTable)
 }
 
 int gui_initCardsFromTable(struct CardsFromTable *cardsFromTable,
-                           GtkWidget *fixed)
+                           struct TableRenderer *renderer)
 {
-    if (cardsFromTable == NULL || fixed == NULL)
+    if (cardsFromTable == NULL || renderer == NULL)
         return POINTER_NULL;
 
     int coordinates[MAX_GAME_PLAYERS][2] = { {210, 295},
@@ -852,10 +867,13 @@ int gui_initCardsFromTable(struct CardsFromTable *cardsFromTable,
                                              {545, 165},
                                              {545, 295} };
 
+    cardsFromTable->renderer = renderer;
     for (int i = 0; i < MAX_GAME_PLAYERS; i++) {
-        cardsFromTable->images[i] = gtk_image_new();
-        gtk_fixed_put(GTK_FIXED(fixed), cardsFromTable->images[i],
-                      coordinates[i][0], coordinates[i][1]);
+        cardsFromTable->slots[i] = gui_addTableSlot(renderer,
+                                                    coordinates[i][0],
+                                                    coordinates[i][1]);
+        if (cardsFromTable->slots[i] < 0)
+            return cardsFromTable->slots[i];
     }
 
     return FUNCTION_NO_ERROR;
@@ -867,7 +885,7 @@ int gui_hideCardsFromTable(struct CardsFromTable *cardsFromTable)
         return POINTER_NULL;
 
     for (int i = 0; i < MAX_GAME_PLAYERS; i++) {
-        gtk_widget_hide(cardsFromTable->images[i]);
+        gui_hideTableSlot(cardsFromTable->renderer, cardsFromTable->slots[i]);
     }
 
     return FUNCTION_NO_ERROR;
@@ -890,14 +908,10 @@ int gui_showCardsOnTable(struct CardsFromTable *cardsFromTable,
             int position = hand_getPlayerId(hand, game->players[i]);
             if (position < 0)
                 return position;
-            if (hand->cards[position] != NULL) {
-                char pictureName[10] = { '\0' };
-                gui_getPictureName(hand->cards[position], pictureName);
-                char pathImage [30] = "pictures/45x60/";
-                strcat(pathImage, pictureName);
-                gui_imageSetFromFile(cardsFromTable->images[i], pathImage);
-                gtk_widget_show(cardsFromTable->images[i]);
-            }
+            if (deck_isCard(hand->cards[position]))
+                gui_setTableCard(cardsFromTable->renderer,
+                                 cardsFromTable->slots[i],
+                                 hand->cards[position], SMALL_CARD);
         }
 
     return FUNCTION_NO_ERROR;
@@ -1000,7 +1014,8 @@ struct BidGUI *gui_createBidGUI()
 {
     struct BidGUI *bidGUI = malloc(sizeof(struct BidGUI));
 
-    bidGUI->image = NULL;
+    bidGUI->renderer = NULL;
+    bidGUI->slot     = -1;
 
     for (int i = 0; i < MAX_CARDS + 1; i++)
         bidGUI->label[i] = NULL;
@@ -1019,13 +1034,14 @@ int gui_deleteBidGUI(struct BidGUI **bidGUI)
     return FUNCTION_NO_ERROR;
 }
 
-int gui_initBidGUI(struct BidGUI *bidGUI, GtkWidget *fixed)
+int gui_initBidGUI(struct BidGUI *bidGUI, GtkWidget *fixed,
+                   struct TableRenderer *renderer)
 {
-    if (bidGUI == NULL || fixed == NULL)
+    if (bidGUI == NULL || fixed == NULL || renderer == NULL)
         return POINTER_NULL;
 
-    bidGUI->image = gui_imageNewFromFile("pictures/bid.png");
-    gtk_fixed_put(GTK_FIXED(fixed), bidGUI->image, 250, 235);
+    bidGUI->renderer = renderer;
+    bidGUI->slot     = gui_addTableSlot(renderer, 250, 235);
 
     for (int i = 0; i < MAX_CARDS + 1; i++) {
         char bid[2] = { '\0' };
@@ -1047,7 +1063,7 @@ int gui_showBidGUI(struct BidGUI *bidGUI, struct Round *round,
     if (bidGUI == NULL)
         return POINTER_NULL;
 
-    gtk_widget_show(bidGUI->image);
+    gui_setTableSprite(bidGUI->renderer, bidGUI->slot, BID_SPRITE, 1);
 
     GdkColor color;
     for (int i = 0; i < MAX_CARDS + 1; i++) {
@@ -1093,7 +1109,7 @@ int gui_selectedBid(struct Select *select)
         return ILLEGAL_VALUE;
     if (select->game->rounds[select->game->currentRound] == NULL)
         return ROUND_NULL;
-    if (select->fixed == NULL || select->imageSelectedBid == NULL)
+    if (select->renderer == NULL)
         return POINTER_NULL;
 
     int bidValue = gui_getBidValue(select->x, select->y);
@@ -1103,11 +1119,12 @@ int gui_selectedBid(struct Select *select)
 
     if (select->bidPlayerTurn == 1 &&
         bidValue >= 0 && check == 0) {
-        gtk_fixed_move(GTK_FIXED(select->fixed), select->imageSelectedBid,
-                       304 + bidValue * 20, 254);
-        gtk_widget_show(select->imageSelectedBid);
+        gui_moveTableSlot(select->renderer, select->slotSelectedBid,
+                          304 + bidValue * 20, 254);
+        gui_setTableSprite(select->renderer, select->slotSelectedBid,
+                           SELECTED_BID_SPRITE, 1);
     } else {
-        gtk_widget_hide(select->imageSelectedBid);
+        gui_hideTableSlot(select->renderer, select->slotSelectedBid);
     }
 
     return FUNCTION_NO_ERROR;
@@ -1118,7 +1135,7 @@ int gui_hideBidGUI(struct BidGUI *bidGUI)
     if (bidGUI == NULL)
         return POINTER_NULL;
 
-    gtk_widget_hide(bidGUI->image);
+    gui_hideTableSlot(bidGUI->renderer, bidGUI->slot);
 
     for (int i = 0; i < MAX_CARDS + 1; i++)
         gtk_widget_hide(bidGUI->label[i]);
@@ -1165,14 +1182,18 @@ struct GameGUI *gui_createGameGUI()
     gameGUI->bidGUI          = NULL;
     gameGUI->cardsFromTable  = NULL;
     gameGUI->limitTimeGUI    = NULL;
+    gameGUI->renderer        = NULL;
     gameGUI->windowTable     = NULL;
     gameGUI->fixedTable      = NULL;
     gameGUI->buttonShowScore = NULL;
-    gameGUI->imageTrump      = NULL;
     gameGUI->labelRoundType  = NULL;
     gameGUI->labelNoOfBids   = NULL;
     gameGUI->buttonStart     = NULL;
-    gameGUI->imagePlayerTurn = NULL;
+    gameGUI->slotTrump       = -1;
+    gameGUI->slotPlayerTurn  = -1;
+    gameGUI->botPool         = g_thread_pool_new(gui_thinkBot, NULL,
+                                                 BOT_THREADS, FALSE, NULL);
+    gameGUI->botCancellable  = g_cancellable_new();
     gameGUI->noOfGames       = NULL;
     gameGUI->bidPlayerId     = 0;
     gameGUI->cardPlayerId    = 0;
@@ -1185,6 +1206,13 @@ int gui_deleteGameGUI(struct GameGUI **gameGUI)
     if (gameGUI == NULL || *gameGUI == NULL)
         return POINTER_NULL;
 
+    /* The robot which thinks now finishes on its copy of the game and its
+     * result is dropped. */
+    g_cancellable_cancel((*gameGUI)->botCancellable);
+    if ((*gameGUI)->botPool != NULL)
+        g_thread_pool_free((*gameGUI)->botPool, FALSE, FALSE);
+    g_object_unref((*gameGUI)->botCancellable);
+
     game_deleteGame(&((*gameGUI)->game));
     gui_deleteSelect(&((*gameGUI)->select));
     gui_deletePlayerCards(&((*gameGUI)->playerCards));
@@ -1192,6 +1220,7 @@ int gui_deleteGameGUI(struct GameGUI **gameGUI)
     gui_deleteBidGUI(&((*gameGUI)->bidGUI));
     gui_deleteCardsFromTable(&((*gameGUI)->cardsFromTable));
     gui_deleteLimitTimeGUI(&((*gameGUI)->limitTimeGUI));
+    gui_deleteTableRenderer(&((*gameGUI)->renderer));
 
     free(*gameGUI);
     *gameGUI = NULL;
@@ -1205,8 +1234,9 @@ int gui_hideRewardImages(struct PlayersGUI* playersGUI)
         return POINTER_NULL;
 
     for (int i = 0; i < MAX_GAME_PLAYERS; i++)
-        if (playersGUI->rewardImage[i] != NULL)
-            gtk_widget_hide(playersGUI->rewardImage[i]);
+        if (playersGUI->rewardSlots[i] >= 0)
+            gui_hideTableSlot(playersGUI->renderer,
+                              playersGUI->rewardSlots[i]);
 
     return FUNCTION_NO_ERROR;
 }
@@ -1219,10 +1249,9 @@ int gui_startRound(struct GameGUI *gameGUI)
         return GAME_NULL;
 
     int roundId = ++(gameGUI->game->currentRound);
-    int playersNumber = gameGUI->game->playersNumber;
     struct Game *game = gameGUI->game;
 
-    if (roundId < 12 + playersNumber * 3) {
+    if (roundId < game_getRoundsNumber(game)) {
         if (roundId > 0)
             round_copyScore(game->rounds[roundId - 1], game->rounds[roundId]);
 
@@ -1232,31 +1261,29 @@ int gui_startRound(struct GameGUI *gameGUI)
             int rewardType = game_checkIfPlayerIsAtReward(game,
                                                           game->currentRound,
                                                           game->players[i]);
-            if (rewardType == 1) {
-                gui_imageSetFromFile(gameGUI->playersGUI->rewardImage[i],
-                                     "pictures/positive_reward.png");
-                gtk_widget_show(gameGUI->playersGUI->rewardImage[i]);
-            }
-            if (rewardType == 2) {
-                gui_imageSetFromFile(gameGUI->playersGUI->rewardImage[i],
-                                     "pictures/negative_reward.png");
-                gtk_widget_show(gameGUI->playersGUI->rewardImage[i]);
-            }
+            if (rewardType == 1)
+                gui_setTableSprite(gameGUI->renderer,
+                                   gameGUI->playersGUI->rewardSlots[i],
+                                   POSITIVE_REWARD_SPRITE, 1);
+            if (rewardType == 2)
+                gui_setTableSprite(gameGUI->renderer,
+                                   gameGUI->playersGUI->rewardSlots[i],
+                                   NEGATIVE_REWARD_SPRITE, 1);
         }
 
 
-        deck_deleteDeck(&(game->deck));
-        game->deck = deck_createDeck(playersNumber);
-        deck_shuffleDeck(game->deck);
+        game_initializeDeck(game);
+        game_shuffleDeck(game);
         round_distributeDeck(game->rounds[roundId], game->deck);
 
-        gui_showTrump(game->rounds[roundId]->trump, gameGUI->imageTrump);
+        gui_showTrump(game->rounds[roundId]->trump, gameGUI->renderer,
+                      gameGUI->slotTrump);
 
         gui_setRoundType(gameGUI->labelRoundType, game->rounds[roundId]);
         gui_setNoOfBids(gameGUI->labelNoOfBids, game->rounds[roundId]);
 
         qsort(game->players[0]->hand, game->rounds[roundId]->roundType,
-              sizeof(struct Card*), player_compareCards);
+              sizeof(struct Card), player_compareCards);
         gui_showPlayerCards(gameGUI->playerCards, game->players[0]);
 
         gameGUI->bidPlayerId = 0;
@@ -1296,8 +1323,7 @@ int gui_startHand(struct GameGUI *gameGUI, int winnerPlayerId)
     struct Game *game = gameGUI->game;
     int roundId = gameGUI->game->currentRound;
 
-    hand_deleteHand(&(game->rounds[roundId]->hand));
-    game->rounds[roundId]->hand = hand_createHand();
+    round_initializeHand(game->rounds[roundId]);
     round_addPlayersInHand(game->rounds[roundId], winnerPlayerId);
 
     gameGUI->cardPlayerId = 0;
@@ -1337,7 +1363,7 @@ gboolean gui_endHand(gpointer unused)
 
     player = round_getPlayerWhichWonHand(round);
     int playerId = round_getPlayerId(round, player);
-    round->handsNumber[playerId] += 1;
+    round_addWonHand(round, playerId);
 
     gui_hideCardsFromTable(gameGUI->cardsFromTable);
     gui_showInformationsPlayers(gameGUI->playersGUI, game);
@@ -1358,21 +1384,150 @@ gboolean gui_endHand(gpointer unused)
     return FALSE;
 }
 
-gboolean gui_botChooseBid(gpointer unused)
+struct BotJob *gui_createBotJob(struct GameGUI *gameGUI,
+                                enum BotDecision decision)
+{
+    if (gameGUI == NULL || gameGUI->game == NULL)
+        return NULL;
+    if (gameGUI->game->currentRound < 0 ||
+        gameGUI->game->currentRound >= MAX_GAME_ROUNDS)
+        return NULL;
+
+    struct Round *round = gameGUI->game->rounds[gameGUI->game->currentRound];
+    struct Player *player = NULL;
+
+    if (decision == BOT_BID && gameGUI->bidPlayerId < round->playersNumber)
+        player = round->players[gameGUI->bidPlayerId];
+    if (decision == BOT_CARD && round->hand != NULL &&
+        gameGUI->cardPlayerId < round->playersNumber)
+        player = round->hand->players[gameGUI->cardPlayerId];
+    if (player == NULL)
+        return NULL;
+
+    struct BotJob *job = malloc(sizeof(struct BotJob));
+    if (job == NULL)
+        return NULL;
+
+    /* The robot thinks on a copy of the game, so the game can be changed or
+     * released while the robot thinks. */
+    job->game = game_cloneGame(gameGUI->game);
+    if (job->game == NULL) {
+        free(job);
+        return NULL;
+    }
+
+    job->decision    = decision;
+    job->roundId     = gameGUI->game->currentRound;
+    job->playerId    = game_getPlayerPosition(gameGUI->game, player);
+    job->result      = ILLEGAL_VALUE;
+    job->cancellable = g_object_ref(gameGUI->botCancellable);
+
+    return job;
+}
+
+int gui_deleteBotJob(struct BotJob **job)
+{
+    if (job == NULL || *job == NULL)
+        return POINTER_NULL;
+
+    game_deleteGame(&((*job)->game));
+    g_object_unref((*job)->cancellable);
+
+    free(*job);
+    *job = NULL;
+
+    return FUNCTION_NO_ERROR;
+}
+
+void gui_thinkBot(gpointer data, gpointer unused)
 {
+    struct BotJob *job = data;
+
+    if (!g_cancellable_is_cancelled(job->cancellable) && job->playerId >= 0) {
+        struct Round *round = job->game->rounds[job->roundId];
+        struct Player *player = job->game->players[job->playerId];
+
+        if (job->decision == BOT_BID)
+            job->result = bidtable_getBid(gui_getBidTable(), player, round);
+        else
+            job->result = robot_getCardId(player, round);
+    }
+
+    g_idle_add(gui_finishBotJob, job);
+}
+
+gboolean gui_finishBotJob(gpointer data)
+{
+    struct BotJob *job = data;
     struct GameGUI *gameGUI = gui_getGameGUI();
+
+    /* The result is dropped if the table was closed or if the game isn't
+     * anymore at the move for which the robot was asked. If the robot
+     * failed on its copy of the game, it thinks again in the main loop, so
+     * the game doesn't wait for a move which never comes. */
+    if (!g_cancellable_is_cancelled(job->cancellable) && gameGUI != NULL &&
+        gameGUI->game != NULL && job->roundId == gameGUI->game->currentRound) {
+        struct Round *round = gameGUI->game->rounds[job->roundId];
+        struct Player *player = gameGUI->game->players[job->playerId];
+
+        if (job->decision == BOT_BID &&
+            gameGUI->bidPlayerId < round->playersNumber &&
+            round->players[gameGUI->bidPlayerId] == player) {
+            int bid = job->result;
+            if (bid < 0)
+                bid = bidtable_getBid(gui_getBidTable(), player, round);
+            if (bid >= 0)
+                gui_placeBotBid(gameGUI, bid);
+        }
+
+        if (job->decision == BOT_CARD && round->hand != NULL &&
+            gameGUI->cardPlayerId < round->playersNumber &&
+            round->hand->players[gameGUI->cardPlayerId] == player) {
+            int cardId = job->result;
+            if (cardId < 0)
+                cardId = robot_getCardId(player, round);
+            if (cardId >= 0)
+                gui_playBotCard(gameGUI, cardId);
+        }
+    }
+
+    gui_deleteBotJob(&job);
+
+    return FALSE;
+}
+
+int gui_startBotJob(struct GameGUI *gameGUI, enum BotDecision decision)
+{
     if (gameGUI == NULL)
-        return FALSE;
+        return POINTER_NULL;
+
+    struct BotJob *job = gui_createBotJob(gameGUI, decision);
+    if (job == NULL)
+        return ILLEGAL_VALUE;
+
+    /* Without a pool the robot thinks in the main loop, the result is still
+     * applied from an idle callback. */
+    if (gameGUI->botPool == NULL ||
+        !g_thread_pool_push(gameGUI->botPool, job, NULL))
+        gui_thinkBot(job, NULL);
+
+    return FUNCTION_NO_ERROR;
+}
+
+int gui_placeBotBid(struct GameGUI *gameGUI, int bid)
+{
+    if (gameGUI == NULL)
+        return POINTER_NULL;
     if (gameGUI->game == NULL)
-        return FALSE;
+        return GAME_NULL;
 
     struct Round *round;
     struct Player *player;
+    guint seconds = 1;
 
     round = gameGUI->game->rounds[gameGUI->game->currentRound];
     player = round->players[gameGUI->bidPlayerId];
 
-    int bid = robot_getBid(player, round);
     round_placeBid(round, player, bid);
     gui_showInformationsPlayers(gameGUI->playersGUI, gameGUI->game);
     gui_setNoOfBids(gameGUI->labelNoOfBids, round);
@@ -1394,9 +1549,33 @@ gboolean gui_botChooseBid(gpointer unused)
 
             gui_showLimitTimeGUI(gameGUI->limitTimeGUI);
             gui_startTime(gameGUI);
+        } else {
+            g_timeout_add_seconds(seconds, gui_botChooseBid, NULL);
         }
     }
 
+    return FUNCTION_NO_ERROR;
+}
+
+gboolean gui_botChooseBid(gpointer unused)
+{
+    struct GameGUI *gameGUI = gui_getGameGUI();
+    if (gameGUI == NULL)
+        return FALSE;
+    if (gameGUI->game == NULL)
+        return FALSE;
+
+    /* If the job can't be made, the robot thinks in the main loop, so the
+     * game doesn't wait for a bid which never comes. */
+    if (gui_startBotJob(gameGUI, BOT_BID) != FUNCTION_NO_ERROR) {
+        int roundId = gameGUI->game->currentRound;
+        struct Round *round = gameGUI->game->rounds[roundId];
+        struct Player *player = round->players[gameGUI->bidPlayerId];
+        int bid = bidtable_getBid(gui_getBidTable(), player, round);
+        if (bid >= 0)
+            gui_placeBotBid(gameGUI, bid);
+    }
+
     return FALSE;
 }
 
@@ -1416,23 +1595,23 @@ gboolean gui_chooseBidForBots(struct GameGUI *gameGUI, int leftLimit,
         rightLimit < 0 || rightLimit > MAX_GAME_PLAYERS)
         return FALSE;
 
+    /* The robots bid one after the other, every robot is asked after the
+     * bid of the previous one is placed (see gui_placeBotBid()). */
     struct Round *round = gameGUI->game->rounds[gameGUI->game->currentRound];
-    guint seconds = 0;
-    for (int i = leftLimit; i < rightLimit; i++)
-        if (round->players[i] != NULL)
-            if (round->players[i]->isHuman == 0) {
-                seconds++;
-                g_timeout_add_seconds(seconds, gui_botChooseBid, NULL);
-            }
+    guint seconds = 1;
+    if (leftLimit < rightLimit && round->players[leftLimit] != NULL)
+        if (round->players[leftLimit]->isHuman == 0)
+            g_timeout_add_seconds(seconds, gui_botChooseBid, NULL);
 
     return FALSE;
 }
 
-gboolean gui_botChooseCard(gpointer unused)
+int gui_playBotCard(struct GameGUI *gameGUI, int cardId)
 {
-    struct GameGUI *gameGUI = gui_getGameGUI();
-    if (gameGUI == NULL || gameGUI->game == NULL)
-        return FALSE;
+    if (gameGUI == NULL)
+        return POINTER_NULL;
+    if (gameGUI->game == NULL)
+        return GAME_NULL;
 
     struct Round *round;
     struct Player *player;
@@ -1441,15 +1620,18 @@ gboolean gui_botChooseCard(gpointer unused)
     round = gameGUI->game->rounds[gameGUI->game->currentRound];
     player = round->hand->players[gameGUI->cardPlayerId];
 
-    int cardId = robot_getCardId(player, round);
-    hand_addCard(round->hand, player, &(player->hand[cardId]));
+    round_playCard(round, player, cardId);
     gui_showCardsOnTable(gameGUI->cardsFromTable, gameGUI->game);
+    if (player == gameGUI->game->players[0])
+        gui_showPlayerCards(gameGUI->playerCards, player);
 
     (gameGUI->cardPlayerId)++;
     gui_showPlayerTurn(gameGUI, gameGUI->cardPlayerId);
 
-    if (gameGUI->cardPlayerId == gameGUI->game->playersNumber)
+    if (gameGUI->cardPlayerId == gameGUI->game->playersNumber) {
         g_timeout_add_seconds(seconds, gui_endHand, NULL);
+        return FUNCTION_NO_ERROR;
+    }
 
     int cardPlayerId = gameGUI->cardPlayerId;
     int roundId      = gameGUI->game->currentRound;
@@ -1460,6 +1642,28 @@ gboolean gui_botChooseCard(gpointer unused)
 
         gui_showLimitTimeGUI(gameGUI->limitTimeGUI);
         gui_startTime(gameGUI);
+    } else {
+        g_timeout_add_seconds(seconds, gui_botChooseCard, NULL);
+    }
+
+    return FUNCTION_NO_ERROR;
+}
+
+gboolean gui_botChooseCard(gpointer unused)
+{
+    struct GameGUI *gameGUI = gui_getGameGUI();
+    if (gameGUI == NULL || gameGUI->game == NULL)
+        return FALSE;
+
+    /* If the job can't be made, the robot thinks in the main loop, so the
+     * game doesn't wait for a card which never comes. */
+    if (gui_startBotJob(gameGUI, BOT_CARD) != FUNCTION_NO_ERROR) {
+        int roundId = gameGUI->game->currentRound;
+        struct Round *round = gameGUI->game->rounds[roundId];
+        struct Player *player = round->hand->players[gameGUI->cardPlayerId];
+        int cardId = robot_getCardId(player, round);
+        if (cardId >= 0)
+            gui_playBotCard(gameGUI, cardId);
     }
 
     return FALSE;
@@ -1481,14 +1685,13 @@ gboolean gui_chooseCardForBots(struct GameGUI *gameGUI, int leftLimit,
         rightLimit < 0 || rightLimit > MAX_GAME_PLAYERS)
         return FALSE;
 
+    /* The robots play one after the other, every robot is asked after the
+     * card of the previous one is played (see gui_playBotCard()). */
     struct Round *round = gameGUI->game->rounds[gameGUI->game->currentRound];
-    guint seconds = 0;
-    for (int i = leftLimit; i < rightLimit; i++)
-        if (round->hand->players[i] != NULL)
-            if (round->hand->players[i]->isHuman == 0) {
-                seconds++;
-                g_timeout_add_seconds(seconds, gui_botChooseCard, NULL);
-            }
+    guint seconds = 1;
+    if (leftLimit < rightLimit && round->hand->players[leftLimit] != NULL)
+        if (round->hand->players[leftLimit]->isHuman == 0)
+            g_timeout_add_seconds(seconds, gui_botChooseCard, NULL);
 
     return FALSE;
 }
@@ -1498,7 +1701,7 @@ int gui_showPlayerTurn(struct GameGUI *gameGUI, int playerId)
     if (gameGUI == NULL)
         return POINTER_NULL;
     if (playerId >= gameGUI->game->playersNumber || playerId < 0) {
-        gtk_widget_hide(gameGUI->imagePlayerTurn);
+        gui_hideTableSlot(gameGUI->renderer, gameGUI->slotPlayerTurn);
         return ILLEGAL_VALUE;
     }
 
@@ -1523,30 +1726,42 @@ int gui_showPlayerTurn(struct GameGUI *gameGUI, int playerId)
     if (playerIdInGame < 0)
         return playerIdInGame;
 
-    gtk_widget_hide(gameGUI->imagePlayerTurn);
-    gtk_fixed_move(GTK_FIXED(gameGUI->fixedTable), gameGUI->imagePlayerTurn,
-                   coordinates[playerIdInGame][0],
-                   coordinates[playerIdInGame][1]);
-    gtk_widget_show(gameGUI->imagePlayerTurn);
+    gui_moveTableSlot(gameGUI->renderer, gameGUI->slotPlayerTurn,
+                      coordinates[playerIdInGame][0],
+                      coordinates[playerIdInGame][1]);
+    gui_setTableSprite(gameGUI->renderer, gameGUI->slotPlayerTurn,
+                       PLAYER_TURN_SPRITE, 1);
 
     return FUNCTION_NO_ERROR;
 }
 
-struct LimitTimeGUI *gui_createLimitTimeGUI(GtkWidget *fixed, int x, int y)
+struct LimitTimeGUI *gui_createLimitTimeGUI(struct TableRenderer *renderer,
+                                           int x, int y)
 {
     struct LimitTimeGUI *limitTimeGUI = malloc(sizeof(struct LimitTimeGUI));
 
-    for (int i = 0; i < LENGTH_TIME_LINE; i++)
-        limitTimeGUI->images[i] = NULL;
-
-    limitTimeGUI->fixed     = fixed;
+    limitTimeGUI->renderer  = renderer;
+    limitTimeGUI->slot      = -1;
     limitTimeGUI->x         = x;
     limitTimeGUI->y         = y;
-    limitTimeGUI->lastImage = LENGTH_TIME_LINE - 1;
+    limitTimeGUI->deadline  = 0;
+    limitTimeGUI->timeoutId = 0;
+    limitTimeGUI->isMapped  = 1;
 
     return limitTimeGUI;
 }
 
+/**
+ * @brief Function removes the timeout of the time line, if it has one.
+ */
+static void gui_removeLimitTimeTimeout(struct LimitTimeGUI *limitTimeGUI)
+{
+    if (limitTimeGUI->timeoutId != 0) {
+        g_source_remove(limitTimeGUI->timeoutId);
+        limitTimeGUI->timeoutId = 0;
+    }
+}
+
 int gui_deleteLimitTimeGUI(struct LimitTimeGUI **limitTimeGUI)
 {
     if (limitTimeGUI == NULL)
@@ -1554,6 +1769,7 @@ int gui_deleteLimitTimeGUI(struct LimitTimeGUI **limitTimeGUI)
     if (*limitTimeGUI == NULL)
         return POINTER_NULL;
 
+    gui_removeLimitTimeTimeout(*limitTimeGUI);
     free(*limitTimeGUI);
     *limitTimeGUI = NULL;
 
@@ -1565,10 +1781,12 @@ int gui_showLimitTimeGUI(struct LimitTimeGUI *limitTimeGUI)
     if (limitTimeGUI == NULL)
         return POINTER_NULL;
 
-    for (int i = 0; i < LENGTH_TIME_LINE; i++)
-        gtk_widget_show(limitTimeGUI->images[i]);
+    gui_removeLimitTimeTimeout(limitTimeGUI);
+    limitTimeGUI->deadline = g_get_monotonic_time() +
+                             (gint64)LIMIT_TIME * G_USEC_PER_SEC;
 
-    limitTimeGUI->lastImage = LENGTH_TIME_LINE - 1;
+    gui_setTableSprite(limitTimeGUI->renderer, limitTimeGUI->slot,
+                       TIME_LINE_SPRITE, LENGTH_TIME_LINE);
 
     return FUNCTION_NO_ERROR;
 }
@@ -1578,37 +1796,117 @@ int gui_hideLimitTimeGUI(struct LimitTimeGUI *limitTimeGUI)
     if (limitTimeGUI == NULL)
         return POINTER_NULL;
 
-    for (int i = 0; i <= limitTimeGUI->lastImage; i++)
-        gtk_widget_hide(limitTimeGUI->images[i]);
+    gui_removeLimitTimeTimeout(limitTimeGUI);
+    limitTimeGUI->deadline = 0;
+
+    gui_hideTableSlot(limitTimeGUI->renderer, limitTimeGUI->slot);
 
     return FUNCTION_NO_ERROR;
 }
 
-int gui_initLimitTimeGUI(struct LimitTimeGUI *limitTimeGUI, char *pathImage)
+int gui_initLimitTimeGUI(struct LimitTimeGUI *limitTimeGUI)
 {
-    if (pathImage == NULL)
+    if (limitTimeGUI == NULL)
         return POINTER_NULL;
 
-    for (int i = 0; i < LENGTH_TIME_LINE; i++) {
-        limitTimeGUI->images[i] = gui_imageNewFromFile(pathImage);
-        gtk_fixed_put(GTK_FIXED(limitTimeGUI->fixed), limitTimeGUI->images[i],
-                      25 + 3 * i, 378);
-    }
+    limitTimeGUI->slot = gui_addTableSlot(limitTimeGUI->renderer,
+                                          limitTimeGUI->x, limitTimeGUI->y);
+    if (limitTimeGUI->slot < 0)
+        return limitTimeGUI->slot;
 
     return FUNCTION_NO_ERROR;
 }
 
-int gui_hideLastImageFromLimitTimeGUI(struct LimitTimeGUI *limitTimeGUI)
+int gui_getLimitTimeImages(const struct LimitTimeGUI *limitTimeGUI,
+                           gint64 now)
 {
     if (limitTimeGUI == NULL)
         return POINTER_NULL;
 
-    gtk_widget_hide(limitTimeGUI->images[limitTimeGUI->lastImage]);
-    --(limitTimeGUI->lastImage);
+    gint64 remaining = limitTimeGUI->deadline - now;
+    if (limitTimeGUI->deadline == 0 || remaining <= 0)
+        return 0;
+
+    gint64 total = (gint64)LIMIT_TIME * G_USEC_PER_SEC;
+    if (remaining >= total)
+        return LENGTH_TIME_LINE;
+
+    /* An image is displayed while there is time left in its part of the
+     * time line. */
+    return (int)((remaining * LENGTH_TIME_LINE + total - 1) / total);
+}
+
+int gui_updateLimitTimeGUI(struct LimitTimeGUI *limitTimeGUI)
+{
+    if (limitTimeGUI == NULL)
+        return POINTER_NULL;
+
+    int images = gui_getLimitTimeImages(limitTimeGUI, g_get_monotonic_time());
+
+    /* Only the images which disappeared are drawn again. */
+    if (limitTimeGUI->isMapped == 1)
+        gui_setTableSprite(limitTimeGUI->renderer, limitTimeGUI->slot,
+                           TIME_LINE_SPRITE, images);
+
+    return images;
+}
+
+int gui_scheduleLimitTimeGUI(struct LimitTimeGUI *limitTimeGUI)
+{
+    if (limitTimeGUI == NULL)
+        return POINTER_NULL;
+
+    gui_removeLimitTimeTimeout(limitTimeGUI);
+    if (limitTimeGUI->deadline == 0)
+        return FUNCTION_NO_ERROR;
+
+    gint64 now = g_get_monotonic_time();
+    gint64 wakeup = limitTimeGUI->deadline;
+
+    /* While the table is displayed, the timer wakes up when the next image
+     * disappears. Else it wakes up only at the deadline. */
+    int images = gui_getLimitTimeImages(limitTimeGUI, now);
+    if (limitTimeGUI->isMapped == 1 && images > 1)
+        wakeup -= (images - 1) * ((gint64)LIMIT_TIME * G_USEC_PER_SEC) /
+                  LENGTH_TIME_LINE;
+
+    guint interval = 0;
+    if (wakeup > now)
+        interval = (guint)((wakeup - now + 999) / 1000);
+
+    limitTimeGUI->timeoutId = g_timeout_add(interval, gui_timer, NULL);
 
     return FUNCTION_NO_ERROR;
 }
 
+gboolean gui_mapLimitTimeGUI(GtkWidget *window, GdkEvent *event,
+                             struct LimitTimeGUI *limitTimeGUI)
+{
+    if (limitTimeGUI == NULL)
+        return FALSE;
+
+    limitTimeGUI->isMapped = 1;
+    if (limitTimeGUI->deadline != 0) {
+        gui_updateLimitTimeGUI(limitTimeGUI);
+        gui_scheduleLimitTimeGUI(limitTimeGUI);
+    }
+
+    return FALSE;
+}
+
+gboolean gui_unmapLimitTimeGUI(GtkWidget *window, GdkEvent *event,
+                               struct LimitTimeGUI *limitTimeGUI)
+{
+    if (limitTimeGUI == NULL)
+        return FALSE;
+
+    limitTimeGUI->isMapped = 0;
+    if (limitTimeGUI->deadline != 0)
+        gui_scheduleLimitTimeGUI(limitTimeGUI);
+
+    return FALSE;
+}
+
 int gui_startTime(struct GameGUI *gameGUI)
 {
     if (gameGUI == NULL)
@@ -1616,10 +1914,7 @@ int gui_startTime(struct GameGUI *gameGUI)
     if (gameGUI->limitTimeGUI == NULL)
         return POINTER_NULL;
 
-    guint interval = (1000 * LIMIT_TIME) / LENGTH_TIME_LINE;
-    g_timeout_add(interval, gui_timer, NULL);
-
-    return FUNCTION_NO_ERROR;
+    return gui_scheduleLimitTimeGUI(gameGUI->limitTimeGUI);
 }
 
 gboolean gui_timer(gpointer unused)
@@ -1633,312 +1928,55 @@ gboolean gui_timer(gpointer unused)
     if (gameGUI->select == NULL)
         return FALSE;
 
+    /* The timeout isn't repeated, gui_scheduleLimitTimeGUI() adds the next
+     * one. */
+    gameGUI->limitTimeGUI->timeoutId = 0;
+
     if (gameGUI->select->cardPlayerTurn == 0 &&
         gameGUI->select->bidPlayerTurn == 0) {
         return FALSE;
     }
 
-    gui_hideLastImageFromLimitTimeGUI(gameGUI->limitTimeGUI);
-    if (gameGUI->limitTimeGUI->lastImage == -1 &&
-        gameGUI->select->cardPlayerTurn == 1)
-    {
-        struct Round *round;
-        struct Player *player;
-        guint seconds = 1;
-        round = gameGUI->game->rounds[gameGUI->game->currentRound];
-        player = gameGUI->game->players[0];
-
-        gameGUI->select->cardPlayerTurn = 0;
-        int cardId = robot_getCardId(player, round);
-        hand_addCard(round->hand, player, &(player->hand[cardId]));
-        gui_showCardsOnTable(gameGUI->cardsFromTable, gameGUI->game);
-
-        gui_hidePlayerCards(gameGUI->playerCards);
-        gui_showPlayerCards(gameGUI->playerCards, player);
-        gtk_widget_hide(gameGUI->select->imageSelectedCard);
+    if (gui_updateLimitTimeGUI(gameGUI->limitTimeGUI) > 0) {
+        gui_scheduleLimitTimeGUI(gameGUI->limitTimeGUI);
+        return FALSE;
+    }
 
-        ++(gameGUI->cardPlayerId);
-        gui_showPlayerTurn(gameGUI, gameGUI->cardPlayerId);
+    gui_hideLimitTimeGUI(gameGUI->limitTimeGUI);
 
-        if (gameGUI->cardPlayerId == gameGUI->game->playersNumber)
-            g_timeout_add_seconds(seconds, gui_endHand, NULL);
-        else
-            gui_chooseCardForBots(gameGUI, gameGUI->cardPlayerId,
-                                  MAX_GAME_PLAYERS);
+    /* When the time of the player is up, the robot chooses for him in the
+     * same way as for the robots, without blocking the main loop. */
+    if (gameGUI->select->cardPlayerTurn == 1)
+    {
+        gameGUI->select->cardPlayerTurn = 0;
+        gui_hideTableSlot(gameGUI->renderer,
+                          gameGUI->select->slotSelectedCard);
+        gui_botChooseCard(NULL);
 
         return FALSE;
     }
 
-    if (gameGUI->limitTimeGUI->lastImage == -1 &&
-        gameGUI->select->bidPlayerTurn == 1)
+    if (gameGUI->select->bidPlayerTurn == 1)
     {
-        struct Round *round;
-        struct Player *player;
-        round = gameGUI->game->rounds[gameGUI->game->currentRound];
-        player = gameGUI->game->players[0];
-
         gameGUI->select->bidPlayerTurn = 0;
-        int bid = robot_getBid(player, round);
-        round_placeBid(round, player, bid);
         gui_hideBidGUI(gameGUI->bidGUI);
-        gtk_widget_hide(gameGUI->select->imageSelectedBid);
-
-        gui_showInformationsPlayers(gameGUI->playersGUI, gameGUI->game);
-        gui_setNoOfBids(gameGUI->labelNoOfBids, round);
-
-        ++(gameGUI->bidPlayerId);
-        gui_showPlayerTurn(gameGUI, gameGUI->bidPlayerId);
-
-        if (gameGUI->bidPlayerId == gameGUI->game->playersNumber)
-            gui_startHand(gameGUI, 0);
-        else
-            gui_chooseBidForBots(gameGUI, gameGUI->bidPlayerId,
-                                 MAX_GAME_PLAYERS);
+        gui_hideTableSlot(gameGUI->renderer, gameGUI->select->slotSelectedBid);
+        gui_botChooseBid(NULL);
     }
 
-    return TRUE;
+    return FALSE;
 }
 
-int gui_getResourceId(const char* name)
-{
-    if(strcmp(name, "pictures/positive_reward.png") == 0)
-        return ID_pictures_positive_reward_png;
-    if(strcmp(name, "pictures/negative_reward.png") == 0)
-        return ID_pictures_negative_reward_png;
-    if(strcmp(name, "pictures/bid.png") == 0)
-        return ID_pictures_bid_png;
-    if(strcmp(name, "pictures/limit_time.png") == 0)
-        return ID_pictures_limit_time_png;
-    if(strcmp(name, "pictures/logo_game.png") == 0)
-        return ID_pictures_logo_game_png;
-    if(strcmp(name, "pictures/player.png") == 0)
-        return ID_pictures_player_png;
-    if(strcmp(name, "pictures/playerTurn.png") == 0)
-        return ID_pictures_playerTurn_png;
-    if(strcmp(name, "pictures/score.png") == 0)
-        return ID_pictures_score_png;
-    if(strcmp(name, "pictures/select_bid.png") == 0)
-        return ID_pictures_select_bid_png;
-    if(strcmp(name, "pictures/select_card.png") == 0)
-        return ID_pictures_select_card_png;
-    if(strcmp(name, "pictures/splash_screen.jpg") == 0)
-        return ID_pictures_splash_screen_jpg;
-    if(strcmp(name, "pictures/table.png") == 0)
-        return ID_pictures_table_png;
-    if(strcmp(name, "pictures/45x60/10A.jpg") == 0)
-        return ID_pictures_45x60_10A_jpg;
-    if(strcmp(name, "pictures/45x60/10B.jpg") == 0)
-        return ID_pictures_45x60_10B_jpg;
-    if(strcmp(name, "pictures/45x60/10C.jpg") == 0)
-        return ID_pictures_45x60_10C_jpg;
-    if(strcmp(name, "pictures/45x60/10D.jpg") == 0)
-        return ID_pictures_45x60_10D_jpg;
-    if(strcmp(name, "pictures/45x60/12A.jpg") == 0)
-        return ID_pictures_45x60_12A_jpg;
-    if(strcmp(name, "pictures/45x60/12B.jpg") == 0)
-        return ID_pictures_45x60_12B_jpg;
-    if(strcmp(name, "pictures/45x60/12C.jpg") == 0)
-        return ID_pictures_45x60_12C_jpg;
-    if(strcmp(name, "pictures/45x60/12D.jpg") == 0)
-        return ID_pictures_45x60_12D_jpg;
-    if(strcmp(name, "pictures/45x60/13A.jpg") == 0)
-        return ID_pictures_45x60_13A_jpg;
-    if(strcmp(name, "pictures/45x60/13B.jpg") == 0)
-        return ID_pictures_45x60_13B_jpg;
-    if(strcmp(name, "pictures/45x60/13C.jpg") == 0)
-        return ID_pictures_45x60_13C_jpg;
-    if(strcmp(name, "pictures/45x60/13D.jpg") == 0)
-        return ID_pictures_45x60_13D_jpg;
-    if(strcmp(name, "pictures/45x60/14A.jpg") == 0)
-        return ID_pictures_45x60_14A_jpg;
-    if(strcmp(name, "pictures/45x60/14B.jpg") == 0)
-        return ID_pictures_45x60_14B_jpg;
-    if(strcmp(name, "pictures/45x60/14C.jpg") == 0)
-        return ID_pictures_45x60_14C_jpg;
-    if(strcmp(name, "pictures/45x60/14D.jpg") == 0)
-        return ID_pictures_45x60_14D_jpg;
-    if(strcmp(name, "pictures/45x60/15A.jpg") == 0)
-        return ID_pictures_45x60_15A_jpg;
-    if(strcmp(name, "pictures/45x60/15B.jpg") == 0)
-        return ID_pictures_45x60_15B_jpg;
-    if(strcmp(name, "pictures/45x60/15C.jpg") == 0)
-        return ID_pictures_45x60_15C_jpg;
-    if(strcmp(name, "pictures/45x60/15D.jpg") == 0)
-        return ID_pictures_45x60_15D_jpg;
-    if(strcmp(name, "pictures/45x60/2A.jpg") == 0)
-        return ID_pictures_45x60_2A_jpg;
-    if(strcmp(name, "pictures/45x60/2B.jpg") == 0)
-        return ID_pictures_45x60_2B_jpg;
-    if(strcmp(name, "pictures/45x60/2C.jpg") == 0)
-        return ID_pictures_45x60_2C_jpg;
-    if(strcmp(name, "pictures/45x60/2D.jpg") == 0)
-        return ID_pictures_45x60_2D_jpg;
-    if(strcmp(name, "pictures/45x60/3A.jpg") == 0)
-        return ID_pictures_45x60_3A_jpg;
-    if(strcmp(name, "pictures/45x60/3B.jpg") == 0)
-        return ID_pictures_45x60_3B_jpg;
-    if(strcmp(name, "pictures/45x60/3C.jpg") == 0)
-        return ID_pictures_45x60_3C_jpg;
-    if(strcmp(name, "pictures/45x60/3D.jpg") == 0)
-        return ID_pictures_45x60_3D_jpg;
-    if(strcmp(name, "pictures/45x60/45x60.jpg") == 0)
-        return ID_pictures_45x60_45x60_jpg;
-    if(strcmp(name, "pictures/45x60/4A.jpg") == 0)
-        return ID_pictures_45x60_4A_jpg;
-    if(strcmp(name, "pictures/45x60/4B.jpg") == 0)
-        return ID_pictures_45x60_4B_jpg;
-    if(strcmp(name, "pictures/45x60/4C.jpg") == 0)
-        return ID_pictures_45x60_4C_jpg;
-    if(strcmp(name, "pictures/45x60/4D.jpg") == 0)
-        return ID_pictures_45x60_4D_jpg;
-    if(strcmp(name, "pictures/45x60/5A.jpg") == 0)
-        return ID_pictures_45x60_5A_jpg;
-    if(strcmp(name, "pictures/45x60/5B.jpg") == 0)
-        return ID_pictures_45x60_5B_jpg;
-    if(strcmp(name, "pictures/45x60/5C.jpg") == 0)
-        return ID_pictures_45x60_5C_jpg;
-    if(strcmp(name, "pictures/45x60/5D.jpg") == 0)
-        return ID_pictures_45x60_5D_jpg;
-    if(strcmp(name, "pictures/45x60/6A.jpg") == 0)
-        return ID_pictures_45x60_6A_jpg;
-    if(strcmp(name, "pictures/45x60/6B.jpg") == 0)
-        return ID_pictures_45x60_6B_jpg;
-    if(strcmp(name, "pictures/45x60/6C.jpg") == 0)
-        return ID_pictures_45x60_6C_jpg;
-    if(strcmp(name, "pictures/45x60/6D.jpg") == 0)
-        return ID_pictures_45x60_6D_jpg;
-    if(strcmp(name, "pictures/45x60/7A.jpg") == 0)
-        return ID_pictures_45x60_7A_jpg;
-    if(strcmp(name, "pictures/45x60/7B.jpg") == 0)
-        return ID_pictures_45x60_7B_jpg;
-    if(strcmp(name, "pictures/45x60/7C.jpg") == 0)
-        return ID_pictures_45x60_7C_jpg;
-    if(strcmp(name, "pictures/45x60/7D.jpg") == 0)
-        return ID_pictures_45x60_7D_jpg;
-    if(strcmp(name, "pictures/45x60/8A.jpg") == 0)
-        return ID_pictures_45x60_8A_jpg;
-    if(strcmp(name, "pictures/45x60/8B.jpg") == 0)
-        return ID_pictures_45x60_8B_jpg;
-    if(strcmp(name, "pictures/45x60/8C.jpg") == 0)
-        return ID_pictures_45x60_8C_jpg;
-    if(strcmp(name, "pictures/45x60/8D.jpg") == 0)
-        return ID_pictures_45x60_8D_jpg;
-    if(strcmp(name, "pictures/45x60/9A.jpg") == 0)
-        return ID_pictures_45x60_9A_jpg;
-    if(strcmp(name, "pictures/45x60/9B.jpg") == 0)
-        return ID_pictures_45x60_9B_jpg;
-    if(strcmp(name, "pictures/45x60/9C.jpg") == 0)
-        return ID_pictures_45x60_9C_jpg;
-    if(strcmp(name, "pictures/45x60/9D.jpg") == 0)
-        return ID_pictures_45x60_9D_jpg;
-    if(strcmp(name, "pictures/80x110/10A.jpg") == 0)
-        return ID_pictures_80x110_10A_jpg;
-    if(strcmp(name, "pictures/80x110/10B.jpg") == 0)
-        return ID_pictures_80x110_10B_jpg;
-    if(strcmp(name, "pictures/80x110/10C.jpg") == 0)
-        return ID_pictures_80x110_10C_jpg;
-    if(strcmp(name, "pictures/80x110/10D.jpg") == 0)
-        return ID_pictures_80x110_10D_jpg;
-    if(strcmp(name, "pictures/80x110/12A.jpg") == 0)
-        return ID_pictures_80x110_12A_jpg;
-    if(strcmp(name, "pictures/80x110/12B.jpg") == 0)
-        return ID_pictures_80x110_12B_jpg;
-    if(strcmp(name, "pictures/80x110/12C.jpg") == 0)
-        return ID_pictures_80x110_12C_jpg;
-    if(strcmp(name, "pictures/80x110/12D.jpg") == 0)
-        return ID_pictures_80x110_12D_jpg;
-    if(strcmp(name, "pictures/80x110/13A.jpg") == 0)
-        return ID_pictures_80x110_13A_jpg;
-    if(strcmp(name, "pictures/80x110/13B.jpg") == 0)
-        return ID_pictures_80x110_13B_jpg;
-    if(strcmp(name, "pictures/80x110/13C.jpg") == 0)
-        return ID_pictures_80x110_13C_jpg;
-    if(strcmp(name, "pictures/80x110/13D.jpg") == 0)
-        return ID_pictures_80x110_13D_jpg;
-    if(strcmp(name, "pictures/80x110/14A.jpg") == 0)
-        return ID_pictures_80x110_14A_jpg;
-    if(strcmp(name, "pictures/80x110/14B.jpg") == 0)
-        return ID_pictures_80x110_14B_jpg;
-    if(strcmp(name, "pictures/80x110/14C.jpg") == 0)
-        return ID_pictures_80x110_14C_jpg;
-    if(strcmp(name, "pictures/80x110/14D.jpg") == 0)
-        return ID_pictures_80x110_14D_jpg;
-    if(strcmp(name, "pictures/80x110/15A.jpg") == 0)
-        return ID_pictures_80x110_15A_jpg;
-    if(strcmp(name, "pictures/80x110/15B.jpg") == 0)
-        return ID_pictures_80x110_15B_jpg;
-    if(strcmp(name, "pictures/80x110/15C.jpg") == 0)
-        return ID_pictures_80x110_15C_jpg;
-    if(strcmp(name, "pictures/80x110/15D.jpg") == 0)
-        return ID_pictures_80x110_15D_jpg;
-    if(strcmp(name, "pictures/80x110/2A.jpg") == 0)
-        return ID_pictures_80x110_2A_jpg;
-    if(strcmp(name, "pictures/80x110/2B.jpg") == 0)
-        return ID_pictures_80x110_2B_jpg;
-    if(strcmp(name, "pictures/80x110/2C.jpg") == 0)
-        return ID_pictures_80x110_2C_jpg;
-    if(strcmp(name, "pictures/80x110/2D.jpg") == 0)
-        return ID_pictures_80x110_2D_jpg;
-    if(strcmp(name, "pictures/80x110/3A.jpg") == 0)
-        return ID_pictures_80x110_3A_jpg;
-    if(strcmp(name, "pictures/80x110/3B.jpg") == 0)
-        return ID_pictures_80x110_3B_jpg;
-    if(strcmp(name, "pictures/80x110/3C.jpg") == 0)
-        return ID_pictures_80x110_3C_jpg;
-    if(strcmp(name, "pictures/80x110/3D.jpg") == 0)
-        return ID_pictures_80x110_3D_jpg;
-    if(strcmp(name, "pictures/80x110/4A.jpg") == 0)
-        return ID_pictures_80x110_4A_jpg;
-    if(strcmp(name, "pictures/80x110/4B.jpg") == 0)
-        return ID_pictures_80x110_4B_jpg;
-    if(strcmp(name, "pictures/80x110/4C.jpg") == 0)
-        return ID_pictures_80x110_4C_jpg;
-    if(strcmp(name, "pictures/80x110/4D.jpg") == 0)
-        return ID_pictures_80x110_4D_jpg;
-    if(strcmp(name, "pictures/80x110/5A.jpg") == 0)
-        return ID_pictures_80x110_5A_jpg;
-    if(strcmp(name, "pictures/80x110/5B.jpg") == 0)
-        return ID_pictures_80x110_5B_jpg;
-    if(strcmp(name, "pictures/80x110/5C.jpg") == 0)
-        return ID_pictures_80x110_5C_jpg;
-    if(strcmp(name, "pictures/80x110/5D.jpg") == 0)
-        return ID_pictures_80x110_5D_jpg;
-    if(strcmp(name, "pictures/80x110/6A.jpg") == 0)
-        return ID_pictures_80x110_6A_jpg;
-    if(strcmp(name, "pictures/80x110/6B.jpg") == 0)
-        return ID_pictures_80x110_6B_jpg;
-    if(strcmp(name, "pictures/80x110/6C.jpg") == 0)
-        return ID_pictures_80x110_6C_jpg;
-    if(strcmp(name, "pictures/80x110/6D.jpg") == 0)
-        return ID_pictures_80x110_6D_jpg;
-    if(strcmp(name, "pictures/80x110/7A.jpg") == 0)
-        return ID_pictures_80x110_7A_jpg;
-    if(strcmp(name, "pictures/80x110/7B.jpg") == 0)
-        return ID_pictures_80x110_7B_jpg;
-    if(strcmp(name, "pictures/80x110/7C.jpg") == 0)
-        return ID_pictures_80x110_7C_jpg;
-    if(strcmp(name, "pictures/80x110/7D.jpg") == 0)
-        return ID_pictures_80x110_7D_jpg;
-    if(strcmp(name, "pictures/80x110/80x110.jpg") == 0)
-        return ID_pictures_80x110_80x110_jpg;
-    if(strcmp(name, "pictures/80x110/8A.jpg") == 0)
-        return ID_pictures_80x110_8A_jpg;
-    if(strcmp(name, "pictures/80x110/8B.jpg") == 0)
-        return ID_pictures_80x110_8B_jpg;
-    if(strcmp(name, "pictures/80x110/8C.jpg") == 0)
-        return ID_pictures_80x110_8C_jpg;
-    if(strcmp(name, "pictures/80x110/8D.jpg") == 0)
-        return ID_pictures_80x110_8D_jpg;
-    if(strcmp(name, "pictures/80x110/9A.jpg") == 0)
-        return ID_pictures_80x110_9A_jpg;
-    if(strcmp(name, "pictures/80x110/9B.jpg") == 0)
-        return ID_pictures_80x110_9B_jpg;
-    if(strcmp(name, "pictures/80x110/9C.jpg") == 0)
-        return ID_pictures_80x110_9C_jpg;
-    if(strcmp(name, "pictures/80x110/9D.jpg") == 0)
-        return ID_pictures_80x110_9D_jpg;
+GdkPixbuf *gui_pixbufNewFromFile(const char *name)
+{
+    if (name == NULL)
+        return NULL;
 
-    return 0;
+    gchar *path = g_strconcat(GUI_RESOURCE_PREFIX, name, NULL);
+    GdkPixbuf *pixbuf = gdk_pixbuf_new_from_resource(path, NULL);
+    g_free(path);
+
+    return pixbuf;
 }
 
 static void gui_imageFromFileInternal(GtkWidget** img, const char *name)
@@ -1948,45 +1986,17 @@ static void gui_imageFromFileInternal(GtkWidget** img, const char *name)
     if (img == NULL)
         return;
 
-#ifdef WIN32
-    int id = gui_getResourceId(name);
-    if (id == 0)
-        return;
-
-    HRSRC res = FindResource(NULL, MAKEINTRESOURCE(id), "BINARY");
-    HGLOBAL resource = LoadResource(NULL, res);
-    void* resourceData = LockResource(resource);
-    DWORD resourceSize = SizeofResource(NULL, res);
-
-    char tempPath[1024] = {0};
-    char tempFile[1024] = {0};
-    GetTempPath(sizeof(tempPath) / sizeof(tempPath[0]), tempPath);
-    GetTempFileName(tempPath, "WHIST", 0, tempFile);
-
-    FILE* f = fopen(tempFile, "wb");
-    fwrite(resourceData, 1, resourceSize, f);
-    fclose(f);
-
+    GdkPixbuf *pixbuf = gui_pixbufNewFromFile(name);
     if (*img == NULL)
     {
-        *img = gtk_image_new_from_file(tempFile);
+        *img = gtk_image_new_from_pixbuf(pixbuf);
     }
     else
     {
-        gtk_image_set_from_file(GTK_IMAGE(*img), tempFile);
+        gtk_image_set_from_pixbuf(GTK_IMAGE(*img), pixbuf);
     }
-    unlink(tempFile);
-
-#else
-    if (*img == NULL)
-    {
-        *img = gtk_image_new_from_file(name);
-    }
-    else
-    {
-        gtk_image_set_from_file(GTK_IMAGE(*img), name);
-    }
-#endif
+    if (pixbuf != NULL)
+        g_object_unref(pixbuf);
 
     return;
 }
@@ -2007,3 +2017,471 @@ void gui_imageSetFromFile(GtkWidget* image, const char* name)
     gui_imageFromFileInternal(&image, name);
 }
 
+struct CardImages *gui_createCardImages()
+{
+    struct CardImages *cardImages = calloc(1, sizeof(struct CardImages));
+    if (cardImages == NULL)
+        return NULL;
+
+    for (int size = SMALL_CARD; size < CardSizeEnd; size++) {
+        char path[30];
+        gui_getCardPath(EMPTY_CARD, size, path);
+        cardImages->backs[size] = gui_pixbufNewFromFile(path);
+        if (cardImages->backs[size] == NULL) {
+            gui_deleteCardImages(&cardImages);
+            return NULL;
+        }
+
+        for (int id = 0; id < DECK_SIZE; id++) {
+            struct Card card = { id };
+            gui_getCardPath(card, size, path);
+            cardImages->faces[size][id] = gui_pixbufNewFromFile(path);
+            if (cardImages->faces[size][id] == NULL) {
+                gui_deleteCardImages(&cardImages);
+                return NULL;
+            }
+        }
+    }
+
+    return cardImages;
+}
+
+int gui_deleteCardImages(struct CardImages **cardImages)
+{
+    if (cardImages == NULL || *cardImages == NULL)
+        return POINTER_NULL;
+
+    for (int size = SMALL_CARD; size < CardSizeEnd; size++) {
+        if ((*cardImages)->backs[size] != NULL)
+            g_object_unref((*cardImages)->backs[size]);
+        for (int id = 0; id < DECK_SIZE; id++)
+            if ((*cardImages)->faces[size][id] != NULL)
+                g_object_unref((*cardImages)->faces[size][id]);
+    }
+
+    free(*cardImages);
+    *cardImages = NULL;
+
+    return FUNCTION_NO_ERROR;
+}
+
+GdkPixbuf *gui_getCardPixbuf(const struct CardImages *cardImages,
+                             struct Card card, enum CardSize size)
+{
+    if (cardImages == NULL)
+        return NULL;
+    if (size < SMALL_CARD || size >= CardSizeEnd)
+        return NULL;
+
+    if (!deck_isCard(card))
+        return cardImages->backs[size];
+
+    return cardImages->faces[size][card.id];
+}
+
+/**
+ * @brief The names of the pictures of the table which aren't cards, in the
+ *        order from TableSprite.
+ */
+static const char *const TABLE_SPRITE_NAMES[TableSpriteEnd] = {
+    "pictures/player.png",
+    "pictures/playerTurn.png",
+    "pictures/bid.png",
+    "pictures/select_card.png",
+    "pictures/select_bid.png",
+    "pictures/limit_time.png",
+    "pictures/positive_reward.png",
+    "pictures/negative_reward.png"
+};
+
+/**
+ * @brief Function puts a picture in the current row of the atlas or, if it
+ *        doesn't fit, in a new row.
+ */
+static void gui_placeSprite(GdkRectangle *rectangle, const GdkPixbuf *pixbuf,
+                            int *x, int *y, int *rowHeight)
+{
+    int width  = gdk_pixbuf_get_width(pixbuf);
+    int height = gdk_pixbuf_get_height(pixbuf);
+
+    if (*x + width > TABLE_ATLAS_WIDTH) {
+        *x         = 0;
+        *y        += *rowHeight;
+        *rowHeight = 0;
+    }
+
+    rectangle->x      = *x;
+    rectangle->y      = *y;
+    rectangle->width  = width;
+    rectangle->height = height;
+
+    *x += width;
+    if (height > *rowHeight)
+        *rowHeight = height;
+}
+
+/**
+ * @brief Function draws a picture in a rectangle of a surface.
+ */
+static void gui_paintSprite(cairo_t *cr, const GdkPixbuf *pixbuf,
+                            const GdkRectangle *rectangle)
+{
+    gdk_cairo_set_source_pixbuf(cr, pixbuf, rectangle->x, rectangle->y);
+    cairo_rectangle(cr, rectangle->x, rectangle->y,
+                    rectangle->width, rectangle->height);
+    cairo_fill(cr);
+}
+
+struct TableAtlas *gui_createTableAtlas(const struct CardImages *cardImages)
+{
+    if (cardImages == NULL)
+        return NULL;
+
+    struct TableAtlas *atlas = calloc(1, sizeof(struct TableAtlas));
+    if (atlas == NULL)
+        return NULL;
+
+    GdkPixbuf *sprites[TableSpriteEnd] = { NULL };
+    int x = 0, y = 0, rowHeight = 0;
+    int loaded = 1;
+
+    for (int size = SMALL_CARD; size < CardSizeEnd; size++)
+        for (int id = 0; id <= DECK_SIZE; id++) {
+            struct Card card = { id };
+            if (id == DECK_SIZE)
+                card = EMPTY_CARD;
+            GdkPixbuf *pixbuf = gui_getCardPixbuf(cardImages, card, size);
+            if (pixbuf == NULL)
+                loaded = 0;
+            else
+                gui_placeSprite(&(atlas->cards[size][id]), pixbuf, &x, &y,
+                                &rowHeight);
+        }
+
+    for (int i = 0; i < TableSpriteEnd; i++) {
+        sprites[i] = gui_pixbufNewFromFile(TABLE_SPRITE_NAMES[i]);
+        if (sprites[i] == NULL)
+            loaded = 0;
+        else
+            gui_placeSprite(&(atlas->sprites[i]), sprites[i], &x, &y,
+                            &rowHeight);
+    }
+
+    if (loaded == 1) {
+        atlas->surface = cairo_image_surface_create(CAIRO_FORMAT_ARGB32,
+                                                    TABLE_ATLAS_WIDTH,
+                                                    y + rowHeight);
+        if (cairo_surface_status(atlas->surface) != CAIRO_STATUS_SUCCESS)
+            loaded = 0;
+    }
+
+    if (loaded == 1) {
+        cairo_t *cr = cairo_create(atlas->surface);
+        for (int size = SMALL_CARD; size < CardSizeEnd; size++)
+            for (int id = 0; id <= DECK_SIZE; id++) {
+                struct Card card = { id };
+                if (id == DECK_SIZE)
+                    card = EMPTY_CARD;
+                gui_paintSprite(cr, gui_getCardPixbuf(cardImages, card, size),
+                                &(atlas->cards[size][id]));
+            }
+        for (int i = 0; i < TableSpriteEnd; i++)
+            gui_paintSprite(cr, sprites[i], &(atlas->sprites[i]));
+        cairo_destroy(cr);
+        cairo_surface_flush(atlas->surface);
+    }
+
+    for (int i = 0; i < TableSpriteEnd; i++)
+        if (sprites[i] != NULL)
+            g_object_unref(sprites[i]);
+
+    if (loaded == 0)
+        gui_deleteTableAtlas(&atlas);
+
+    return atlas;
+}
+
+int gui_deleteTableAtlas(struct TableAtlas **atlas)
+{
+    if (atlas == NULL || *atlas == NULL)
+        return POINTER_NULL;
+
+    if ((*atlas)->surface != NULL)
+        cairo_surface_destroy((*atlas)->surface);
+
+    free(*atlas);
+    *atlas = NULL;
+
+    return FUNCTION_NO_ERROR;
+}
+
+struct TableAtlas *gui_changeTableAtlas(const struct TableAtlas *atlas,
+                                        const int onlyReturn)
+{
+    static struct TableAtlas *atlasStore = NULL;
+    if (onlyReturn == 0) {
+        atlasStore = (struct TableAtlas*)atlas;
+    }
+    return atlasStore;
+}
+
+void gui_setTableAtlas(const struct TableAtlas *atlas)
+{
+    gui_changeTableAtlas(atlas, 0);
+}
+
+struct TableAtlas *gui_getTableAtlas()
+{
+    return gui_changeTableAtlas(NULL, 1);
+}
+
+struct BidTable *gui_changeBidTable(const struct BidTable *table,
+                                    const int onlyReturn)
+{
+    static struct BidTable *tableStore = NULL;
+    if (onlyReturn == 0) {
+        tableStore = (struct BidTable*)table;
+    }
+    return tableStore;
+}
+
+void gui_setBidTable(const struct BidTable *table)
+{
+    gui_changeBidTable(table, 0);
+}
+
+struct BidTable *gui_getBidTable()
+{
+    return gui_changeBidTable(NULL, 1);
+}
+
+struct TableRenderer *gui_createTableRenderer(GtkWidget *fixed,
+                                              const struct TableAtlas *atlas,
+                                              const char *pathBackground)
+{
+    if (fixed == NULL || pathBackground == NULL)
+        return NULL;
+
+    struct TableRenderer *renderer = malloc(sizeof(struct TableRenderer));
+    if (renderer == NULL)
+        return NULL;
+
+    renderer->fixed       = fixed;
+    renderer->background  = NULL;
+    renderer->atlas       = atlas;
+    renderer->slotsNumber = 0;
+
+    GdkPixbuf *pixbuf = gui_pixbufNewFromFile(pathBackground);
+    if (pixbuf != NULL) {
+        GdkRectangle rectangle = { 0, 0, gdk_pixbuf_get_width(pixbuf),
+                                   gdk_pixbuf_get_height(pixbuf) };
+        renderer->background = cairo_image_surface_create(CAIRO_FORMAT_ARGB32,
+                                                          rectangle.width,
+                                                          rectangle.height);
+        cairo_t *cr = cairo_create(renderer->background);
+        gui_paintSprite(cr, pixbuf, &rectangle);
+        cairo_destroy(cr);
+        g_object_unref(pixbuf);
+    }
+
+    /* The GtkFixed doesn't have its own window, so the table is drawn in the
+     * window of the table before the labels and the buttons. */
+    renderer->exposeHandler = g_signal_connect(G_OBJECT(fixed), "expose-event",
+                                               G_CALLBACK(gui_exposeTable),
+                                               renderer);
+    gtk_widget_queue_draw(fixed);
+
+    return renderer;
+}
+
+int gui_deleteTableRenderer(struct TableRenderer **renderer)
+{
+    if (renderer == NULL || *renderer == NULL)
+        return POINTER_NULL;
+
+    g_signal_handler_disconnect(G_OBJECT((*renderer)->fixed),
+                                (*renderer)->exposeHandler);
+    if ((*renderer)->background != NULL)
+        cairo_surface_destroy((*renderer)->background);
+
+    free(*renderer);
+    *renderer = NULL;
+
+    return FUNCTION_NO_ERROR;
+}
+
+int gui_addTableSlot(struct TableRenderer *renderer, int x, int y)
+{
+    if (renderer == NULL)
+        return POINTER_NULL;
+    if (renderer->slotsNumber >= TABLE_MAX_SLOTS)
+        return FULL;
+
+    struct TableSlot *slot = &(renderer->slots[renderer->slotsNumber]);
+    GdkRectangle source = { 0, 0, 0, 0 };
+    slot->x      = x;
+    slot->y      = y;
+    slot->source = source;
+    slot->count  = 0;
+
+    return renderer->slotsNumber++;
+}
+
+/**
+ * @brief Function marks as damaged the pictures from first to last - 1 of a
+ *        slot, they are drawn again when GTK is idle.
+ */
+static void gui_damageTableSlot(struct TableRenderer *renderer,
+                                const struct TableSlot *slot,
+                                int first, int last)
+{
+    if (first >= last || slot->source.width <= 0 || slot->source.height <= 0)
+        return;
+
+    GtkAllocation allocation;
+    gtk_widget_get_allocation(renderer->fixed, &allocation);
+
+    gtk_widget_queue_draw_area(renderer->fixed,
+                               allocation.x + slot->x +
+                               first * slot->source.width,
+                               allocation.y + slot->y,
+                               (last - first) * slot->source.width,
+                               slot->source.height);
+}
+
+int gui_setTableSlot(struct TableRenderer *renderer, int slot,
+                     const GdkRectangle *source, int count)
+{
+    if (renderer == NULL)
+        return POINTER_NULL;
+    if (slot < 0 || slot >= renderer->slotsNumber || count < 0)
+        return ILLEGAL_VALUE;
+    if (source == NULL && count > 0)
+        return POINTER_NULL;
+
+    struct TableSlot *tableSlot = &(renderer->slots[slot]);
+    if (count == 0) {
+        gui_damageTableSlot(renderer, tableSlot, 0, tableSlot->count);
+        tableSlot->count = 0;
+        return FUNCTION_NO_ERROR;
+    }
+
+    if (tableSlot->count > 0 && tableSlot->source.x == source->x &&
+        tableSlot->source.y == source->y &&
+        tableSlot->source.width == source->width &&
+        tableSlot->source.height == source->height) {
+        /* The same picture: only the pictures added or removed at the end
+         * are drawn again. */
+        if (count > tableSlot->count)
+            gui_damageTableSlot(renderer, tableSlot, tableSlot->count, count);
+        else
+            gui_damageTableSlot(renderer, tableSlot, count, tableSlot->count);
+        tableSlot->count = count;
+        return FUNCTION_NO_ERROR;
+    }
+
+    gui_damageTableSlot(renderer, tableSlot, 0, tableSlot->count);
+    tableSlot->source = *source;
+    tableSlot->count  = count;
+    gui_damageTableSlot(renderer, tableSlot, 0, tableSlot->count);
+
+    return FUNCTION_NO_ERROR;
+}
+
+int gui_moveTableSlot(struct TableRenderer *renderer, int slot, int x, int y)
+{
+    if (renderer == NULL)
+        return POINTER_NULL;
+    if (slot < 0 || slot >= renderer->slotsNumber)
+        return ILLEGAL_VALUE;
+
+    struct TableSlot *tableSlot = &(renderer->slots[slot]);
+    if (tableSlot->x == x && tableSlot->y == y)
+        return FUNCTION_NO_ERROR;
+
+    gui_damageTableSlot(renderer, tableSlot, 0, tableSlot->count);
+    tableSlot->x = x;
+    tableSlot->y = y;
+    gui_damageTableSlot(renderer, tableSlot, 0, tableSlot->count);
+
+    return FUNCTION_NO_ERROR;
+}
+
+int gui_hideTableSlot(struct TableRenderer *renderer, int slot)
+{
+    return gui_setTableSlot(renderer, slot, NULL, 0);
+}
+
+int gui_setTableCard(struct TableRenderer *renderer, int slot,
+                     struct Card card, enum CardSize size)
+{
+    if (renderer == NULL || renderer->atlas == NULL)
+        return POINTER_NULL;
+    if (size < SMALL_CARD || size >= CardSizeEnd)
+        return ILLEGAL_VALUE;
+
+    int id = DECK_SIZE;
+    if (deck_isCard(card))
+        id = card.id;
+
+    return gui_setTableSlot(renderer, slot, &(renderer->atlas->cards[size][id]),
+                            1);
+}
+
+int gui_setTableSprite(struct TableRenderer *renderer, int slot,
+                       enum TableSprite sprite, int count)
+{
+    if (renderer == NULL || renderer->atlas == NULL)
+        return POINTER_NULL;
+    if (sprite < PLAYER_SPRITE || sprite >= TableSpriteEnd)
+        return ILLEGAL_VALUE;
+
+    return gui_setTableSlot(renderer, slot,
+                            &(renderer->atlas->sprites[sprite]), count);
+}
+
+gboolean gui_exposeTable(GtkWidget *fixed, GdkEventExpose *event,
+                         struct TableRenderer *renderer)
+{
+    if (fixed == NULL || event == NULL || renderer == NULL)
+        return FALSE;
+
+    GtkAllocation allocation;
+    gtk_widget_get_allocation(fixed, &allocation);
+
+    cairo_t *cr = gdk_cairo_create(gtk_widget_get_window(fixed));
+    gdk_cairo_region(cr, event->region);
+    cairo_clip(cr);
+    cairo_translate(cr, allocation.x, allocation.y);
+
+    if (renderer->background != NULL) {
+        cairo_set_source_surface(cr, renderer->background, 0, 0);
+        cairo_paint(cr);
+    }
+
+    for (int i = 0; i < renderer->slotsNumber && renderer->atlas != NULL;
+         i++) {
+        const struct TableSlot *slot = &(renderer->slots[i]);
+        GdkRectangle area = { allocation.x + slot->x, allocation.y + slot->y,
+                              slot->count * slot->source.width,
+                              slot->source.height };
+        if (slot->count == 0 ||
+            gdk_region_rect_in(event->region, &area) ==
+            GDK_OVERLAP_RECTANGLE_OUT)
+            continue;
+
+        for (int j = 0; j < slot->count; j++) {
+            int x = slot->x + j * slot->source.width;
+            cairo_set_source_surface(cr, renderer->atlas->surface,
+                                     x - slot->source.x,
+                                     slot->y - slot->source.y);
+            cairo_rectangle(cr, x, slot->y,
+                            slot->source.width, slot->source.height);
+            cairo_fill(cr);
+        }
+    }
+
+    cairo_destroy(cr);
+
+    return FALSE;
+}
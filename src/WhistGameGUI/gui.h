@@ -12,24 +12,167 @@
 
 #include <gtk/gtk.h>
 #include <gdk/gdk.h>
+#include <gio/gio.h>
 #include <stdlib.h>
 
 #define LIMIT_TIME 15
 #define LENGTH_TIME_LINE 50
 #define WIDTH_IMAGE_TIME_LINE 2
 
+/**
+ * @brief The maximum number of the threads in which the robots think. The
+ *        robots are asked one after the other, so a thread is enough.
+ */
+#define BOT_THREADS 1
+
+/**
+ * @brief The file of the bid table with which the robots bid, as it is
+ *        written by whist-sim -w. Without it the robots bid with
+ *        robot_getBid().
+ */
+#define BID_TABLE_FILE "bidtable.bin"
+
+/**
+ * @brief The prefix of the pictures in the resource bundle compiled in the
+ *        program (see whist.gresource.xml). The picture with the name
+ *        "pictures/table.png" is the resource "/whist/pictures/table.png".
+ */
+#define GUI_RESOURCE_PREFIX "/whist/"
+
+/**
+ * @brief The sizes of the pictures of the cards: 45x60 for the trump and the
+ *        cards from table, 80x110 for the cards of the player.
+ *
+ * CardSizeEnd is a flag used when iterating.
+ */
+enum CardSize {SMALL_CARD = 0, BIG_CARD, CardSizeEnd};
+
+/**
+ * @struct CardImages
+ *
+ * @brief The structure keeps the decoded pictures of the cards, from which
+ *        is built the TableAtlas.
+ *
+ * @var CardImages::faces
+ *      The picture of every card (indexed by the id of the card) at every
+ *      size.
+ * @var CardImages::backs
+ *      The back of the cards at every size.
+ */
+struct CardImages {
+    GdkPixbuf *faces[CardSizeEnd][DECK_SIZE];
+    GdkPixbuf *backs[CardSizeEnd];
+};
+
+/**
+ * @brief The width of the surface of a TableAtlas. The pictures are put in
+ *        rows which aren't wider than it.
+ */
+#define TABLE_ATLAS_WIDTH 1024
+
+/**
+ * @brief The maximum number of the slots of a TableRenderer.
+ */
+#define TABLE_MAX_SLOTS 48
+
+/**
+ * @brief The pictures of the table which aren't cards.
+ *
+ * TableSpriteEnd is a flag used when iterating.
+ */
+enum TableSprite {PLAYER_SPRITE = 0, PLAYER_TURN_SPRITE, BID_SPRITE,
+                  SELECTED_CARD_SPRITE, SELECTED_BID_SPRITE, TIME_LINE_SPRITE,
+                  POSITIVE_REWARD_SPRITE, NEGATIVE_REWARD_SPRITE,
+                  TableSpriteEnd};
+
+/**
+ * @struct TableAtlas
+ *
+ * @brief The structure keeps all the pictures of the table in a single cairo
+ *        surface, from which they are drawn without converting them again.
+ *
+ * @var TableAtlas::surface
+ *      The surface with the pictures.
+ * @var TableAtlas::cards
+ *      The rectangle of every card (indexed by the id of the card) at every
+ *      size, the back of the cards being at the position DECK_SIZE.
+ * @var TableAtlas::sprites
+ *      The rectangle of every other picture.
+ */
+struct TableAtlas {
+    cairo_surface_t *surface;
+    GdkRectangle cards[CardSizeEnd][DECK_SIZE + 1];
+    GdkRectangle sprites[TableSpriteEnd];
+};
+
+/**
+ * @struct TableSlot
+ *
+ * @brief The structure keeps a place of the table in which is drawn a
+ *        picture of the atlas.
+ *
+ * @var TableSlot::x
+ *      The coordinate X of the slot in the table.
+ * @var TableSlot::y
+ *      The coordinate Y of the slot in the table.
+ * @var TableSlot::source
+ *      The rectangle of the picture in the atlas.
+ * @var TableSlot::count
+ *      How many times the picture is drawn, one next to the other, 0 if the
+ *      slot is hidden.
+ */
+struct TableSlot {
+    int x;
+    int y;
+    GdkRectangle source;
+    int count;
+};
+
+/**
+ * @struct TableRenderer
+ *
+ * @brief The structure draws the pictures of a table, in its GtkFixed, below
+ *        the labels and the buttons. The slots are drawn in the order in
+ *        which they were added and, when a slot is changed, only its
+ *        rectangle is drawn again.
+ *
+ * @var TableRenderer::fixed
+ *      The GtkFixed of the table.
+ * @var TableRenderer::exposeHandler
+ *      The id of the handler of the "expose-event" signal of the GtkFixed.
+ * @var TableRenderer::background
+ *      The picture of the background of the table.
+ * @var TableRenderer::atlas
+ *      The atlas from which are drawn the slots.
+ * @var TableRenderer::slots
+ *      The slots of the table.
+ * @var TableRenderer::slotsNumber
+ *      The number of the slots.
+ */
+struct TableRenderer {
+    GtkWidget *fixed;
+    gulong exposeHandler;
+    cairo_surface_t *background;
+    const struct TableAtlas *atlas;
+    struct TableSlot slots[TABLE_MAX_SLOTS];
+    int slotsNumber;
+};
+
 struct BidGUI {
-    GtkWidget *image;
+    struct TableRenderer *renderer;
+    int slot;
     GtkWidget *label[MAX_CARDS + 1];
 };
 
 struct CardsFromTable {
-    GtkWidget *images[MAX_GAME_PLAYERS];
+    struct TableRenderer *renderer;
+    int slots[MAX_GAME_PLAYERS];
 };
 
 struct PlayersGUI {
-    GtkWidget *rewardImage[MAX_GAME_PLAYERS];
-    GtkWidget *image[MAX_GAME_PLAYERS];
+    struct TableRenderer *renderer;
+    int rewardSlots[MAX_GAME_PLAYERS];
+    int slots[MAX_GAME_PLAYERS];
     GtkWidget *nameLabel[MAX_GAME_PLAYERS];
     GtkWidget *bidsLabel[MAX_GAME_PLAYERS];
     GtkWidget *tookLabel[MAX_GAME_PLAYERS];
@@ -37,9 +180,9 @@ struct PlayersGUI {
 };
 
 struct Select {
-    GtkWidget *fixed;
-    GtkWidget *imageSelectedCard;
-    GtkWidget *imageSelectedBid;
+    struct TableRenderer *renderer;
+    int slotSelectedCard;
+    int slotSelectedBid;
     struct Player *player;
     struct Game *game;
     int cardPlayerTurn;
@@ -49,15 +192,76 @@ struct Select {
 };
 
 struct PlayerCards {
-    GtkWidget *images[MAX_CARDS];
+    struct TableRenderer *renderer;
+    int slots[MAX_CARDS];
 };
 
+/**
+ * @struct LimitTimeGUI
+ *
+ * @brief The structure keeps the time line which shows the time left to the
+ *        player. The time line is computed from a deadline on the monotonic
+ *        clock of GLib, so it doesn't depend on how late the timer wakes up.
+ *
+ * @var LimitTimeGUI::renderer
+ *      The renderer of the table.
+ * @var LimitTimeGUI::slot
+ *      The slot of the time line.
+ * @var LimitTimeGUI::x
+ *      The coordinate X of the time line.
+ * @var LimitTimeGUI::y
+ *      The coordinate Y of the time line.
+ * @var LimitTimeGUI::deadline
+ *      The time (from g_get_monotonic_time()) at which the time of the player
+ *      is over, 0 if the time line isn't running.
+ * @var LimitTimeGUI::timeoutId
+ *      The id of the timeout of gui_timer(), 0 if there isn't a timeout.
+ * @var LimitTimeGUI::isMapped
+ *      1 if the window of the table is displayed, 0 else.
+ */
 struct LimitTimeGUI {
-    GtkWidget *fixed;
-    GtkWidget *images[LENGTH_TIME_LINE];
+    struct TableRenderer *renderer;
+    int slot;
     int x;
     int y;
-    int lastImage;
+    gint64 deadline;
+    guint timeoutId;
+    int isMapped;
+};
+
+/**
+ * @brief The decisions which a robot is asked to make.
+ */
+enum BotDecision {BOT_BID = 0, BOT_CARD};
+
+/**
+ * @struct BotJob
+ *
+ * @brief The structure keeps a decision which a robot makes in a thread of
+ *        the pool of the table, until its result is applied in the main
+ *        loop.
+ *
+ * @var BotJob::decision
+ *      The decision which is made.
+ * @var BotJob::game
+ *      A copy of the game, on which thinks the robot.
+ * @var BotJob::roundId
+ *      The id of the round in which is made the decision.
+ * @var BotJob::playerId
+ *      The position of the robot in Game::players.
+ * @var BotJob::result
+ *      The bid or the id of the card, a negative value if the robot didn't
+ *      make the decision.
+ * @var BotJob::cancellable
+ *      It is cancelled when the table is closed.
+ */
+struct BotJob {
+    enum BotDecision decision;
+    struct Game *game;
+    int roundId;
+    int playerId;
+    int result;
+    GCancellable *cancellable;
 };
 
 struct GameGUI {
@@ -68,14 +272,17 @@ struct GameGUI {
     struct CardsFromTable *cardsFromTable;
     struct BidGUI *bidGUI;
     struct LimitTimeGUI *limitTimeGUI;
+    struct TableRenderer *renderer;
     GtkWidget *windowTable;
     GtkWidget *fixedTable;
     GtkWidget *buttonShowScore;
-    GtkWidget *imageTrump;
     GtkWidget *labelRoundType;
     GtkWidget *labelNoOfBids;
     GtkWidget *buttonStart;
-    GtkWidget *imagePlayerTurn;
+    int slotTrump;
+    int slotPlayerTurn;
+    GThreadPool *botPool;
+    GCancellable *botCancellable;
     int *noOfGames;
     int bidPlayerId;
     int cardPlayerId;
@@ -227,41 +434,245 @@ int gui_createButtonShowScore(GtkWidget *fixed, GtkWidget **showButton,
 /**
  * @brief Function get the name of a card.
  *
- * @param card Pointer to the card for which is got the name.
+ * @param card The card for which is got the name.
  * @param name Pointer to first position whence to be saved the card's name.
  *
  * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
  */
-int gui_getPictureName(struct Card *card, char *name);
+int gui_getPictureName(struct Card card, char *name);
+
+/**
+ * @brief Function get the path of the picture of a card.
+ *
+ * @param card The card for which is got the path or EMPTY_CARD for the back
+ *             of the cards.
+ * @param size The size of the picture.
+ * @param path Pointer to first position whence to be saved the path, it must
+ *             have at least 30 characters.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int gui_getCardPath(struct Card card, enum CardSize size, char *path);
+
+/**
+ * @brief Function decodes the pictures of all the cards at all the sizes.
+ *
+ * @return Pointer to the new CardImages on success, NULL on failure.
+ */
+struct CardImages *gui_createCardImages();
+
+/**
+ * @brief Function releases the pictures of a CardImages and makes the pointer
+ *        NULL.
+ *
+ * @param cardImages Pointer to pointer to the CardImages which will be
+ *                   removing.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int gui_deleteCardImages(struct CardImages **cardImages);
+
+/**
+ * @brief Function gets the decoded picture of a card.
+ *
+ * @param cardImages Pointer to the CardImages from which is got the picture.
+ * @param card The card or EMPTY_CARD for the back of the cards.
+ * @param size The size of the picture.
+ *
+ * @return Pointer to the picture, NULL if it doesn't exist.
+ */
+GdkPixbuf *gui_getCardPixbuf(const struct CardImages *cardImages,
+                             struct Card card, enum CardSize size);
+
+/**
+ * @brief Function puts the pictures of the cards and the other pictures of
+ *        the table in a new atlas. The pictures are put in rows, from left
+ *        to right, and a new row is started when a picture doesn't fit in
+ *        TABLE_ATLAS_WIDTH.
+ *
+ * @param cardImages Pointer to the CardImages with the pictures of the cards.
+ *
+ * @return Pointer to the new TableAtlas on success, NULL on failure.
+ */
+struct TableAtlas *gui_createTableAtlas(const struct CardImages *cardImages);
+
+/**
+ * @brief Function releases the surface of a TableAtlas and makes the pointer
+ *        NULL.
+ *
+ * @param atlas Pointer to pointer to the TableAtlas which will be removing.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int gui_deleteTableAtlas(struct TableAtlas **atlas);
+
+struct TableAtlas *gui_changeTableAtlas(const struct TableAtlas *atlas,
+                                        const int onlyReturn);
+
+void gui_setTableAtlas(const struct TableAtlas *atlas);
+
+struct TableAtlas *gui_getTableAtlas();
+
+struct BidTable *gui_changeBidTable(const struct BidTable *table,
+                                    const int onlyReturn);
+
+void gui_setBidTable(const struct BidTable *table);
+
+/**
+ * @brief Function gets the bid table of the robots, it is read only by the
+ *        robots, so it can be used from the threads in which they think.
+ *
+ * @return Pointer to the BidTable or NULL if it isn't loaded.
+ */
+struct BidTable *gui_getBidTable();
+
+/**
+ * @brief Function creates the renderer of a table and connects it to the
+ *        "expose-event" signal of the GtkFixed of the table.
+ *
+ * @param fixed Pointer to the GtkFixed of the table.
+ * @param atlas Pointer to the atlas from which are drawn the pictures.
+ * @param pathBackground The name of the picture of the background.
+ *
+ * @return Pointer to the new TableRenderer on success, NULL on failure.
+ */
+struct TableRenderer *gui_createTableRenderer(GtkWidget *fixed,
+                                              const struct TableAtlas *atlas,
+                                              const char *pathBackground);
+
+/**
+ * @brief Function disconnects a TableRenderer from its GtkFixed, frees it
+ *        and makes the pointer NULL.
+ *
+ * @param renderer Pointer to pointer to the TableRenderer which will be
+ *                 removing.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int gui_deleteTableRenderer(struct TableRenderer **renderer);
+
+/**
+ * @brief Function adds a hidden slot over the slots added before.
+ *
+ * @param renderer Pointer to the TableRenderer.
+ * @param x The coordinate X of the slot.
+ * @param y The coordinate Y of the slot.
+ *
+ * @return The id of the slot on success, a negative value (FULL if there are
+ *         TABLE_MAX_SLOTS slots) on failure.
+ */
+int gui_addTableSlot(struct TableRenderer *renderer, int x, int y);
+
+/**
+ * @brief Function changes the picture of a slot. If the slot is changed, the
+ *        rectangles in which it was and in which it is are drawn again, when
+ *        GTK is idle.
+ *
+ * @param renderer Pointer to the TableRenderer.
+ * @param slot The id of the slot.
+ * @param source The rectangle of the picture in the atlas.
+ * @param count How many times is drawn the picture, 0 to hide the slot.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int gui_setTableSlot(struct TableRenderer *renderer, int slot,
+                     const GdkRectangle *source, int count);
+
+/**
+ * @brief Function moves a slot.
+ *
+ * @param renderer Pointer to the TableRenderer.
+ * @param slot The id of the slot.
+ * @param x The new coordinate X of the slot.
+ * @param y The new coordinate Y of the slot.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int gui_moveTableSlot(struct TableRenderer *renderer, int slot, int x, int y);
+
+/**
+ * @brief Function hides a slot.
+ *
+ * @param renderer Pointer to the TableRenderer.
+ * @param slot The id of the slot.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int gui_hideTableSlot(struct TableRenderer *renderer, int slot);
+
+/**
+ * @brief Function displays a card in a slot.
+ *
+ * @param renderer Pointer to the TableRenderer.
+ * @param slot The id of the slot.
+ * @param card The card or EMPTY_CARD for the back of the cards.
+ * @param size The size of the picture.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int gui_setTableCard(struct TableRenderer *renderer, int slot,
+                     struct Card card, enum CardSize size);
+
+/**
+ * @brief Function displays a picture which isn't a card in a slot.
+ *
+ * @param renderer Pointer to the TableRenderer.
+ * @param slot The id of the slot.
+ * @param sprite The picture.
+ * @param count How many times is drawn the picture, 0 to hide the slot.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int gui_setTableSprite(struct TableRenderer *renderer, int slot,
+                       enum TableSprite sprite, int count);
+
+/**
+ * @brief Function draws the background and the slots of a table which are
+ *        in the region of an expose event. It is called before the children
+ *        of the GtkFixed are drawn.
+ *
+ * @param fixed Pointer to the GtkFixed of the table.
+ * @param event Pointer to the expose event.
+ * @param renderer Pointer to the TableRenderer.
+ *
+ * @return FALSE, so the children of the GtkFixed are drawn.
+ */
+gboolean gui_exposeTable(GtkWidget *fixed, GdkEventExpose *event,
+                         struct TableRenderer *renderer);
 
 /**
  * @brief Function initializes the trump on table.
  *
- * @param fixed Pointer to the fixed where will be displaying the trump.
- * @param image Pointer to pointer to image which will be displaying as trump.
+ * @param renderer Pointer to the renderer where will be displaying the trump.
+ * @param slot Pointer to the variable in which is saved the id of the slot
+ *             of the trump.
  *
  * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
  */
-int gui_initTrump(GtkWidget *fixed, GtkWidget **image);
+int gui_initTrump(struct TableRenderer *renderer, int *slot);
 
 /**
  * @brief Function hides the trump.
  *
- * @param image Pointer to the image which will be hiding.
+ * @param renderer Pointer to the renderer of the table.
+ * @param slot The id of the slot of the trump.
  *
  * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
  */
-int gui_hideTrump(GtkWidget *image);
+int gui_hideTrump(struct TableRenderer *renderer, int slot);
 
 /**
  * @brief Function displays the trump.
  *
- * @param trump Pointer to the card which is trump.
- * @param image Pointer to the image which will be displaying as trump.
+ * @param trump The card which is trump or EMPTY_CARD if the round doesn't
+ *              have a trump.
+ * @param renderer Pointer to the renderer of the table.
+ * @param slot The id of the slot of the trump.
  *
  * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
  */
-int gui_showTrump(struct Card *trump, GtkWidget *image);
+int gui_showTrump(struct Card trump, struct TableRenderer *renderer,
+                  int slot);
 
 /**
  * @brief Function frees a pointer to PlayerCards and makes him NULL.
@@ -276,11 +687,12 @@ int gui_deletePlayerCards(struct PlayerCards **playerCards);
 /**
  * @brief Function creates and initializes a PlayerCards structure.
  *
- * @param fixed Pointer to the fixed in which will be displaying player cards.
+ * @param renderer Pointer to the renderer in which will be displaying player
+ *                 cards.
  *
  * @return Pointer to the PlayerCards structure on success, NULL on failure.
  */
-struct PlayerCards *gui_initializePlayerCards(GtkWidget *fixed);
+struct PlayerCards *gui_initializePlayerCards(struct TableRenderer *renderer);
 
 /**
  * @brief Function hides the player cards.
@@ -292,7 +704,9 @@ struct PlayerCards *gui_initializePlayerCards(GtkWidget *fixed);
 int gui_hidePlayerCards(struct PlayerCards *playerCards);
 
 /**
- * @brief Function displays the player cards.
+ * @brief Function displays the player cards. The slots after the last card
+ *        are hidden, so the cards can be displayed again after a card is
+ *        played without hiding them.
  *
  * @param playerCards Pointer to the PlayerCards structure which be displaying.
  * @param player Pointer to the player for which are displayed the cards.
@@ -350,14 +764,14 @@ int gui_getCardId(int x, int y);
  *              get the coordinates of mouse.
  * @param gameGUI Pointer to the GameGUI.
  */
-int gui_clickMouse(GtkWidget *window, GdkEvent *event, struct GameGUI *gameGUI);
+int gui_clickMouse(GtkWidget *window, GdkEvent *event, struct GameGUI *gameGUI);
 
-void gui_setGameGUI(const struct GameGUI* gameGUI);
-
-struct GameGUI* gui_getGameGUI();
+void gui_setGameGUI(const struct GameGUI* gameGUI);
 
-struct Select *gui_createSelect(GtkWidget *fixed, struct Player *player,
-                                struct Game *game);
+struct GameGUI* gui_getGameGUI();
+
+struct Select *gui_createSelect(struct TableRenderer *renderer,
+                                struct Player *player, struct Game *game);
 
 int gui_selectedCard(struct Select *select);
 
@@ -366,6 +780,7 @@ int gui_moveMouse(GtkWidget *window, GdkEvent *event, struct Select *select);
 struct PlayersGUI *gui_createPlayersGUI();
 
 int gui_showPlayers(struct Game *game, GtkWidget *fixed,
+                    struct TableRenderer *renderer,
                     struct PlayersGUI *playersGUI);
 
 int gui_showInformationsPlayers(struct PlayersGUI *playersGUI,
@@ -376,7 +791,7 @@ struct CardsFromTable *gui_createCardsFromTable();
 int gui_deleteCardsFromTable(struct CardsFromTable **cardsFromTable);
 
 int gui_initCardsFromTable(struct CardsFromTable *cardsFromTable,
-                           GtkWidget *fixed);
+                           struct TableRenderer *renderer);
 
 int gui_hideCardsFromTable(struct CardsFromTable *cardsFromTable);
 
@@ -401,7 +816,8 @@ struct BidGUI *gui_createBidGUI();
 
 int gui_deleteBidGUI(struct BidGUI **bidGUI);
 
-int gui_initBidGUI(struct BidGUI *bidGUI, GtkWidget *fixed);
+int gui_initBidGUI(struct BidGUI *bidGUI, GtkWidget *fixed,
+                   struct TableRenderer *renderer);
 
 int gui_showBidGUI(struct BidGUI *bidGUI, struct Round *round,
                    struct Player *player);
@@ -432,6 +848,84 @@ int gui_startHand(struct GameGUI *gameGUI, int winnerPlayerId);
 
 gboolean gui_endHand(gpointer data);
 
+/**
+ * @brief Function creates the job of a robot which bids or plays a card now,
+ *        with a copy of the game.
+ *
+ * @param gameGUI Pointer to the GameGUI.
+ * @param decision The decision which the robot makes.
+ *
+ * @return Pointer to the new BotJob on success, NULL on failure.
+ */
+struct BotJob *gui_createBotJob(struct GameGUI *gameGUI,
+                                enum BotDecision decision);
+
+/**
+ * @brief Function releases a BotJob, with its copy of the game, and makes
+ *        the pointer NULL.
+ *
+ * @param job Pointer to pointer to the BotJob which will be removing.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int gui_deleteBotJob(struct BotJob **job);
+
+/**
+ * @brief Function is called in a thread of the pool, the robot makes the
+ *        decision of a BotJob and the job is sent back to the main loop
+ *        with an idle callback (gui_finishBotJob()).
+ *
+ * @param data Pointer to the BotJob.
+ * @param unused The data of the pool.
+ */
+void gui_thinkBot(gpointer data, gpointer unused);
+
+/**
+ * @brief Function is called in the main loop when a robot made a decision.
+ *        The decision is applied if the table wasn't closed and if the game
+ *        still waits for it, then the BotJob is released.
+ *
+ * @param data Pointer to the BotJob.
+ *
+ * @return FALSE, so the callback is called once.
+ */
+gboolean gui_finishBotJob(gpointer data);
+
+/**
+ * @brief Function asks the robot which bids or plays now to make its
+ *        decision in the pool of the table, without waiting for it.
+ *
+ * @param gameGUI Pointer to the GameGUI.
+ * @param decision The decision which the robot makes.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int gui_startBotJob(struct GameGUI *gameGUI, enum BotDecision decision);
+
+/**
+ * @brief Function places the bid of the robot which bids now and asks the
+ *        next robot, if the next player isn't the user. It places also the
+ *        bid chosen for the user when his time is up.
+ *
+ * @param gameGUI Pointer to the GameGUI.
+ * @param bid The bid of the robot.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int gui_placeBotBid(struct GameGUI *gameGUI, int bid);
+
+/**
+ * @brief Function plays the card of the robot which plays now and asks the
+ *        next robot, if the next player isn't the user. It plays also the
+ *        card chosen for the user when his time is up.
+ *
+ * @param gameGUI Pointer to the GameGUI.
+ * @param cardId The position of the card in the hand of the robot.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int gui_playBotCard(struct GameGUI *gameGUI, int cardId);
+
 gboolean gui_botChooseBid(gpointer data);
 
 gboolean gui_chooseBidForBots(struct GameGUI *gameGUI, int leftLimit,
@@ -444,7 +938,8 @@ gboolean gui_chooseCardForBots(struct GameGUI *gameGUI, int leftLimit,
 
 int gui_showPlayerTurn(struct GameGUI *gameGUI, int playerId);
 
-struct LimitTimeGUI *gui_createLimitTimeGUI(GtkWidget *fixed, int x, int y);
+struct LimitTimeGUI *gui_createLimitTimeGUI(struct TableRenderer *renderer,
+                                           int x, int y);
 
 int gui_deleteLimitTimeGUI(struct LimitTimeGUI **limitTimeGUI);
 
@@ -452,14 +947,75 @@ int gui_showLimitTimeGUI(struct LimitTimeGUI *limitTimeGUI);
 
 int gui_hideLimitTimeGUI(struct LimitTimeGUI *limitTimeGUI);
 
-int gui_initLimitTimeGUI(struct LimitTimeGUI *limitTimeGUI, char *pathImage);
+int gui_initLimitTimeGUI(struct LimitTimeGUI *limitTimeGUI);
+
+/**
+ * @brief Function determines how many images of the time line are displayed
+ *        at a time.
+ *
+ * @param limitTimeGUI Pointer to the LimitTimeGUI.
+ * @param now The time, from g_get_monotonic_time().
+ *
+ * @return A value between 0 and LENGTH_TIME_LINE on success, a negative
+ *         value on failure.
+ */
+int gui_getLimitTimeImages(const struct LimitTimeGUI *limitTimeGUI,
+                           gint64 now);
+
+/**
+ * @brief Function displays the images of the time line which are left now.
+ *        Nothing is drawn if the window of the table isn't displayed.
+ *
+ * @param limitTimeGUI Pointer to the LimitTimeGUI.
+ *
+ * @return The number of the images left on success, a negative value on
+ *         failure.
+ */
+int gui_updateLimitTimeGUI(struct LimitTimeGUI *limitTimeGUI);
+
+/**
+ * @brief Function adds the timeout of gui_timer() for the moment when the
+ *        next image of the time line disappears or, if the window of the
+ *        table isn't displayed, for the deadline. The previous timeout is
+ *        removed.
+ *
+ * @param limitTimeGUI Pointer to the LimitTimeGUI.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int gui_scheduleLimitTimeGUI(struct LimitTimeGUI *limitTimeGUI);
+
+/**
+ * @brief Function is called when the window of the table is displayed, the
+ *        time line is updated and its timer wakes up again for every image.
+ */
+gboolean gui_mapLimitTimeGUI(GtkWidget *window, GdkEvent *event,
+                             struct LimitTimeGUI *limitTimeGUI);
 
-int gui_hideLastImageFromLimitTimeGUI(struct LimitTimeGUI *limitTimeGUI);
+/**
+ * @brief Function is called when the window of the table is hidden or
+ *        minimized, the timer of the time line wakes up only at the
+ *        deadline.
+ */
+gboolean gui_unmapLimitTimeGUI(GtkWidget *window, GdkEvent *event,
+                               struct LimitTimeGUI *limitTimeGUI);
 
 int gui_startTime(struct GameGUI *gameGUI);
 
 gboolean gui_timer(gpointer data);
 
+/**
+ * @brief Function decodes a picture from the resource bundle of the program,
+ *        from the memory of the program, without files. The resource is
+ *        found with the hash table built by glib-compile-resources.
+ *
+ * @param name The name of the picture, its path from the directory src (for
+ *             example "pictures/table.png").
+ *
+ * @return Pointer to the new picture on success, NULL on failure.
+ */
+GdkPixbuf *gui_pixbufNewFromFile(const char *name);
+
 GtkWidget *gui_imageNewFromFile(const char *name);
 
 void gui_imageSetFromFile(GtkWidget* image, const char* name);
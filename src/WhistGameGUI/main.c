@@ -37,28 +37,31 @@ int InitWhistGame(const char *name, int gameType, int noOfBots, int *noOfGames)
 
     gui_init(&(gameGUI->windowTable), &(gameGUI->fixedTable),
              "Whist", 798, 520);
-    gui_setBackground(gameGUI->fixedTable, "pictures/table.png");
+    gameGUI->renderer = gui_createTableRenderer(gameGUI->fixedTable,
+                                                gui_getTableAtlas(),
+                                                "pictures/table.png");
     gui_createButtonShowScore(gameGUI->fixedTable, &(gameGUI->buttonShowScore),
                               gameGUI->game);
 
-    gui_initTrump(gameGUI->fixedTable, &(gameGUI->imageTrump));
-    gui_showTrump(NULL, gameGUI->imageTrump);
+    gui_initTrump(gameGUI->renderer, &(gameGUI->slotTrump));
+    gui_showTrump(EMPTY_CARD, gameGUI->renderer, gameGUI->slotTrump);
 
     gameGUI->bidGUI = gui_createBidGUI();
-    gui_initBidGUI(gameGUI->bidGUI, gameGUI->fixedTable);
+    gui_initBidGUI(gameGUI->bidGUI, gameGUI->fixedTable, gameGUI->renderer);
 
-    gameGUI->playerCards = gui_initializePlayerCards(gameGUI->fixedTable);
+    gameGUI->playerCards = gui_initializePlayerCards(gameGUI->renderer);
 
     gui_initNoOfBidsLabel(&(gameGUI->labelNoOfBids), gameGUI->fixedTable);
     gui_initRoundTypeLabel(&(gameGUI->labelRoundType), gameGUI->fixedTable);
 
     gameGUI->playersGUI = gui_createPlayersGUI();
-    gui_showPlayers(gameGUI->game, gameGUI->fixedTable, gameGUI->playersGUI);
+    gui_showPlayers(gameGUI->game, gameGUI->fixedTable, gameGUI->renderer,
+                    gameGUI->playersGUI);
 
     gameGUI->cardsFromTable = gui_createCardsFromTable();
-    gui_initCardsFromTable(gameGUI->cardsFromTable, gameGUI->fixedTable);
+    gui_initCardsFromTable(gameGUI->cardsFromTable, gameGUI->renderer);
 
-    gameGUI->select = gui_createSelect(gameGUI->fixedTable,
+    gameGUI->select = gui_createSelect(gameGUI->renderer,
                                        gameGUI->game->players[0],
                                        gameGUI->game);
 
@@ -73,13 +76,16 @@ int InitWhistGame(const char *name, int gameType, int noOfBots, int *noOfGames)
 
     gui_createButtonStart(gameGUI);
 
-    gameGUI->imagePlayerTurn = gui_imageNewFromFile("pictures/playerTurn.png");
-    gtk_fixed_put(GTK_FIXED(gameGUI->fixedTable),
-                  gameGUI->imagePlayerTurn, 0, 0);
+    gameGUI->slotPlayerTurn = gui_addTableSlot(gameGUI->renderer, 0, 0);
 
-    gameGUI->limitTimeGUI = gui_createLimitTimeGUI(gameGUI->fixedTable,
-                                                   310, 526);
-    gui_initLimitTimeGUI(gameGUI->limitTimeGUI, "pictures/limit_time.png");
+    gameGUI->limitTimeGUI = gui_createLimitTimeGUI(gameGUI->renderer,
+                                                   25, 378);
+    gui_initLimitTimeGUI(gameGUI->limitTimeGUI);
+    g_signal_connect(G_OBJECT(gameGUI->windowTable), "map-event",
+                     G_CALLBACK(gui_mapLimitTimeGUI), gameGUI->limitTimeGUI);
+    g_signal_connect(G_OBJECT(gameGUI->windowTable), "unmap-event",
+                     G_CALLBACK(gui_unmapLimitTimeGUI),
+                     gameGUI->limitTimeGUI);
 
     gtk_main();
 
@@ -137,6 +143,31 @@ int main(int argc, char *argv[])
 
     gtk_init(&argc, &argv);
 
+    /* The pictures of the table are decoded once and put in an atlas, the
+     * tables of all the games draw them from it. */
+    struct CardImages *cardImages = gui_createCardImages();
+    gui_setTableAtlas(gui_createTableAtlas(cardImages));
+    gui_deleteCardImages(&cardImages);
+
+    /* Without the atlas no table can be drawn, so the game can't start. */
+    if (gui_getTableAtlas() == NULL) {
+        GtkWidget *dialog;
+        dialog = gtk_message_dialog_new(NULL, GTK_DIALOG_MODAL,
+                                        GTK_MESSAGE_ERROR, GTK_BUTTONS_OK,
+                                        "The pictures of the cards could not "
+                                        "be loaded.");
+        gtk_window_set_title(GTK_WINDOW(dialog), "Error");
+        gtk_dialog_run(GTK_DIALOG(dialog));
+        gtk_widget_destroy(dialog);
+        free(input);
+
+        return EXIT_FAILURE;
+    }
+
+    /* The robots bid from the table generated with whist-sim when it is
+     * found, else they bid with robot_getBid(). */
+    gui_setBidTable(bidtable_loadBidTable(BID_TABLE_FILE));
+
     GtkWidget *splash;
     GtkWidget *splashFixed;
     guint time = 5;
@@ -169,6 +200,16 @@ int main(int argc, char *argv[])
 
     gtk_main();
 
+    struct TableAtlas *atlas = gui_getTableAtlas();
+    if (atlas != NULL) {
+        gui_setTableAtlas(NULL);
+        gui_deleteTableAtlas(&atlas);
+    }
+    struct BidTable *bidTable = gui_getBidTable();
+    if (bidTable != NULL) {
+        gui_setBidTable(NULL);
+        bidtable_deleteBidTable(&bidTable);
+    }
     free(input);
 
     return EXIT_SUCCESS;
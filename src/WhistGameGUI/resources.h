@@ -1,123 +0,0 @@
-#ifndef RESOURCES_H_INCLUDED
-#define RESOURCES_H_INCLUDED
-
-#define ID_pictures_bid_png	            0x1002
-#define ID_pictures_limit_time_png	    0x1003
-#define ID_pictures_logo_game_png	    0x1004
-#define ID_pictures_player_png	            0x1005
-#define ID_pictures_playerTurn_png	    0x1006
-#define ID_pictures_score_png	            0x1007
-#define ID_pictures_select_bid_png	    0x1008
-#define ID_pictures_select_card_png  	    0x1009
-#define ID_pictures_splash_screen_jpg	    0x100A
-#define ID_pictures_table_png	            0x100B
-#define ID_pictures_45x60_10A_jpg	    0x100C
-#define ID_pictures_45x60_10B_jpg	    0x100D
-#define ID_pictures_45x60_10C_jpg	    0x100E
-#define ID_pictures_45x60_10D_jpg	    0x100F
-#define ID_pictures_45x60_12A_jpg	    0x1010
-#define ID_pictures_45x60_12B_jpg	    0x1011
-#define ID_pictures_45x60_12C_jpg	    0x1012
-#define ID_pictures_45x60_12D_jpg	    0x1013
-#define ID_pictures_45x60_13A_jpg   	    0x1014
-#define ID_pictures_45x60_13B_jpg	    0x1015
-#define ID_pictures_45x60_13C_jpg	    0x1016
-#define ID_pictures_45x60_13D_jpg	    0x1017
-#define ID_pictures_45x60_14A_jpg	    0x1018
-#define ID_pictures_45x60_14B_jpg	    0x1019
-#define ID_pictures_45x60_14C_jpg	    0x101A
-#define ID_pictures_45x60_14D_jpg	    0x101B
-#define ID_pictures_45x60_15A_jpg	    0x101C
-#define ID_pictures_45x60_15B_jpg	    0x101D
-#define ID_pictures_45x60_15C_jpg	    0x101E
-#define ID_pictures_45x60_15D_jpg	    0x101F
-#define ID_pictures_45x60_2A_jpg	    0x1020
-#define ID_pictures_45x60_2B_jpg	    0x1021
-#define ID_pictures_45x60_2C_jpg	    0x1022
-#define ID_pictures_45x60_2D_jpg	    0x1023
-#define ID_pictures_45x60_3A_jpg	    0x1024
-#define ID_pictures_45x60_3B_jpg	    0x1025
-#define ID_pictures_45x60_3C_jpg	    0x1026
-#define ID_pictures_45x60_3D_jpg	    0x1027
-#define ID_pictures_45x60_45x60_jpg	    0x1028
-#define ID_pictures_45x60_4A_jpg	    0x1029
-#define ID_pictures_45x60_4B_jpg	    0x102A
-#define ID_pictures_45x60_4C_jpg	    0x102B
-#define ID_pictures_45x60_4D_jpg	    0x102C
-#define ID_pictures_45x60_5A_jpg	    0x102D
-#define ID_pictures_45x60_5B_jpg	    0x102E
-#define ID_pictures_45x60_5C_jpg	    0x102F
-#define ID_pictures_45x60_5D_jpg	    0x1030
-#define ID_pictures_45x60_6A_jpg	    0x1031
-#define ID_pictures_45x60_6B_jpg	    0x1032
-#define ID_pictures_45x60_6C_jpg	    0x1033
-#define ID_pictures_45x60_6D_jpg	    0x1034
-#define ID_pictures_45x60_7A_jpg	    0x1035
-#define ID_pictures_45x60_7B_jpg	    0x1036
-#define ID_pictures_45x60_7C_jpg	    0x1037
-#define ID_pictures_45x60_7D_jpg	    0x1038
-#define ID_pictures_45x60_8A_jpg	    0x1039
-#define ID_pictures_45x60_8B_jpg	    0x103A
-#define ID_pictures_45x60_8C_jpg	    0x103B
-#define ID_pictures_45x60_8D_jpg	    0x103C
-#define ID_pictures_45x60_9A_jpg	    0x103D
-#define ID_pictures_45x60_9B_jpg	    0x103E
-#define ID_pictures_45x60_9C_jpg	    0x103F
-#define ID_pictures_45x60_9D_jpg	    0x1040
-#define ID_pictures_80x110_10A_jpg	    0x1041
-#define ID_pictures_80x110_10B_jpg	    0x1042
-#define ID_pictures_80x110_10C_jpg	    0x1043
-#define ID_pictures_80x110_10D_jpg	    0x1044
-#define ID_pictures_80x110_12A_jpg	    0x1045
-#define ID_pictures_80x110_12B_jpg	    0x1046
-#define ID_pictures_80x110_12C_jpg	    0x1047
-#define ID_pictures_80x110_12D_jpg	    0x1048
-#define ID_pictures_80x110_13A_jpg	    0x1049
-#define ID_pictures_80x110_13B_jpg	    0x104A
-#define ID_pictures_80x110_13C_jpg	    0x104B
-#define ID_pictures_80x110_13D_jpg	    0x104C
-#define ID_pictures_80x110_14A_jpg	    0x104D
-#define ID_pictures_80x110_14B_jpg  	    0x104E
-#define ID_pictures_80x110_14C_jpg	    0x104F
-#define ID_pictures_80x110_14D_jpg	    0x1050
-#define ID_pictures_80x110_15A_jpg	    0x1051
-#define ID_pictures_80x110_15B_jpg	    0x1052
-#define ID_pictures_80x110_15C_jpg	    0x1053
-#define ID_pictures_80x110_15D_jpg  	    0x1054
-#define ID_pictures_80x110_2A_jpg	    0x1055
-#define ID_pictures_80x110_2B_jpg	    0x1056
-#define ID_pictures_80x110_2C_jpg	    0x1057
-#define ID_pictures_80x110_2D_jpg	    0x1058
-#define ID_pictures_80x110_3A_jpg	    0x1059
-#define ID_pictures_80x110_3B_jpg	    0x105A
-#define ID_pictures_80x110_3C_jpg	    0x105B
-#define ID_pictures_80x110_3D_jpg	    0x105C
-#define ID_pictures_80x110_4A_jpg	    0x105D
-#define ID_pictures_80x110_4B_jpg	    0x105E
-#define ID_pictures_80x110_4C_jpg   	    0x105F
-#define ID_pictures_80x110_4D_jpg   	    0x1060
-#define ID_pictures_80x110_5A_jpg	    0x1061
-#define ID_pictures_80x110_5B_jpg	    0x1062
-#define ID_pictures_80x110_5C_jpg   	    0x1063
-#define ID_pictures_80x110_5D_jpg	    0x1064
-#define ID_pictures_80x110_6A_jpg	    0x1065
-#define ID_pictures_80x110_6B_jpg	    0x1066
-#define ID_pictures_80x110_6C_jpg	    0x1067
-#define ID_pictures_80x110_6D_jpg	    0x1068
-#define ID_pictures_80x110_7A_jpg	    0x1069
-#define ID_pictures_80x110_7B_jpg	    0x106A
-#define ID_pictures_80x110_7C_jpg	    0x106B
-#define ID_pictures_80x110_7D_jpg	    0x106C
-#define ID_pictures_80x110_80x110_jpg	    0x106D
-#define ID_pictures_80x110_8A_jpg	    0x106E
-#define ID_pictures_80x110_8B_jpg	    0x106F
-#define ID_pictures_80x110_8C_jpg	    0x1070
-#define ID_pictures_80x110_8D_jpg	    0x1071
-#define ID_pictures_80x110_9A_jpg	    0x1072
-#define ID_pictures_80x110_9B_jpg	    0x1073
-#define ID_pictures_80x110_9C_jpg	    0x1074
-#define ID_pictures_80x110_9D_jpg	    0x1075
-#define ID_pictures_positive_reward_png     0x1076
-#define ID_pictures_negative_reward_png     0x1077
-
-#endif // RESOURCES_H_INCLUDED
@@ -0,0 +1,639 @@
+/**
+ * @file main.c
+ * @brief Command-line simulator which plays robot-only games on all the
+ *        processors and prints the throughput and the statistics of the
+ *        scores.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <libWhistGame.h>
+#include <libWhistGameAI.h>
+
+#include <pthread.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * @brief The maximum number of threads on which the simulator can use them.
+ */
+#define MAX_THREADS 256
+
+/**
+ * @brief The bid table generated by a thread has 2 to the power
+ *        BID_TABLE_BITS entries.
+ */
+#define BID_TABLE_BITS 20
+
+/**
+ * @enum Robot
+ *
+ * @brief The robots which can play instead of the first heuristic robot.
+ */
+enum Robot {HEURISTIC_ROBOT = 0, PIMC_ROBOT, ISMCTS_ROBOT};
+
+/**
+ * @struct Options
+ *
+ * @brief Options structure. Structure used to keep the options from command
+ *        line.
+ *
+ * @var Options::playersNumber
+ *      The number of the players from every game (3 - 6).
+ * @var Options::gameType
+ *      The type of the games (1 or 8).
+ * @var Options::gamesNumber
+ *      The number of the games which are played.
+ * @var Options::threadsNumber
+ *      The number of the threads which play the games.
+ * @var Options::seed
+ *      The seed of the first game, the game i is played with seed + i.
+ * @var Options::robot
+ *      The robot which plays instead of the first heuristic robot (one of
+ *      Robot).
+ * @var Options::milliseconds
+ *      The time of a decision of the first robot, if it isn't heuristic.
+ * @var Options::robotThreads
+ *      The number of the threads of the first robot of every thread, if it
+ *      isn't heuristic.
+ * @var Options::parallelMode
+ *      The way in which the threads of the ISMCTS robot share the search.
+ * @var Options::bidTable
+ *      The table from which the first robot bids or NULL.
+ * @var Options::bidTablePath
+ *      The file in which is written the bid table generated from the games
+ *      or NULL.
+ */
+struct Options {
+    int playersNumber;
+    int gameType;
+    long gamesNumber;
+    int threadsNumber;
+    uint64_t seed;
+    int robot;
+    int milliseconds;
+    int robotThreads;
+    enum IsmctsMode parallelMode;
+    struct BidTable *bidTable;
+    const char *bidTablePath;
+};
+
+/**
+ * @struct Statistics
+ *
+ * @brief Statistics structure. Structure used to keep the results of the
+ *        games played by a thread. The players are identified by their
+ *        position at table.
+ *
+ * @var Statistics::gamesNumber
+ *      The number of the games played.
+ * @var Statistics::roundsNumber
+ *      The number of the rounds played, the repeated rounds included.
+ * @var Statistics::handsNumber
+ *      The number of the hands played.
+ * @var Statistics::points
+ *      The sum of the final scores of every player.
+ * @var Statistics::squares
+ *      The sum of the squares of the final scores of every player.
+ * @var Statistics::wins
+ *      The number of the games won by every player, a game with more winners
+ *      is counted for all of them.
+ * @var Statistics::decisionsNumber
+ *      The number of the decisions of the first robot, if it isn't
+ *      heuristic.
+ * @var Statistics::samplesNumber
+ *      The number of the worlds solved by the Monte Carlo robot or of the
+ *      playouts of the ISMCTS robot.
+ * @var Statistics::seconds
+ *      The time of the decisions of the first robot.
+ * @var Statistics::maxSeconds
+ *      The time of the longest decision of the first robot.
+ */
+struct Statistics {
+    long gamesNumber;
+    long roundsNumber;
+    long handsNumber;
+    double points[MAX_GAME_PLAYERS];
+    double squares[MAX_GAME_PLAYERS];
+    long wins[MAX_GAME_PLAYERS];
+    long decisionsNumber;
+    long samplesNumber;
+    double seconds;
+    double maxSeconds;
+};
+
+/**
+ * @struct Worker
+ *
+ * @brief Worker structure. Structure used to keep the data of a thread.
+ *
+ * @var Worker::options
+ *      Pointer to the options of the simulator.
+ * @var Worker::firstGame
+ *      The index of the first game played by the thread, the thread plays
+ *      the games firstGame, firstGame + threadsNumber, ...
+ * @var Worker::statistics
+ *      The results of the games played by the thread.
+ * @var Worker::pimc
+ *      The Monte Carlo robot of the thread or NULL.
+ * @var Worker::ismcts
+ *      The ISMCTS robot of the thread or NULL.
+ * @var Worker::bidTable
+ *      The bid table generated by the thread or NULL.
+ * @var Worker::keys
+ *      The keys of the hands with which the players bid in the current round.
+ * @var Worker::droppedNumber
+ *      The number of the rounds which didn't fit in the bid table.
+ * @var Worker::error
+ *      FUNCTION_NO_ERROR or the first error on which the thread got it.
+ */
+struct Worker {
+    const struct Options *options;
+    long firstGame;
+    struct Statistics statistics;
+    struct Pimc *pimc;
+    struct Ismcts *ismcts;
+    struct BidTable *bidTable;
+    uint64_t keys[MAX_GAME_PLAYERS];
+    long droppedNumber;
+    int error;
+};
+
+static int sim_getBid(const struct Player* player, const struct Round* round,
+                      void* data)
+{
+    struct Worker *worker = data;
+    if (worker->bidTable != NULL) {
+        int playerId = round_getPlayerId(round, player);
+        if (playerId >= 0)
+            bidtable_getKey(player, round, &(worker->keys[playerId]));
+    }
+
+    if (worker->options->bidTable != NULL && player->seat == 0)
+        return bidtable_getBid(worker->options->bidTable, player, round);
+    if (worker->ismcts != NULL && player->seat == 0)
+        return ismcts_getBid(worker->ismcts, player, round,
+                             worker->options->milliseconds);
+
+    return robot_getBid(player, round);
+}
+
+static int sim_getCardId(const struct Player* player,
+                         const struct Round* round, void* data)
+{
+    struct Worker *worker = data;
+    if (worker->pimc != NULL && player->seat == 0)
+        return pimc_getCardId(worker->pimc, player, round,
+                              worker->options->milliseconds);
+    if (worker->ismcts != NULL && player->seat == 0)
+        return ismcts_getCardId(worker->ismcts, player, round,
+                                worker->options->milliseconds);
+
+    return robot_getCardId(player, round);
+}
+
+static void sim_endHand(const struct Game* game, int roundId, void* data)
+{
+    struct Worker *worker = data;
+    worker->statistics.handsNumber++;
+    if (worker->bidTable == NULL)
+        return;
+
+    /* After the last hand of a round the hands won by the players are added
+     * in the bid table, the repeated rounds included. */
+    const struct Round *round = game->rounds[roundId];
+    int handsNumber = 0;
+    for (int i = 0; i < round->playersNumber; i++)
+        handsNumber += round->handsNumber[i];
+    if (handsNumber < round->roundType)
+        return;
+
+    for (int i = 0; i < round->playersNumber; i++)
+        if (bidtable_addSample(worker->bidTable, worker->keys[i],
+                               round->handsNumber[i]) != FUNCTION_NO_ERROR)
+            worker->droppedNumber++;
+}
+
+static void sim_endRound(const struct Game* game, int roundId, void* data)
+{
+    (void)game;
+    (void)roundId;
+
+    ((struct Worker*)data)->statistics.roundsNumber++;
+}
+
+/**
+ * @brief Function prepares a game with robots only for a seed.
+ */
+static int sim_initializeGame(struct Game* game, const struct Options* options,
+                              uint64_t seed)
+{
+    int check = game_reinitializeGame(game, options->gameType);
+    if (check != FUNCTION_NO_ERROR)
+        return check;
+
+    for (int i = 0; i < options->playersNumber; i++) {
+        char name[MAX_NAME_LENGTH + 1];
+        snprintf(name, sizeof(name), "robot%d", i + 1);
+
+        struct Player *player = player_createPlayer(name, 0);
+        check = game_addPlayer(game, &player);
+        if (check != FUNCTION_NO_ERROR) {
+            player_deletePlayer(&player);
+            return check;
+        }
+    }
+
+    game_setSeed(game, seed);
+
+    check = game_createAndAddRounds(game);
+    if (check != FUNCTION_NO_ERROR)
+        return check;
+
+    return game_addPlayersInAllRounds(game);
+}
+
+/**
+ * @brief Function adds the final scores of a game in statistics.
+ */
+static void sim_addScores(struct Statistics* statistics,
+                          const struct Game* game)
+{
+    const struct Round *round = game->rounds[game_getRoundsNumber(game) - 1];
+
+    int max = round->pointsNumber[0];
+    for (int i = 0; i < game->playersNumber; i++)
+        if (round->pointsNumber[i] > max)
+            max = round->pointsNumber[i];
+
+    /* The players of the round are in the order in which they bid, the
+     * statistics are kept by the position of the player in game. */
+    for (int i = 0; i < game->playersNumber; i++) {
+        int position = game_getPlayerPosition(game, round->players[i]);
+        if (position < 0)
+            continue;
+        double points = round->pointsNumber[i];
+        statistics->points[position]  += points;
+        statistics->squares[position] += points * points;
+        if (round->pointsNumber[i] == max)
+            statistics->wins[position]++;
+    }
+
+    statistics->gamesNumber++;
+}
+
+static void *sim_runWorker(void* data)
+{
+    struct Worker *worker = data;
+    const struct Options *options = worker->options;
+
+    struct Game *game = game_createGame(options->gameType);
+    if (game == NULL) {
+        worker->error = ALLOCATION_FAILED;
+        return NULL;
+    }
+
+    uint64_t seed = options->seed + worker->firstGame;
+    if (options->robot == PIMC_ROBOT)
+        worker->pimc = pimc_createPimc(options->robotThreads, seed);
+    if (options->robot == ISMCTS_ROBOT)
+        worker->ismcts = ismcts_createIsmcts(options->robotThreads,
+                                             options->parallelMode, seed);
+    if (options->bidTablePath != NULL)
+        worker->bidTable = bidtable_createBidTable(BID_TABLE_BITS);
+    if ((options->robot != HEURISTIC_ROBOT && worker->pimc == NULL &&
+         worker->ismcts == NULL) ||
+        (options->bidTablePath != NULL && worker->bidTable == NULL)) {
+        pimc_deletePimc(&(worker->pimc));
+        ismcts_deleteIsmcts(&(worker->ismcts));
+        game_deleteGame(&game);
+        worker->error = ALLOCATION_FAILED;
+        return NULL;
+    }
+
+    struct GameCallbacks callbacks = {
+        sim_getBid, sim_getCardId, sim_endHand, sim_endRound, worker
+    };
+
+    for (long i = worker->firstGame; i < options->gamesNumber;
+         i += options->threadsNumber) {
+        int check = sim_initializeGame(game, options, options->seed + i);
+        if (check == FUNCTION_NO_ERROR)
+            check = game_run(game, &callbacks);
+        if (check != FUNCTION_NO_ERROR) {
+            worker->error = check;
+            break;
+        }
+
+        sim_addScores(&(worker->statistics), game);
+    }
+
+    game_deleteGame(&game);
+
+    struct Statistics *statistics = &(worker->statistics);
+    if (worker->pimc != NULL) {
+        statistics->decisionsNumber = worker->pimc->decisionsNumber;
+        statistics->samplesNumber   = worker->pimc->worldsNumber;
+        statistics->seconds         = worker->pimc->seconds;
+        statistics->maxSeconds      = worker->pimc->maxSeconds;
+        pimc_deletePimc(&(worker->pimc));
+    }
+    if (worker->ismcts != NULL) {
+        statistics->decisionsNumber = worker->ismcts->decisionsNumber;
+        statistics->samplesNumber   = worker->ismcts->playoutsNumber;
+        statistics->seconds         = worker->ismcts->seconds;
+        statistics->maxSeconds      = worker->ismcts->maxSeconds;
+        ismcts_deleteIsmcts(&(worker->ismcts));
+    }
+
+    return NULL;
+}
+
+static double sim_getTime()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+
+    return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+static void sim_printUsage(const char* name)
+{
+    fprintf(stderr,
+            "Usage: %s [-p players] [-t type] [-g games] [-s seed] "
+            "[-j threads] [-a robot] [-m milliseconds] [-n threads] "
+            "[-r mode] [-b file] [-w file]\n"
+            "  -p  number of players, 3 - 6 (default 4)\n"
+            "  -t  game type, 1 (1-8-1) or 8 (8-1-8) (default 1)\n"
+            "  -g  number of games (default 100000)\n"
+            "  -s  seed of the first game (default random)\n"
+            "  -j  number of threads (default number of processors)\n"
+            "  -a  the first robot: heuristic, pimc (Monte Carlo) or\n"
+            "      ismcts (default heuristic, pimc if -m is given)\n"
+            "  -m  milliseconds for every decision of the first robot\n"
+            "      (default 50)\n"
+            "  -n  number of threads of the first robot (default the\n"
+            "      processors divided by the threads of the games)\n"
+            "  -r  how the threads of the ISMCTS robot search: root (a tree\n"
+            "      for every thread) or tree (a shared tree) (default root)\n"
+            "  -b  the first robot bids from the bid table from file\n"
+            "  -w  writes in file the bid table generated from the games\n",
+            name);
+}
+
+static int sim_parseOptions(struct Options* options, int argc, char* argv[])
+{
+    long processors = sysconf(_SC_NPROCESSORS_ONLN);
+
+    options->playersNumber = 4;
+    options->gameType      = 1;
+    options->gamesNumber   = 100000;
+    options->threadsNumber = processors > 0 ? processors : 1;
+    options->seed          = random_createSeed();
+    options->robot         = -1;
+    options->milliseconds  = 0;
+    options->robotThreads  = 0;
+    options->parallelMode  = ISMCTS_ROOT_PARALLEL;
+    options->bidTable      = NULL;
+    options->bidTablePath  = NULL;
+
+    int option;
+    while ((option = getopt(argc, argv, "p:t:g:s:j:a:m:n:r:b:w:h")) != -1) {
+        switch (option) {
+        case 'p':
+            options->playersNumber = atoi(optarg);
+            break;
+        case 't':
+            options->gameType = atoi(optarg);
+            break;
+        case 'g':
+            options->gamesNumber = atol(optarg);
+            break;
+        case 's':
+            options->seed = strtoull(optarg, NULL, 0);
+            break;
+        case 'j':
+            options->threadsNumber = atoi(optarg);
+            break;
+        case 'a':
+            if (strcmp(optarg, "heuristic") == 0)
+                options->robot = HEURISTIC_ROBOT;
+            else if (strcmp(optarg, "pimc") == 0)
+                options->robot = PIMC_ROBOT;
+            else if (strcmp(optarg, "ismcts") == 0)
+                options->robot = ISMCTS_ROBOT;
+            else
+                return ILLEGAL_VALUE;
+            break;
+        case 'm':
+            options->milliseconds = atoi(optarg);
+            break;
+        case 'n':
+            options->robotThreads = atoi(optarg);
+            break;
+        case 'b':
+            if (options->bidTable != NULL)
+                bidtable_deleteBidTable(&(options->bidTable));
+            options->bidTable = bidtable_loadBidTable(optarg);
+            if (options->bidTable == NULL) {
+                fprintf(stderr, "Cannot read the bid table %s\n", optarg);
+                return ILLEGAL_VALUE;
+            }
+            break;
+        case 'w':
+            options->bidTablePath = optarg;
+            break;
+        case 'r':
+            if (strcmp(optarg, "root") == 0)
+                options->parallelMode = ISMCTS_ROOT_PARALLEL;
+            else if (strcmp(optarg, "tree") == 0)
+                options->parallelMode = ISMCTS_TREE_PARALLEL;
+            else
+                return ILLEGAL_VALUE;
+            break;
+        default:
+            return ILLEGAL_VALUE;
+        }
+    }
+
+    if (optind != argc)
+        return ILLEGAL_VALUE;
+    if (options->playersNumber < 3 || options->playersNumber > 6)
+        return ILLEGAL_VALUE;
+    if (options->gameType != 1 && options->gameType != 8)
+        return ILLEGAL_VALUE;
+    if (options->gamesNumber < 1)
+        return ILLEGAL_VALUE;
+    if (options->threadsNumber < 1 || options->threadsNumber > MAX_THREADS)
+        return ILLEGAL_VALUE;
+    if (options->milliseconds < 0)
+        return ILLEGAL_VALUE;
+    if (options->robotThreads < 0)
+        return ILLEGAL_VALUE;
+
+    if (options->robot < 0)
+        options->robot = options->milliseconds > 0 ? PIMC_ROBOT :
+                                                     HEURISTIC_ROBOT;
+    if (options->milliseconds == 0)
+        options->milliseconds = 50;
+
+    if (options->threadsNumber > options->gamesNumber)
+        options->threadsNumber = options->gamesNumber;
+
+    /* The processors are shared by the robots of the threads. */
+    if (options->robotThreads == 0)
+        options->robotThreads = processors / options->threadsNumber;
+    if (options->robotThreads < 1)
+        options->robotThreads = 1;
+
+    return FUNCTION_NO_ERROR;
+}
+
+static void sim_printStatistics(const struct Options* options,
+                                const struct Statistics* statistics,
+                                double seconds)
+{
+    long games = statistics->gamesNumber;
+
+    printf("players %d, type %d, seed %llu, threads %d\n",
+           options->playersNumber, options->gameType,
+           (unsigned long long)options->seed, options->threadsNumber);
+    printf("%ld games, %ld rounds, %ld hands in %.3f s\n", games,
+           statistics->roundsNumber, statistics->handsNumber, seconds);
+    printf("%.0f games/s, %.0f hands/s\n", games / seconds,
+           statistics->handsNumber / seconds);
+
+    printf("\n%-8s %10s %10s %8s\n", "player", "mean", "stddev", "wins");
+    for (int i = 0; i < options->playersNumber; i++) {
+        double mean = statistics->points[i] / games;
+        double variance = statistics->squares[i] / games - mean * mean;
+        printf("robot%-3d %10.2f %10.2f %7.2f%%\n", i + 1, mean,
+               sqrt(variance > 0 ? variance : 0),
+               100.0 * statistics->wins[i] / games);
+    }
+
+    if (statistics->decisionsNumber > 0 && options->robot == PIMC_ROBOT)
+        printf("\nmonte carlo: %ld cards, %.1f ms mean, %.1f ms max, "
+               "%.0f worlds/s\n", statistics->decisionsNumber,
+               1000 * statistics->seconds / statistics->decisionsNumber,
+               1000 * statistics->maxSeconds,
+               statistics->samplesNumber / statistics->seconds);
+    if (statistics->decisionsNumber > 0 && options->robot == ISMCTS_ROBOT)
+        printf("\nismcts: %ld decisions, %.1f ms mean, %.1f ms max, "
+               "%.0f playouts/s per search thread\n",
+               statistics->decisionsNumber,
+               1000 * statistics->seconds / statistics->decisionsNumber,
+               1000 * statistics->maxSeconds,
+               statistics->samplesNumber / statistics->seconds /
+               options->robotThreads);
+}
+
+/**
+ * @brief Function adds the bid tables of all the threads in the table of the
+ *        first thread and writes it in Options::bidTablePath.
+ */
+static int sim_saveBidTable(const struct Options* options,
+                            struct Worker* workers)
+{
+    struct BidTable *table = workers[0].bidTable;
+    long droppedNumber = workers[0].droppedNumber;
+
+    for (int i = 1; i < options->threadsNumber; i++) {
+        droppedNumber += workers[i].droppedNumber;
+        if (bidtable_addBidTable(table, workers[i].bidTable) !=
+            FUNCTION_NO_ERROR)
+            fprintf(stderr, "Some hands of thread %d didn't fit in the bid "
+                    "table\n", i);
+    }
+
+    long samplesNumber = 0;
+    long usableNumber = 0;
+    for (size_t i = 0; i < (size_t)1 << table->header.bits; i++) {
+        samplesNumber += table->entries[i].samplesNumber;
+        if (table->entries[i].samplesNumber >= BIDTABLE_MIN_SAMPLES)
+            usableNumber++;
+    }
+
+    printf("\nbid table: %u hands, %ld with at least %d rounds, %ld rounds, "
+           "%ld dropped\n", table->header.entriesNumber, usableNumber,
+           BIDTABLE_MIN_SAMPLES, samplesNumber, droppedNumber);
+
+    return bidtable_saveBidTable(table, options->bidTablePath);
+}
+
+int main(int argc, char *argv[])
+{
+    struct Options options;
+    if (sim_parseOptions(&options, argc, argv) != FUNCTION_NO_ERROR) {
+        sim_printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    struct Worker workers[MAX_THREADS];
+    pthread_t threads[MAX_THREADS];
+    memset(workers, 0, sizeof(workers));
+
+    double start = sim_getTime();
+
+    for (int i = 0; i < options.threadsNumber; i++) {
+        workers[i].options   = &options;
+        workers[i].firstGame = i;
+        workers[i].error     = FUNCTION_NO_ERROR;
+        if (pthread_create(&threads[i], NULL, sim_runWorker, &workers[i])) {
+            fprintf(stderr, "Cannot create thread %d\n", i);
+            return EXIT_FAILURE;
+        }
+    }
+
+    struct Statistics statistics;
+    memset(&statistics, 0, sizeof(statistics));
+    int error = FUNCTION_NO_ERROR;
+
+    for (int i = 0; i < options.threadsNumber; i++) {
+        pthread_join(threads[i], NULL);
+
+        const struct Statistics *partial = &(workers[i].statistics);
+        statistics.gamesNumber  += partial->gamesNumber;
+        statistics.roundsNumber += partial->roundsNumber;
+        statistics.handsNumber  += partial->handsNumber;
+        for (int j = 0; j < MAX_GAME_PLAYERS; j++) {
+            statistics.points[j]  += partial->points[j];
+            statistics.squares[j] += partial->squares[j];
+            statistics.wins[j]    += partial->wins[j];
+        }
+        statistics.decisionsNumber += partial->decisionsNumber;
+        statistics.samplesNumber   += partial->samplesNumber;
+        statistics.seconds         += partial->seconds;
+        if (partial->maxSeconds > statistics.maxSeconds)
+            statistics.maxSeconds = partial->maxSeconds;
+        if (error == FUNCTION_NO_ERROR)
+            error = workers[i].error;
+    }
+
+    double seconds = sim_getTime() - start;
+
+    if (error != FUNCTION_NO_ERROR)
+        fprintf(stderr, "A game stopped with the error %d\n", error);
+    if (statistics.gamesNumber > 0)
+        sim_printStatistics(&options, &statistics, seconds);
+
+    if (options.bidTablePath != NULL && error == FUNCTION_NO_ERROR) {
+        if (sim_saveBidTable(&options, workers) != FUNCTION_NO_ERROR) {
+            fprintf(stderr, "Cannot write the bid table %s\n",
+                    options.bidTablePath);
+            error = ILLEGAL_VALUE;
+        }
+    }
+
+    for (int i = 0; i < options.threadsNumber; i++)
+        if (workers[i].bidTable != NULL)
+            bidtable_deleteBidTable(&(workers[i].bidTable));
+    if (options.bidTable != NULL)
+        bidtable_deleteBidTable(&(options.bidTable));
+
+    return error == FUNCTION_NO_ERROR ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,82 @@
+/**
+ * @file arena.c
+ * @brief In this file are defined functions used for Arena-related
+ *        operations, these functions are declared in the header file arena.h.
+ */
+
+#include "arena.h"
+#include "errors.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+struct Arena *arena_createArena(size_t size)
+{
+    size_t headerSize = ARENA_ALIGN(sizeof(struct Arena));
+    size = ARENA_ALIGN(size);
+
+    struct Arena *arena = malloc(headerSize + size);
+    if (arena == NULL)
+        return NULL;
+
+    arena->size   = size;
+    arena->used   = 0;
+    arena->memory = (unsigned char*)arena + headerSize;
+
+    return arena;
+}
+
+int arena_deleteArena(struct Arena** arena)
+{
+    if (arena == NULL)
+        return POINTER_NULL;
+    if (*arena == NULL)
+        return POINTER_NULL;
+
+    free(*arena);
+    *arena = NULL;
+
+    return FUNCTION_NO_ERROR;
+}
+
+void *arena_allocate(struct Arena* arena, size_t size)
+{
+    if (arena == NULL)
+        return NULL;
+
+    /* The size is checked before it is aligned, else a huge size would wrap
+     * around to a small one. */
+    if (size > arena->size - arena->used)
+        return NULL;
+    size = ARENA_ALIGN(size);
+    if (size > arena->size - arena->used)
+        return NULL;
+
+    void *memory = arena->memory + arena->used;
+    arena->used += size;
+
+    return memory;
+}
+
+int arena_reset(struct Arena* arena)
+{
+    if (arena == NULL)
+        return POINTER_NULL;
+
+    arena->used = 0;
+
+    return FUNCTION_NO_ERROR;
+}
+
+int arena_copyArena(struct Arena* destination, const struct Arena* source)
+{
+    if (destination == NULL || source == NULL)
+        return POINTER_NULL;
+    if (destination->size < source->used)
+        return FULL;
+
+    memcpy(destination->memory, source->memory, source->used);
+    destination->used = source->used;
+
+    return FUNCTION_NO_ERROR;
+}
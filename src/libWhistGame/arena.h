@@ -0,0 +1,114 @@
+/**
+ * @file arena.h
+ * @brief Arena structure, as well as helper functions. An arena is a block of
+ *        memory from which the objects of a game are allocated one after
+ *        another and which is released with a single free.
+ */
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief The alignment of the memory returned by arena_allocate().
+ */
+#define ARENA_ALIGNMENT 16
+
+/**
+ * @brief The size which is used in an arena by an object of size bytes.
+ */
+#define ARENA_ALIGN(size) \
+    (((size) + ARENA_ALIGNMENT - 1) & ~((size_t)ARENA_ALIGNMENT - 1))
+
+/**
+ * @struct Arena
+ *
+ * @brief Arena structure. The structure is followed in memory by the block
+ *        from which are allocated the objects.
+ *
+ * @var Arena::size
+ *      The size of the block of memory.
+ * @var Arena::used
+ *      The number of bytes already allocated from the block.
+ * @var Arena::memory
+ *      Pointer to the first byte of the block.
+ */
+struct Arena {
+    size_t size;
+    size_t used;
+    unsigned char *memory;
+};
+
+/**
+ * @brief Function allocates and initializes an arena.
+ *
+ * @param size The number of bytes which can be allocated from the arena.
+ *
+ * @return Pointer to the new arena on success, NULL on failure.
+ */
+struct Arena *arena_createArena(size_t size);
+
+/**
+ * @brief Function releases the memory of an arena, together with all the
+ *        objects allocated from it, and makes the pointer NULL.
+ *
+ * @param arena Pointer to pointer to the arena which to be released.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int arena_deleteArena(struct Arena** arena);
+
+/**
+ * @brief Function allocates memory from an arena. The memory is aligned to
+ *        ARENA_ALIGNMENT bytes and it isn't initialized.
+ *
+ * @param arena Pointer to the arena from which is allocated the memory.
+ * @param size The number of bytes which are allocated.
+ *
+ * @return Pointer to the memory on success, NULL if the arena is full.
+ */
+void *arena_allocate(struct Arena* arena, size_t size);
+
+/**
+ * @brief Function releases all the objects allocated from an arena, so that
+ *        the arena can be used again.
+ *
+ * @param arena Pointer to the arena which to be reset.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int arena_reset(struct Arena* arena);
+
+/**
+ * @brief Function copies all the objects allocated from an arena in another
+ *        arena, at the same offsets. The pointers from the objects aren't
+ *        modified.
+ *
+ * @param destination Pointer to the arena in which are copied the objects, it
+ *                    must be at least as big as the used part of source.
+ * @param source Pointer to the arena from which are copied the objects.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int arena_copyArena(struct Arena* destination, const struct Arena* source);
+
+/**
+ * @brief Function checks if a pointer points in the used part of an arena.
+ *
+ * @param arena Pointer to the arena.
+ * @param pointer The pointer which is checked.
+ *
+ * @return 1 if the pointer points in the arena, 0 otherwise.
+ */
+static inline int arena_contains(const struct Arena* arena,
+                                 const void* pointer)
+{
+    uintptr_t address = (uintptr_t)pointer;
+    uintptr_t start   = (uintptr_t)arena->memory;
+
+    return address >= start && address - start < arena->used;
+}
+
+#endif
@@ -0,0 +1,145 @@
+/**
+ * @file bitboard.c
+ * @brief In this file are defined functions used for Bitboard-related
+ *        operations, these functions are declared in the header file
+ *        bitboard.h.
+ */
+
+#include "bitboard.h"
+#include "errors.h"
+
+#include <stdlib.h>
+
+enum Suit bitboard_getSuit(int index)
+{
+    if (index < 0 || index >= DECK_SIZE)
+        return SuitEnd;
+
+    return index / RANKS_NUMBER;
+}
+
+int bitboard_getValue(int index)
+{
+    if (index < 0 || index >= DECK_SIZE)
+        return ILLEGAL_VALUE;
+
+    return VALUES[index % RANKS_NUMBER];
+}
+
+int bitboard_getHighestCard(uint64_t cards, enum Suit suit)
+{
+    cards = bitboard_getSuitCards(cards, suit);
+    if (cards == 0)
+        return NOT_FOUND;
+
+    return 63 - __builtin_clzll(cards);
+}
+
+int bitboard_getLowestCard(uint64_t cards, enum Suit suit)
+{
+    cards = bitboard_getSuitCards(cards, suit);
+    if (cards == 0)
+        return NOT_FOUND;
+
+    return __builtin_ctzll(cards);
+}
+
+uint64_t bitboard_getPlayerCards(const struct Player* player)
+{
+    if (player == NULL)
+        return 0;
+
+    uint64_t cards = 0;
+    for (int i = 0; i < MAX_CARDS; i++)
+        cards |= bitboard_getCardMask(player->hand[i]);
+
+    return cards;
+}
+
+uint64_t bitboard_getDeckCards(const struct Deck* deck)
+{
+    if (deck == NULL)
+        return 0;
+
+    uint64_t cards = 0;
+    for (int i = 0; i < DECK_SIZE; i++)
+        cards |= bitboard_getCardMask(deck->cards[i]);
+
+    return cards;
+}
+
+int bitboard_loadRound(struct BitboardState* state, const struct Round* round)
+{
+    if (state == NULL)
+        return POINTER_NULL;
+    if (round == NULL)
+        return ROUND_NULL;
+
+    state->playersNumber = 0;
+    state->table         = 0;
+    state->leadSuit      = SuitEnd;
+    state->trump         = deck_getCardSuit(round->trump);
+
+    for (int i = 0; i < MAX_GAME_PLAYERS; i++) {
+        state->hands[i] = bitboard_getPlayerCards(round->players[i]);
+        if (round->players[i] != NULL)
+            state->playersNumber++;
+    }
+
+    if (round->hand != NULL) {
+        state->leadSuit = deck_getCardSuit(round->hand->cards[0]);
+        for (int i = 0; i < MAX_GAME_PLAYERS; i++)
+            state->table |= bitboard_getCardMask(round->hand->cards[i]);
+    }
+
+    state->played = state->table;
+
+    return FUNCTION_NO_ERROR;
+}
+
+int bitboard_playCard(struct BitboardState* state, int playerId, int index)
+{
+    if (state == NULL)
+        return POINTER_NULL;
+    if (playerId < 0 || playerId >= MAX_GAME_PLAYERS)
+        return ILLEGAL_VALUE;
+    if (index < 0 || index >= DECK_SIZE)
+        return ILLEGAL_VALUE;
+
+    uint64_t card = UINT64_C(1) << index;
+    if ((state->hands[playerId] & card) == 0)
+        return NOT_FOUND;
+
+    if (state->table == 0)
+        state->leadSuit = bitboard_getSuit(index);
+
+    state->hands[playerId] &= ~card;
+    state->table           |= card;
+    state->played          |= card;
+
+    return FUNCTION_NO_ERROR;
+}
+
+int bitboard_clearTable(struct BitboardState* state)
+{
+    if (state == NULL)
+        return POINTER_NULL;
+
+    state->table    = 0;
+    state->leadSuit = SuitEnd;
+
+    return FUNCTION_NO_ERROR;
+}
+
+int bitboard_getWinningCard(const struct BitboardState* state)
+{
+    if (state == NULL)
+        return POINTER_NULL;
+    if (state->table == 0)
+        return NOT_FOUND;
+
+    if (bitboard_getSuitCards(state->table, state->trump) != 0)
+        return bitboard_getHighestCard(state->table, state->trump);
+
+    return bitboard_getHighestCard(state->table, state->leadSuit);
+}
@@ -0,0 +1,234 @@
+/**
+ * @file bitboard.h
+ * @brief BitboardState structure, as well as helper functions. A bitboard is
+ *        a 64-bit mask in which every card of the deck has its own bit, the
+ *        position of the bit being the id of the card.
+ */
+
+#ifndef BITBOARD_H
+#define BITBOARD_H
+
+#include "deck.h"
+#include "player.h"
+#include "round.h"
+#include "constants.h"
+
+#include <stdint.h>
+
+/**
+ * @brief The mask of the cards of a suit when the suit is DIAMONDS.
+ */
+#define BITBOARD_SUIT_MASK ((UINT64_C(1) << RANKS_NUMBER) - 1)
+
+/**
+ * @struct BitboardState
+ *
+ * @brief BitboardState structure. Structure used to keep the cards of a round
+ *        as bitboards. The players have the same ids as in Round::players.
+ *
+ * @var BitboardState::playersNumber
+ *      The number of the players from round.
+ * @var BitboardState::trump
+ *      The suit of the trump or SuitEnd if the round doesn't have a trump.
+ * @var BitboardState::leadSuit
+ *      The suit of the first card from the current hand or SuitEnd if the
+ *      current hand is empty.
+ * @var BitboardState::hands
+ *      The cards of each player.
+ * @var BitboardState::table
+ *      The cards put down in the current hand.
+ * @var BitboardState::played
+ *      The cards put down in the round (the current hand included).
+ */
+struct BitboardState {
+    int playersNumber;
+    enum Suit trump;
+    enum Suit leadSuit;
+    uint64_t hands[MAX_GAME_PLAYERS];
+    uint64_t table;
+    uint64_t played;
+};
+
+/**
+ * @brief Function gets the mask of all the cards of a suit.
+ *
+ * @param suit The suit for which is got the mask.
+ *
+ * @return The mask of the suit, 0 if the suit isn't valid.
+ */
+static inline uint64_t bitboard_getSuitMask(enum Suit suit)
+{
+    if (suit < DIAMONDS || suit >= SuitEnd)
+        return 0;
+
+    return BITBOARD_SUIT_MASK << (suit * RANKS_NUMBER);
+}
+
+/**
+ * @brief Function counts the cards from a bitboard.
+ *
+ * @param cards The bitboard which is counted.
+ *
+ * @return The number of the cards.
+ */
+static inline int bitboard_countCards(uint64_t cards)
+{
+    return __builtin_popcountll(cards);
+}
+
+/**
+ * @brief Function gets the cards of a suit from a bitboard.
+ *
+ * @param cards The bitboard from which are got the cards.
+ * @param suit The suit of the cards.
+ *
+ * @return The cards of the suit.
+ */
+static inline uint64_t bitboard_getSuitCards(uint64_t cards, enum Suit suit)
+{
+    return cards & bitboard_getSuitMask(suit);
+}
+
+/**
+ * @brief Function gets the bitboard which has only the bit of a card.
+ *
+ * @param card The card for which is got the bitboard.
+ *
+ * @return The bitboard of the card, 0 if the card doesn't exist.
+ */
+static inline uint64_t bitboard_getCardMask(struct Card card)
+{
+    if (!deck_isCard(card))
+        return 0;
+
+    return UINT64_C(1) << card.id;
+}
+
+/**
+ * @brief Function gets the cards which a player can put down: the cards of
+ *        the lead suit if he has them, else the trumps if he has them, else
+ *        all his cards.
+ *
+ * @param cards The cards of the player.
+ * @param leadSuit The suit of the first card from the hand or SuitEnd if the
+ *                 hand is empty.
+ * @param trump The suit of the trump or SuitEnd if there isn't a trump.
+ *
+ * @return The bitboard of the cards which can be put down.
+ */
+static inline uint64_t bitboard_getLegalCards(uint64_t cards,
+                                              enum Suit leadSuit,
+                                              enum Suit trump)
+{
+    uint64_t follow = bitboard_getSuitCards(cards, leadSuit);
+    uint64_t trumps = bitboard_getSuitCards(cards, trump);
+
+    if (follow != 0)
+        return follow;
+    if (leadSuit != SuitEnd && trumps != 0)
+        return trumps;
+
+    return cards;
+}
+
+/**
+ * @brief Function gets the suit of the card which has the bit on a position.
+ *
+ * @param index The position of the bit of the card.
+ *
+ * @return The suit of the card or SuitEnd if index isn't valid.
+ */
+enum Suit bitboard_getSuit(int index);
+
+/**
+ * @brief Function gets the value of the card which has the bit on a position.
+ *
+ * @param index The position of the bit of the card.
+ *
+ * @return One of the VALUES on success, a negative value on failure.
+ */
+int bitboard_getValue(int index);
+
+/**
+ * @brief Function gets the highest card of a suit from a bitboard.
+ *
+ * @param cards The bitboard in which is searched the card.
+ * @param suit The suit of the card.
+ *
+ * @return The position of the bit of the card on success, NOT_FOUND if the
+ *         bitboard doesn't have cards of the suit.
+ */
+int bitboard_getHighestCard(uint64_t cards, enum Suit suit);
+
+/**
+ * @brief Function gets the lowest card of a suit from a bitboard.
+ *
+ * @param cards The bitboard in which is searched the card.
+ * @param suit The suit of the card.
+ *
+ * @return The position of the bit of the card on success, NOT_FOUND if the
+ *         bitboard doesn't have cards of the suit.
+ */
+int bitboard_getLowestCard(uint64_t cards, enum Suit suit);
+
+/**
+ * @brief Function gets the bitboard of the cards of a player.
+ *
+ * @param player Pointer to the player for which is got the bitboard.
+ *
+ * @return The bitboard of the cards, 0 if player is NULL.
+ */
+uint64_t bitboard_getPlayerCards(const struct Player* player);
+
+/**
+ * @brief Function gets the bitboard of the cards from a deck.
+ *
+ * @param deck Pointer to the deck for which is got the bitboard.
+ *
+ * @return The bitboard of the cards, 0 if deck is NULL.
+ */
+uint64_t bitboard_getDeckCards(const struct Deck* deck);
+
+/**
+ * @brief Function initializes a BitboardState with the cards of a round. The
+ *        round doesn't keep the hands already played, so only the cards from
+ *        the current hand are considered played.
+ *
+ * @param state Pointer to the BitboardState which is initialized.
+ * @param round Pointer to the round from which are got the cards.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int bitboard_loadRound(struct BitboardState* state, const struct Round* round);
+
+/**
+ * @brief Function moves a card from the hand of a player on table.
+ *
+ * @param state Pointer to the BitboardState in which is put down the card.
+ * @param playerId The id of the player which puts down the card.
+ * @param index The position of the bit of the card.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int bitboard_playCard(struct BitboardState* state, int playerId, int index);
+
+/**
+ * @brief Function clears the table after what a hand ended.
+ *
+ * @param state Pointer to the BitboardState which is modified.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int bitboard_clearTable(struct BitboardState* state);
+
+/**
+ * @brief Function gets the card which wins the current hand.
+ *
+ * @param state Pointer to the BitboardState in which is the hand.
+ *
+ * @return The position of the bit of the card on success, a negative value on
+ *         failure.
+ */
+int bitboard_getWinningCard(const struct BitboardState* state);
+
+#endif
@@ -18,7 +18,12 @@ enum Suit {DIAMONDS = 0, CLUBS, SPADES, HEARTS, SuitEnd};
  *
  * -1 is a flag used when iterating.
  */
-const int VALUES[13];
+extern const int VALUES[13];
+
+/**
+ * @brief The number of values which a suit has in a full deck.
+ */
+#define RANKS_NUMBER 12
 
 /**
  * @brief The maximum number of cards in a deck.
@@ -35,6 +40,11 @@ const int VALUES[13];
  */
 #define MIN_GAME_PLAYERS 3
 
+/**
+ * @brief The maximum number of characters of a player's name.
+ */
+#define MAX_NAME_LENGTH 20
+
 /**
  * @brief The maximum number of rounds in a game.
  */
@@ -50,11 +60,6 @@ const int VALUES[13];
  */
 #define MIN_CARDS 1
  
-/**
- * @brief The swaps number made at shuffling of the deck.
- */
-#define SWAPS_NUMBER 100
-
 /**
  * @brief The points number on which a player earns them when the won hands
  *        number is equal with the hands number on which he bid them.
@@ -0,0 +1,363 @@
+/**
+ * @file deal.c
+ * @brief In this file are defined functions used for Deal-related
+ *        operations, these functions are declared in the header file deal.h.
+ */
+
+#include "deal.h"
+#include "bitboard.h"
+#include "errors.h"
+
+/**
+ * @brief The binomial coefficients n choose k for the positions of the cards
+ *        of a deck and the cards of a hand, the biggest one fits in 32 bits.
+ */
+static const uint32_t BINOMIALS[DECK_SIZE + 1][MAX_CARDS + 1] = {
+    {1, 0, 0, 0, 0, 0, 0, 0, 0},
+    {1, 1, 0, 0, 0, 0, 0, 0, 0},
+    {1, 2, 1, 0, 0, 0, 0, 0, 0},
+    {1, 3, 3, 1, 0, 0, 0, 0, 0},
+    {1, 4, 6, 4, 1, 0, 0, 0, 0},
+    {1, 5, 10, 10, 5, 1, 0, 0, 0},
+    {1, 6, 15, 20, 15, 6, 1, 0, 0},
+    {1, 7, 21, 35, 35, 21, 7, 1, 0},
+    {1, 8, 28, 56, 70, 56, 28, 8, 1},
+    {1, 9, 36, 84, 126, 126, 84, 36, 9},
+    {1, 10, 45, 120, 210, 252, 210, 120, 45},
+    {1, 11, 55, 165, 330, 462, 462, 330, 165},
+    {1, 12, 66, 220, 495, 792, 924, 792, 495},
+    {1, 13, 78, 286, 715, 1287, 1716, 1716, 1287},
+    {1, 14, 91, 364, 1001, 2002, 3003, 3432, 3003},
+    {1, 15, 105, 455, 1365, 3003, 5005, 6435, 6435},
+    {1, 16, 120, 560, 1820, 4368, 8008, 11440, 12870},
+    {1, 17, 136, 680, 2380, 6188, 12376, 19448, 24310},
+    {1, 18, 153, 816, 3060, 8568, 18564, 31824, 43758},
+    {1, 19, 171, 969, 3876, 11628, 27132, 50388, 75582},
+    {1, 20, 190, 1140, 4845, 15504, 38760, 77520, 125970},
+    {1, 21, 210, 1330, 5985, 20349, 54264, 116280, 203490},
+    {1, 22, 231, 1540, 7315, 26334, 74613, 170544, 319770},
+    {1, 23, 253, 1771, 8855, 33649, 100947, 245157, 490314},
+    {1, 24, 276, 2024, 10626, 42504, 134596, 346104, 735471},
+    {1, 25, 300, 2300, 12650, 53130, 177100, 480700, 1081575},
+    {1, 26, 325, 2600, 14950, 65780, 230230, 657800, 1562275},
+    {1, 27, 351, 2925, 17550, 80730, 296010, 888030, 2220075},
+    {1, 28, 378, 3276, 20475, 98280, 376740, 1184040, 3108105},
+    {1, 29, 406, 3654, 23751, 118755, 475020, 1560780, 4292145},
+    {1, 30, 435, 4060, 27405, 142506, 593775, 2035800, 5852925},
+    {1, 31, 465, 4495, 31465, 169911, 736281, 2629575, 7888725},
+    {1, 32, 496, 4960, 35960, 201376, 906192, 3365856, 10518300},
+    {1, 33, 528, 5456, 40920, 237336, 1107568, 4272048, 13884156},
+    {1, 34, 561, 5984, 46376, 278256, 1344904, 5379616, 18156204},
+    {1, 35, 595, 6545, 52360, 324632, 1623160, 6724520, 23535820},
+    {1, 36, 630, 7140, 58905, 376992, 1947792, 8347680, 30260340},
+    {1, 37, 666, 7770, 66045, 435897, 2324784, 10295472, 38608020},
+    {1, 38, 703, 8436, 73815, 501942, 2760681, 12620256, 48903492},
+    {1, 39, 741, 9139, 82251, 575757, 3262623, 15380937, 61523748},
+    {1, 40, 780, 9880, 91390, 658008, 3838380, 18643560, 76904685},
+    {1, 41, 820, 10660, 101270, 749398, 4496388, 22481940, 95548245},
+    {1, 42, 861, 11480, 111930, 850668, 5245786, 26978328, 118030185},
+    {1, 43, 903, 12341, 123410, 962598, 6096454, 32224114, 145008513},
+    {1, 44, 946, 13244, 135751, 1086008, 7059052, 38320568, 177232627},
+    {1, 45, 990, 14190, 148995, 1221759, 8145060, 45379620, 215553195},
+    {1, 46, 1035, 15180, 163185, 1370754, 9366819, 53524680, 260932815},
+    {1, 47, 1081, 16215, 178365, 1533939, 10737573, 62891499, 314457495},
+    {1, 48, 1128, 17296, 194580, 1712304, 12271512, 73629072, 377348994}
+};
+
+/**
+ * @brief Function numbers some cards between the cards of a bitboard, in the
+ *        colexicographic order: the card with the position p (in the
+ *        bitboard) which is the j-th of the cards (from 1) adds p choose j.
+ */
+static uint64_t deal_rankCards(uint64_t cards, uint64_t subset)
+{
+    uint64_t rank = 0;
+    int j = 1;
+    for (; subset != 0; subset &= subset - 1, j++) {
+        int position = bitboard_countCards(cards & ((subset & -subset) - 1));
+        rank += BINOMIALS[position][j];
+    }
+
+    return rank;
+}
+
+/**
+ * @brief Function gets the cards with a rank from deal_rankCards(). The
+ *        positions are found from the last one, so the card with the current
+ *        position is always the biggest card which is left.
+ */
+static uint64_t deal_unrankCards(uint64_t cards, int cardsNumber,
+                                 uint64_t rank)
+{
+    uint64_t subset = 0;
+    int position = bitboard_countCards(cards);
+    for (int j = cardsNumber; j >= 1; j--) {
+        uint64_t card;
+        do {
+            position--;
+            card = UINT64_C(1) << (63 - __builtin_clzll(cards));
+            cards ^= card;
+        } while (BINOMIALS[position][j] > rank);
+        rank -= BINOMIALS[position][j];
+        subset |= card;
+    }
+
+    return subset;
+}
+
+/**
+ * @brief Function gets the number of the values of every digit of the index
+ *        of a deal: the hands of the players and the trump (a single value
+ *        if there isn't a trump).
+ */
+static int deal_getRadices(int playersNumber, int roundType,
+                           uint64_t* radices)
+{
+    if (playersNumber < MIN_GAME_PLAYERS || playersNumber > MAX_GAME_PLAYERS)
+        return ILLEGAL_VALUE;
+    if (roundType < MIN_CARDS || roundType > MAX_CARDS)
+        return ILLEGAL_VALUE;
+
+    int cardsNumber = bitboard_countCards(deal_getDeckCards(playersNumber));
+    for (int i = 0; i < playersNumber; i++) {
+        radices[i] = BINOMIALS[cardsNumber][roundType];
+        cardsNumber -= roundType;
+    }
+    radices[playersNumber] = cardsNumber > 0 ? cardsNumber : 1;
+
+    return FUNCTION_NO_ERROR;
+}
+
+uint64_t deal_getDeckCards(int playersNumber)
+{
+    if (playersNumber < MIN_GAME_PLAYERS || playersNumber > MAX_GAME_PLAYERS)
+        return 0;
+
+    /* The deck has the biggest 2 * playersNumber values of every suit. */
+    int lowest = (MAX_GAME_PLAYERS - playersNumber) * 2;
+    uint64_t suit = BITBOARD_SUIT_MASK & ~((UINT64_C(1) << lowest) - 1);
+
+    uint64_t cards = 0;
+    for (int i = DIAMONDS; i < SuitEnd; i++)
+        cards |= suit << (i * RANKS_NUMBER);
+
+    return cards;
+}
+
+int deal_getDealsNumber(int playersNumber, int roundType,
+                        DealIndex* dealsNumber)
+{
+    if (dealsNumber == NULL)
+        return POINTER_NULL;
+
+    uint64_t radices[MAX_GAME_PLAYERS + 1];
+    int check = deal_getRadices(playersNumber, roundType, radices);
+    if (check != FUNCTION_NO_ERROR)
+        return check;
+
+    *dealsNumber = 1;
+    for (int i = 0; i <= playersNumber; i++)
+        *dealsNumber *= radices[i];
+
+    return FUNCTION_NO_ERROR;
+}
+
+int deal_rankDeal(const struct Deal* deal, DealIndex* index)
+{
+    if (deal == NULL || index == NULL)
+        return POINTER_NULL;
+
+    uint64_t radices[MAX_GAME_PLAYERS + 1];
+    int check = deal_getRadices(deal->playersNumber, deal->roundType,
+                                radices);
+    if (check != FUNCTION_NO_ERROR)
+        return check;
+
+    uint64_t cards = deal_getDeckCards(deal->playersNumber);
+    DealIndex rank = 0;
+    for (int i = 0; i < deal->playersNumber; i++) {
+        uint64_t hand = deal->hands[i];
+        if ((hand & ~cards) != 0 ||
+            bitboard_countCards(hand) != deal->roundType)
+            return ILLEGAL_VALUE;
+
+        rank = rank * radices[i] + deal_rankCards(cards, hand);
+        cards &= ~hand;
+    }
+
+    uint64_t trump = bitboard_getCardMask(deal->trump);
+    if ((cards != 0 && (trump & cards) == 0) || (cards == 0 && trump != 0))
+        return ILLEGAL_VALUE;
+
+    *index = rank * radices[deal->playersNumber] +
+             deal_rankCards(cards, trump);
+
+    return FUNCTION_NO_ERROR;
+}
+
+int deal_unrankDeal(struct Deal* deal, int playersNumber, int roundType,
+                    DealIndex index)
+{
+    if (deal == NULL)
+        return POINTER_NULL;
+
+    uint64_t radices[MAX_GAME_PLAYERS + 1];
+    int check = deal_getRadices(playersNumber, roundType, radices);
+    if (check != FUNCTION_NO_ERROR)
+        return check;
+
+    /* The digits are got from the least significant one, but the hand of a
+     * player depends on the hands of the players before him. The quotients
+     * which fit in 64 bits are calculated without the 128-bit division. */
+    uint64_t digits[MAX_GAME_PLAYERS + 1];
+    for (int i = playersNumber; i >= 0; i--) {
+        DealIndex quotient = (index >> 64) == 0 ?
+                             (uint64_t)index / radices[i] :
+                             index / radices[i];
+        digits[i] = index - quotient * radices[i];
+        index = quotient;
+    }
+    if (index != 0)
+        return ILLEGAL_VALUE;
+
+    deal->playersNumber = playersNumber;
+    deal->roundType     = roundType;
+
+    uint64_t cards = deal_getDeckCards(playersNumber);
+    for (int i = 0; i < MAX_GAME_PLAYERS; i++) {
+        deal->hands[i] = 0;
+        if (i >= playersNumber)
+            continue;
+
+        deal->hands[i] = deal_unrankCards(cards, roundType, digits[i]);
+        cards &= ~deal->hands[i];
+    }
+
+    deal->trump = EMPTY_CARD;
+    if (cards != 0) {
+        uint64_t trump = deal_unrankCards(cards, 1, digits[playersNumber]);
+        deal->trump.id = __builtin_ctzll(trump);
+    }
+
+    return FUNCTION_NO_ERROR;
+}
+
+int deal_getRandomIndex(struct Random* random, DealIndex dealsNumber,
+                        DealIndex* index)
+{
+    if (random == NULL || index == NULL)
+        return POINTER_NULL;
+    if (dealsNumber == 0)
+        return ILLEGAL_VALUE;
+
+    /* The numbers with the bits of dealsNumber - 1 are generated until one
+     * of them is smaller than dealsNumber, which happens with a probability
+     * bigger than 1 / 2. */
+    DealIndex mask = dealsNumber - 1;
+    for (int i = 1; i < 128; i *= 2)
+        mask |= mask >> i;
+
+    DealIndex value;
+    do {
+        value = (DealIndex)random_getNumber(random) << 64 |
+                random_getNumber(random);
+        value &= mask;
+    } while (value >= dealsNumber);
+
+    *index = value;
+
+    return FUNCTION_NO_ERROR;
+}
+
+int deal_readRound(struct Deal* deal, const struct Round* round)
+{
+    if (deal == NULL)
+        return POINTER_NULL;
+    if (round == NULL)
+        return ROUND_NULL;
+
+    deal->playersNumber = round->playersNumber;
+    deal->roundType     = round->roundType;
+    deal->trump         = round->trump;
+
+    for (int i = 0; i < MAX_GAME_PLAYERS; i++) {
+        deal->hands[i] = bitboard_getPlayerCards(round->players[i]);
+        if (i < round->playersNumber &&
+            bitboard_countCards(deal->hands[i]) != round->roundType)
+            return ILLEGAL_VALUE;
+    }
+
+    return FUNCTION_NO_ERROR;
+}
+
+int deal_distributeDeal(const struct Deal* deal, struct Round* round)
+{
+    if (deal == NULL)
+        return POINTER_NULL;
+    if (round == NULL)
+        return ROUND_NULL;
+    if (deal->playersNumber != round->playersNumber ||
+        deal->roundType != round->roundType)
+        return ILLEGAL_VALUE;
+
+    for (int i = 0; i < deal->playersNumber; i++) {
+        if (round->players[i] == NULL)
+            return PLAYER_NULL;
+
+        for (uint64_t cards = deal->hands[i]; cards != 0;
+             cards &= cards - 1) {
+            struct Card card = { __builtin_ctzll(cards) };
+            int check = player_addCard(round->players[i], card);
+            if (check != FUNCTION_NO_ERROR)
+                return check;
+            round->key ^= zobrist_getHandKey(i, card.id);
+        }
+    }
+
+    return round_addTrump(round, deal->trump);
+}
+
+int deal_formatIndex(DealIndex index, char* text, size_t size)
+{
+    if (text == NULL)
+        return POINTER_NULL;
+
+    char digits[DEAL_INDEX_DIGITS];
+    size_t digitsNumber = 0;
+    do {
+        digits[digitsNumber++] = '0' + (int)(index % 10);
+        index /= 10;
+    } while (index != 0);
+
+    if (size < digitsNumber + 1)
+        return FULL;
+
+    for (size_t i = 0; i < digitsNumber; i++)
+        text[i] = digits[digitsNumber - 1 - i];
+    text[digitsNumber] = '\0';
+
+    return FUNCTION_NO_ERROR;
+}
+
+int deal_parseIndex(const char* text, DealIndex* index)
+{
+    if (text == NULL || index == NULL)
+        return POINTER_NULL;
+    if (*text == '\0')
+        return ILLEGAL_VALUE;
+
+    DealIndex value = 0;
+    for (; *text != '\0'; text++) {
+        if (*text < '0' || *text > '9')
+            return ILLEGAL_VALUE;
+
+        int digit = *text - '0';
+        if (value > (~(DealIndex)0 - digit) / 10)
+            return ILLEGAL_VALUE;
+        value = value * 10 + digit;
+    }
+
+    *index = value;
+
+    return FUNCTION_NO_ERROR;
+}
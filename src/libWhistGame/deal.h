@@ -0,0 +1,165 @@
+/**
+ * @file deal.h
+ * @brief Deal structure, as well as the functions which number the deals of
+ *        a round. Every deal of the deck of deck_createDeck(), for a number
+ *        of players and a round type, has its own index between 0 and the
+ *        number of the deals - 1, so the deals can be enumerated, split in
+ *        ranges, sampled without shuffling or written as a single number.
+ */
+
+#ifndef DEAL_H
+#define DEAL_H
+
+#include "deck.h"
+#include "round.h"
+#include "random.h"
+#include "constants.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief The type of the index of a deal. The numbers of the deals have up to
+ *        123 bits (6 players and rounds of 7 cards), so they are kept in an
+ *        unsigned 128-bit integer of GCC and Clang.
+ */
+__extension__ typedef unsigned __int128 DealIndex;
+
+/**
+ * @brief The maximum number of digits of an index written in decimal.
+ */
+#define DEAL_INDEX_DIGITS 39
+
+/**
+ * @struct Deal
+ *
+ * @brief Deal structure. Structure used to keep the cards of a round before
+ *        the first card is put down.
+ *
+ * @var Deal::playersNumber
+ *      The number of the players (MIN_GAME_PLAYERS - MAX_GAME_PLAYERS).
+ * @var Deal::roundType
+ *      The number of the cards of every player (MIN_CARDS - MAX_CARDS).
+ * @var Deal::hands
+ *      The bitboards of the cards of the players, in the order from
+ *      Round::players.
+ * @var Deal::trump
+ *      The card which is the trump or EMPTY_CARD if all the cards of the
+ *      deck are distributed.
+ */
+struct Deal {
+    int playersNumber;
+    int roundType;
+    uint64_t hands[MAX_GAME_PLAYERS];
+    struct Card trump;
+};
+
+/**
+ * @brief Function gets the bitboard of the cards of the deck created by
+ *        deck_createDeck() for a number of players.
+ *
+ * @param playersNumber The number of the players.
+ *
+ * @return The bitboard of the cards, 0 if the number of the players isn't
+ *         valid.
+ */
+uint64_t deal_getDeckCards(int playersNumber);
+
+/**
+ * @brief Function determines the number of the deals for a number of players
+ *        and a round type.
+ *
+ * @param playersNumber The number of the players.
+ * @param roundType The round type.
+ * @param dealsNumber Pointer to the variable in which is saved the number.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int deal_getDealsNumber(int playersNumber, int roundType,
+                        DealIndex* dealsNumber);
+
+/**
+ * @brief Function determines the index of a deal. The hand of the first
+ *        player is the most significant digit of the index and the trump the
+ *        least significant, the hand of a player being numbered between the
+ *        cards which the players before him don't have.
+ *
+ * @param deal Pointer to the deal.
+ * @param index Pointer to the variable in which is saved the index.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, ILLEGAL_VALUE if the cards of
+ *         the deal aren't a deal of the deck, other value on failure.
+ */
+int deal_rankDeal(const struct Deal* deal, DealIndex* index);
+
+/**
+ * @brief Function determines the deal with an index, it is the inverse of
+ *        deal_rankDeal().
+ *
+ * @param deal Pointer to the deal which is determined.
+ * @param playersNumber The number of the players.
+ * @param roundType The round type.
+ * @param index The index of the deal, smaller than the number of the deals.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int deal_unrankDeal(struct Deal* deal, int playersNumber, int roundType,
+                    DealIndex index);
+
+/**
+ * @brief Function generates the index of a random deal, all the deals having
+ *        the same probability.
+ *
+ * @param random Pointer to the generator.
+ * @param dealsNumber The number of the deals (see deal_getDealsNumber()).
+ * @param index Pointer to the variable in which is saved the index.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int deal_getRandomIndex(struct Random* random, DealIndex dealsNumber,
+                        DealIndex* index);
+
+/**
+ * @brief Function reads the deal of a round in which no card was put down.
+ *
+ * @param deal Pointer to the deal which is read.
+ * @param round Pointer to the round.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int deal_readRound(struct Deal* deal, const struct Round* round);
+
+/**
+ * @brief Function distributes the cards of a deal to the players of a round
+ *        and sets the trump, instead of round_distributeDeck().
+ *
+ * @param deal Pointer to the deal.
+ * @param round Pointer to the round.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int deal_distributeDeal(const struct Deal* deal, struct Round* round);
+
+/**
+ * @brief Function writes an index in decimal.
+ *
+ * @param index The index.
+ * @param text The buffer in which is written the index.
+ * @param size The size of the buffer, at least DEAL_INDEX_DIGITS + 1 for
+ *             every index.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int deal_formatIndex(DealIndex index, char* text, size_t size);
+
+/**
+ * @brief Function reads an index written in decimal.
+ *
+ * @param text The text of the index, only with digits.
+ * @param index Pointer to the variable in which is saved the index.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int deal_parseIndex(const char* text, DealIndex* index);
+
+#endif
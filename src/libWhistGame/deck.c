@@ -9,49 +9,24 @@
 #include "errors.h"
 
 #include <stdlib.h>
-#include <time.h>
 
 /**
  * Constants for game values
  */
 const int VALUES[] = {3, 4, 5, 6, 7, 8, 9, 10, 12, 13, 14, 15, -1};
 
-struct Card *deck_createCard(enum Suit suit, int value)
+struct Card deck_createCard(enum Suit suit, int value)
 {
-    int check = 0;
-    for (int i = 0; VALUES[i] != -1; i++)
-        if (VALUES[i] == value)
-            check++;
-    if (check != 1)
-        return NULL;
-
-    for (int i = 0; i < SuitEnd; i++)
-        if (suit == i)
-            check++;
-    if (check != 2)
-        return NULL;
-
-    struct Card *card = malloc(sizeof(struct Card));
-    if (card == NULL)
-        return NULL;
-
-    card->suit  = suit;
-    card->value = value;
-
-    return card;
-}
-
-int deck_deleteCard(struct Card** card)
-{
-    if (card == NULL)
-        return POINTER_NULL;
-    if (*card == NULL)
-        return CARD_NULL;
+    if (suit < DIAMONDS || suit >= SuitEnd)
+        return EMPTY_CARD;
 
-    free(*card);
-    *card = NULL;
+    for (int i = 0; VALUES[i] != -1; i++)
+        if (VALUES[i] == value) {
+            struct Card card = { suit * RANKS_NUMBER + i };
+            return card;
+        }
 
-    return FUNCTION_NO_ERROR;
+    return EMPTY_CARD;
 }
 
 struct Deck *deck_createDeck(int playersNumber)
@@ -63,6 +38,18 @@ struct Deck *deck_createDeck(int playersNumber)
     if (deck == NULL)
         return NULL;
 
+    deck_initializeDeck(deck, playersNumber);
+
+    return deck;
+}
+
+int deck_initializeDeck(struct Deck* deck, int playersNumber)
+{
+    if (deck == NULL)
+        return DECK_NULL;
+    if (playersNumber > MAX_GAME_PLAYERS || playersNumber < MIN_GAME_PLAYERS)
+        return ILLEGAL_VALUE;
+
     int k = 0;
     for (int i = 0 + (MAX_GAME_PLAYERS - playersNumber) * 2;
          VALUES[i] != -1; i++)
@@ -71,9 +58,9 @@ struct Deck *deck_createDeck(int playersNumber)
     }
 
     for (int i = k; i < DECK_SIZE; i++)
-        deck->cards[i] = NULL;
+        deck->cards[i] = EMPTY_CARD;
 
-    return deck;
+    return FUNCTION_NO_ERROR;
 }
 
 int deck_deleteDeck(struct Deck** deck)
@@ -83,9 +70,6 @@ int deck_deleteDeck(struct Deck** deck)
     if (*deck == NULL)
         return DECK_NULL;
 
-    for (int i = 0; i < DECK_SIZE; i++)
-        deck_deleteCard(&((*deck)->cards[i]));
-
     free(*deck);
     *deck = NULL;
 
@@ -99,49 +83,45 @@ int deck_getDeckSize(const struct Deck* deck)
 
     int deckSize = 0;
     for (int i  = 0; i < DECK_SIZE; i++)
-        if (deck->cards[i] != NULL)
+        if (deck_isCard(deck->cards[i]))
             deckSize++;
 
     return deckSize;
 }
 
-int deck_shuffleDeck(struct Deck* deck)
+int deck_shuffleDeck(struct Deck* deck, struct Random* random)
 {
     if (deck == NULL)
         return DECK_NULL;
+    if (random == NULL)
+        return POINTER_NULL;
 
-    srand(time(NULL));
     int deckSize = deck_getDeckSize(deck);
-    for (int i = 0; i < SWAPS_NUMBER; i++) {
-        int a = rand() % deckSize;
-        int b = rand() % deckSize;
-        while (a == b) {
-            a = rand() % deckSize;
-            b = rand() % deckSize;
-        }
-        struct Card *card = deck->cards[a];
-        deck->cards[a] = deck->cards[b];
-        deck->cards[b] = card;
+    for (int i = deckSize - 1; i > 0; i--) {
+        int j = random_getBoundedNumber(random, i + 1);
+        struct Card card = deck->cards[i];
+        deck->cards[i] = deck->cards[j];
+        deck->cards[j] = card;
     }
 
     return FUNCTION_NO_ERROR;
 }
 
-int deck_compareCards(const struct Card* card1, const struct Card* card2,
-                      enum Suit trump)
+int deck_compareCards(struct Card card1, struct Card card2, enum Suit trump)
 {
-    if (card1 == NULL || card2 == NULL)
+    if (!deck_isCard(card1) || !deck_isCard(card2))
         return CARD_NULL;
-    if (card1->suit == card2->suit && card1->value == card2->value)
+    if (card1.id == card2.id)
         return 0;
 
-    int value1 = card1->value;
-    int value2 = card2->value;
-    if ((card1->suit == trump && card2->suit != trump) ||
-        (card1->suit == card2->suit && value1 > value2) ||
-        (card1->suit != card2->suit && card2->suit != trump))
+    enum Suit suit1 = deck_getCardSuit(card1);
+    enum Suit suit2 = deck_getCardSuit(card2);
+    int value1 = deck_getCardValue(card1);
+    int value2 = deck_getCardValue(card2);
+    if ((suit1 == trump && suit2 != trump) ||
+        (suit1 == suit2 && value1 > value2) ||
+        (suit1 != suit2 && suit2 != trump))
         return 1;
 
     return 2;
 }
-
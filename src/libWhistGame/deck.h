@@ -7,53 +7,114 @@
 #define DECK_H
 
 #include "constants.h"
+#include "random.h"
 
 /**
  * @struct Card
  *
  * @brief Card structure. Structure used to keep information about an card.
+ *        A card is kept as its id, suit * RANKS_NUMBER + rank, where rank is
+ *        the position of the card's value in VALUES, so a card is passed by
+ *        value and fits in one byte.
  *
- * @var Card::suit
- *      The suit of the card.      
- * @var Card::value
- *      The value of the card.
+ * @var Card::id
+ *      The id of the card (between 0 and DECK_SIZE - 1) or EMPTY_CARD_ID if
+ *      the card doesn't exist.
  */
 struct Card {
-    enum Suit suit;
-    int value;
+    unsigned char id;
 };
 
+/**
+ * @brief The id used for a position in which isn't a card.
+ */
+#define EMPTY_CARD_ID 0xFF
+
+/**
+ * @brief The card used for a position in which isn't a card.
+ */
+#define EMPTY_CARD ((struct Card){ EMPTY_CARD_ID })
+
 /**
  * @struct Deck
  *
- * @brief Deck structure. Structure used to keep pointers to the cards of the 
- *        deck.
+ * @brief Deck structure. Structure used to keep the cards of the deck.
  *
  * @var Deck::cards
- *      Pointer to the cards of the deck.
+ *      The cards of the deck, EMPTY_CARD for the positions without a card.
  */
 struct Deck {
-    struct Card *cards[DECK_SIZE];
+    struct Card cards[DECK_SIZE];
 };
 
 /**
- * @brief Allocates and initializes a card.
+ * @brief Function checks if a card exists.
  *
- * @param suit The suit of the new card.
- * @param value The value of the new card.
+ * @param card The card which is checked.
  *
- * @return Pointer to the new card on success or NULL on failure.
+ * @return 1 if the card exists, 0 if the card is EMPTY_CARD or isn't valid.
  */
-struct Card *deck_createCard(enum Suit suit, int value);
+static inline int deck_isCard(struct Card card)
+{
+    return card.id < DECK_SIZE;
+}
 
 /**
- * @brief Function releases the memory of a card and makes the pointer NULL.
+ * @brief Function gets the suit of a card.
  *
- * @param card Pointer to pointer to the card which to be released.
+ * @param card The card for which is got the suit.
  *
- * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ * @return The suit of the card or SuitEnd if the card doesn't exist.
+ */
+static inline enum Suit deck_getCardSuit(struct Card card)
+{
+    if (!deck_isCard(card))
+        return SuitEnd;
+
+    return card.id / RANKS_NUMBER;
+}
+
+/**
+ * @brief Function gets the rank of a card, that is the position of the
+ *        card's value in VALUES.
+ *
+ * @param card The card for which is got the rank.
+ *
+ * @return A value between 0 and RANKS_NUMBER - 1 on success, -1 if the card
+ *         doesn't exist.
+ */
+static inline int deck_getCardRank(struct Card card)
+{
+    if (!deck_isCard(card))
+        return -1;
+
+    return card.id % RANKS_NUMBER;
+}
+
+/**
+ * @brief Function gets the game value of a card.
+ *
+ * @param card The card for which is got the value.
+ *
+ * @return One of the VALUES on success, -1 if the card doesn't exist.
+ */
+static inline int deck_getCardValue(struct Card card)
+{
+    if (!deck_isCard(card))
+        return -1;
+
+    return VALUES[card.id % RANKS_NUMBER];
+}
+
+/**
+ * @brief Function initializes a card.
+ *
+ * @param suit The suit of the new card.
+ * @param value The value of the new card.
+ *
+ * @return The new card on success or EMPTY_CARD on failure.
  */
-int deck_deleteCard(struct Card** card);
+struct Card deck_createCard(enum Suit suit, int value);
 
 /**
  * @brief Allocates and initializes a deck.
@@ -64,6 +125,18 @@ int deck_deleteCard(struct Card** card);
  */
 struct Deck *deck_createDeck(int playersNumber);
 
+/**
+ * @brief Function puts back in a deck all the cards used by a game, without
+ *        allocating memory. This function will be used when the same deck is
+ *        distributed again.
+ *
+ * @param deck Pointer to the deck which to be initialized.
+ * @param playersNumber The players number from game.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int deck_initializeDeck(struct Deck* deck, int playersNumber);
+
 /**
  * @brief Function realeses the memory of a deck and makes the pointer NULL.
  *
@@ -84,19 +157,21 @@ int deck_deleteDeck(struct Deck** deck);
 int deck_getDeckSize(const struct Deck* deck);
 
 /**
- * @brief Function shuffle the cards from a deck.
+ * @brief Function shuffle the cards from a deck. All the orders of the cards
+ *        have the same probability.
  *
  * @param deck Pointer to the deck which to be shuffled.
+ * @param random Pointer to the generator used to shuffle the deck.
  *
  * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
  */
-int deck_shuffleDeck(struct Deck* deck);
+int deck_shuffleDeck(struct Deck* deck, struct Random* random);
 
 /**
 * @brief Function compare two cards.
 *
-* @param card1 Pointer to the first card which to be compared.
-* @param card2 Pointer to the second card which to be compared.
+* @param card1 The first card which to be compared.
+* @param card2 The second card which to be compared.
 * @param trump The trump which is set in game.
 *
 * @return 0 If the cards are equal.
@@ -104,8 +179,7 @@ int deck_shuffleDeck(struct Deck* deck);
 *         2 If the second card (card2) is the winning.
 *         Other value on failure.
 */
-int deck_compareCards(const struct Card* card1, const struct Card* card2,
-                      enum Suit trump);
+int deck_compareCards(struct Card card1, struct Card card2, enum Suit trump);
 
 #endif
 
@@ -33,7 +33,11 @@ enum ERROR_CODES {
     INCORRECT_NAME       = -15,
     ILLEGAL_BID          = -16,
     GAME_OVER            = -17,
-    ROUND_OVER           = -18
+    ROUND_OVER           = -18,
+    DUPLICATE_CARD       = -19,
+    ALLOCATION_FAILED    = -20,
+    LIMIT_REACHED        = -21,
+    ILLEGAL_MOVE         = -22
 };
 
 #endif
@@ -10,28 +10,58 @@
 #include <stdlib.h>
 #include <string.h>
 
-struct Game *game_createGame(int gameType)
-{
-    if (gameType != 1 && gameType != 8)
-        return NULL;
+/**
+ * @brief The size of the arena of a game, enough for the game, its deck, its
+ *        players and its rounds.
+ */
+#define GAME_ARENA_SIZE (ARENA_ALIGN(sizeof(struct Game)) + \
+                         ARENA_ALIGN(sizeof(struct Deck)) + \
+                         ARENA_ALIGN(sizeof(struct Player)) * \
+                         MAX_GAME_PLAYERS + \
+                         ARENA_ALIGN(sizeof(struct Round)) * MAX_GAME_ROUNDS)
 
-    struct Game *game = malloc(sizeof(struct Game));
+/**
+ * @brief Function allocates the game from the arena and initializes it. The
+ *        arena must be empty.
+ */
+static struct Game *game_createGameInArena(struct Arena* arena, int gameType)
+{
+    struct Game *game = arena_allocate(arena, sizeof(struct Game));
     if (game == NULL)
         return NULL;
 
     game->playersNumber = 0;
     game->currentRound  = -1;
     game->gameType      = gameType;
+    game->arena         = arena;
     game->deck          = NULL;
+    random_setSeed(&(game->random), random_createSeed());
 
     for (int i = 0; i < MAX_GAME_PLAYERS; i++)
         game->players[i] = NULL;
     for (int i = 0; i < MAX_GAME_ROUNDS; i++)
         game->rounds[i] = NULL;
+    for (int i = 0; i < MAX_GAME_PLAYERS; i++) {
+        game->wonStreak[i]   = 0;
+        game->lostStreak[i]  = 0;
+        game->streakRound[i] = -1;
+    }
 
     return game;
 }
 
+struct Game *game_createGame(int gameType)
+{
+    if (gameType != 1 && gameType != 8)
+        return NULL;
+
+    struct Arena *arena = arena_createArena(GAME_ARENA_SIZE);
+    if (arena == NULL)
+        return NULL;
+
+    return game_createGameInArena(arena, gameType);
+}
+
 int game_deleteGame(struct Game** game)
 {
     if (game == NULL)
@@ -39,23 +69,132 @@ int game_deleteGame(struct Game** game)
     if (*game == NULL)
         return GAME_NULL;
 
-    if ((*game)->deck != NULL)
-        deck_deleteDeck(&((*game)->deck));
+    struct Arena *arena = (*game)->arena;
+    *game = NULL;
 
-    for (int i = 0; i < MAX_GAME_ROUNDS; i++)
-        if ((*game)->rounds[i] != NULL)
-            round_deleteRound(&((*game)->rounds[i]));
+    return arena_deleteArena(&arena);
+}
+
+int game_reinitializeGame(struct Game* game, int gameType)
+{
+    if (game == NULL)
+        return GAME_NULL;
+    if (gameType != 1 && gameType != 8)
+        return ILLEGAL_VALUE;
+
+    struct Arena *arena = game->arena;
+    struct Random random = game->random;
+    arena_reset(arena);
+    game = game_createGameInArena(arena, gameType);
+    game->random = random;
+
+    return FUNCTION_NO_ERROR;
+}
+
+/**
+ * @brief Function translates a pointer from the arena source in the arena
+ *        destination. The pointers which aren't in source remain the same.
+ */
+static void *game_rebasePointer(const struct Arena* source,
+                                const struct Arena* destination,
+                                const void* pointer)
+{
+    if (pointer == NULL || !arena_contains(source, pointer))
+        return (void*)pointer;
+
+    return destination->memory +
+           ((const unsigned char*)pointer - source->memory);
+}
+
+/**
+ * @brief Function copies the objects of a game in an arena and makes the
+ *        pointers of the copy point in that arena.
+ */
+static struct Game *game_copyInArena(struct Arena* arena,
+                                     const struct Game* source)
+{
+    const struct Arena *sourceArena = source->arena;
+    if (arena_copyArena(arena, sourceArena) != FUNCTION_NO_ERROR)
+        return NULL;
+
+    struct Game *game = game_rebasePointer(sourceArena, arena, source);
+    game->arena = arena;
+    game->deck  = game_rebasePointer(sourceArena, arena, game->deck);
 
     for (int i = 0; i < MAX_GAME_PLAYERS; i++)
-        if ((*game)->players[i] != NULL)
-            player_deletePlayer(&((*game)->players[i]));
+        game->players[i] = game_rebasePointer(sourceArena, arena,
+                                              game->players[i]);
+
+    for (int i = 0; i < MAX_GAME_ROUNDS; i++) {
+        struct Round *round = game_rebasePointer(sourceArena, arena,
+                                                 game->rounds[i]);
+        game->rounds[i] = round;
+        if (round == NULL)
+            continue;
+
+        for (int j = 0; j < MAX_GAME_PLAYERS; j++) {
+            round->players[j] = game_rebasePointer(sourceArena, arena,
+                                                   round->players[j]);
+            round->currentHand.players[j] =
+                game_rebasePointer(sourceArena, arena,
+                                   round->currentHand.players[j]);
+        }
+        if (round->hand != NULL)
+            round->hand = &(round->currentHand);
+    }
 
-    free(*game);
-    *game = NULL;
+    return game;
+}
+
+struct Game *game_cloneGame(const struct Game* game)
+{
+    if (game == NULL)
+        return NULL;
+
+    struct Arena *arena = arena_createArena(game->arena->size);
+    if (arena == NULL)
+        return NULL;
+
+    struct Game *clone = game_copyInArena(arena, game);
+    if (clone == NULL)
+        arena_deleteArena(&arena);
+
+    return clone;
+}
+
+int game_copyGame(struct Game* destination, const struct Game* source)
+{
+    if (destination == NULL || source == NULL)
+        return GAME_NULL;
+    if (destination == source)
+        return FUNCTION_NO_ERROR;
+
+    /* The game is the first object of its arena, so the copy is made at the
+     * address of the destination. */
+    if (game_copyInArena(destination->arena, source) == NULL)
+        return FULL;
 
     return FUNCTION_NO_ERROR;
 }
 
+int game_setSeed(struct Game* game, uint64_t seed)
+{
+    if (game == NULL)
+        return GAME_NULL;
+
+    return random_setSeed(&(game->random), seed);
+}
+
+int game_shuffleDeck(struct Game* game)
+{
+    if (game == NULL)
+        return GAME_NULL;
+    if (game->deck == NULL)
+        return DECK_NULL;
+
+    return deck_shuffleDeck(game->deck, &(game->random));
+}
+
 int game_addDeck(struct Game* game, struct Deck** deck)
 {
     if (game == NULL)
@@ -65,15 +204,32 @@ int game_addDeck(struct Game* game, struct Deck** deck)
     if (*deck == NULL)
         return DECK_NULL;
 
-    if (game->deck != NULL)
-        deck_deleteDeck(&game->deck);
+    if (game->deck == NULL) {
+        game->deck = arena_allocate(game->arena, sizeof(struct Deck));
+        if (game->deck == NULL)
+            return ALLOCATION_FAILED;
+    }
 
-    game->deck = *deck;
-    *deck = NULL;
+    *(game->deck) = **deck;
+    deck_deleteDeck(deck);
 
     return FUNCTION_NO_ERROR;
 }
 
+int game_initializeDeck(struct Game* game)
+{
+    if (game == NULL)
+        return GAME_NULL;
+
+    if (game->deck == NULL) {
+        game->deck = arena_allocate(game->arena, sizeof(struct Deck));
+        if (game->deck == NULL)
+            return ALLOCATION_FAILED;
+    }
+
+    return deck_initializeDeck(game->deck, game->playersNumber);
+}
+
 int game_addPlayer(struct Game* game, struct Player** player)
 {
     if (game == NULL)
@@ -94,8 +250,14 @@ int game_addPlayer(struct Game* game, struct Player** player)
 
     for (int i = 0; i < MAX_GAME_PLAYERS; i++)
         if (game->players[i] == NULL) {
-            game->players[i] = *player;
-            *player = NULL;
+            game->players[i] = arena_allocate(game->arena,
+                                              sizeof(struct Player));
+            if (game->players[i] == NULL)
+                return ALLOCATION_FAILED;
+
+            *(game->players[i]) = **player;
+            game->players[i]->seat = i;
+            player_deletePlayer(player);
             game->playersNumber++;
             return FUNCTION_NO_ERROR;
         }
@@ -118,8 +280,39 @@ int game_addRound(struct Game* game, struct Round** round)
 
     for (int i = 0; i < MAX_GAME_ROUNDS; i++)
         if (game->rounds[i] == NULL) {
-            game->rounds[i] = *round;
-            *round = NULL;
+            game->rounds[i] = arena_allocate(game->arena,
+                                             sizeof(struct Round));
+            if (game->rounds[i] == NULL)
+                return ALLOCATION_FAILED;
+
+            *(game->rounds[i]) = **round;
+            if ((*round)->hand != NULL)
+                game->rounds[i]->hand = &(game->rounds[i]->currentHand);
+            round_deleteRound(round);
+            return FUNCTION_NO_ERROR;
+        }
+
+    return FULL;
+}
+
+/**
+ * @brief Function allocates a round from the arena of the game and adds it
+ *        after the last round of the game.
+ */
+static int game_createAndAddRound(struct Game* game, int roundType)
+{
+    for (int i = 0; i < MAX_GAME_ROUNDS; i++)
+        if (game->rounds[i] == NULL) {
+            struct Round *round = arena_allocate(game->arena,
+                                                 sizeof(struct Round));
+            if (round == NULL)
+                return ALLOCATION_FAILED;
+
+            int check = round_initializeRound(round, roundType);
+            if (check != FUNCTION_NO_ERROR)
+                return check;
+
+            game->rounds[i] = round;
             return FUNCTION_NO_ERROR;
         }
 
@@ -164,11 +357,8 @@ int game_createAndAddRounds(struct Game* game)
     if (game == NULL)
         return GAME_NULL;
 
-    struct Round *round;
-    for (int i = 0; i < game->playersNumber; i++) {
-        round = round_createRound(game->gameType);
-        game_addRound(game, &round);
-    }
+    for (int i = 0; i < game->playersNumber; i++)
+        game_createAndAddRound(game, game->gameType);
 
     int roundType;
     int type;
@@ -183,32 +373,26 @@ int game_createAndAddRounds(struct Game* game)
     for (int i = 0; i < 6; i++) {
         int type2 = game->rounds[game->playersNumber + i - 1]->roundType + 
                     roundType;
-        round = round_createRound(type2);
-        game_addRound(game, &round);
+        game_createAndAddRound(game, type2);
     }
 
-    for (int i = 0; i < game->playersNumber; i++) {
-        round = round_createRound(type);
-        game_addRound(game, &round);
-    }
+    for (int i = 0; i < game->playersNumber; i++)
+        game_createAndAddRound(game, type);
 
     int position = 2 * game->playersNumber + 5;
     for (int i = 0; i < 6; i++) {
         int type = game->rounds[position]->roundType - roundType;
-        round = round_createRound(type);
-        game_addRound(game, &round);
+        game_createAndAddRound(game, type);
         position++;
     }
 
-    for (int i = 0; i < game->playersNumber; i++) {
-        round = round_createRound(game->gameType);
-        game_addRound(game, &round);
-    }
+    for (int i = 0; i < game->playersNumber; i++)
+        game_createAndAddRound(game, game->gameType);
 
     return FUNCTION_NO_ERROR;
 }
 
-int game_rewardsPlayer(const struct Game* game, const struct Player* player,
+int game_rewardsPlayer(struct Game* game, const struct Player* player,
                        int currentRound)
 {
     if (game == NULL)
@@ -217,53 +401,62 @@ int game_rewardsPlayer(const struct Game* game, const struct Player* player,
         return PLAYER_NULL;
     if (currentRound < 0 || currentRound >= MAX_GAME_ROUNDS)
         return ILLEGAL_VALUE;
-    if (currentRound - BONUS_ROUNDS_NUMBER + 1 < 0)
+
+    struct Round *round = game->rounds[currentRound];
+    if (round == NULL)
+        return ROUND_NULL;
+
+    int index = game_getPlayerPosition(game, player);
+    if (index < 0)
+        return index;
+    int position = round_getPlayerId(round, player);
+    if (position < 0)
+        return position;
+
+    if (game->streakRound[index] >= currentRound)
         return FUNCTION_NO_ERROR;
+    if (game->streakRound[index] != currentRound - 1) {
+        game->wonStreak[index]  = 0;
+        game->lostStreak[index] = 0;
+    }
+    game->streakRound[index] = currentRound;
 
-    int wonRounds  = 0;
-    int lostRounds = 0;
-    int i = currentRound - BONUS_ROUNDS_NUMBER + 1;
-
-    for (; i <= currentRound; i++)
-        if (game->rounds[i] != NULL) {
-            int position = round_getPlayerId(game->rounds[i], player);
-            if (position < 0)
-                return position;
-            if (game->rounds[i]->bonus[position] == 0 && 
-                game->rounds[i]->roundType != 1) {
-                if (game->rounds[i]->bids[position] == 
-                    game->rounds[i]->handsNumber[position])
-                    wonRounds++;
-                else
-                    lostRounds++;
-            }
-        } else {
-            return ROUND_NULL;
-        }
+    if (round->roundType == 1 || round->bonus[position] != 0) {
+        game->wonStreak[index]  = 0;
+        game->lostStreak[index] = 0;
+        return FUNCTION_NO_ERROR;
+    }
 
-    int position = round_getPlayerId(game->rounds[currentRound], player);
-    if (wonRounds == BONUS_ROUNDS_NUMBER) {
-        game->rounds[currentRound]->pointsNumber[position] += BONUS;
-        game->rounds[currentRound]->bonus[position]         = 1;
+    if (round->bids[position] == round->handsNumber[position]) {
+        game->wonStreak[index]++;
+        game->lostStreak[index] = 0;
+    } else {
+        game->lostStreak[index]++;
+        game->wonStreak[index] = 0;
+    }
+
+    if (game->wonStreak[index] == BONUS_ROUNDS_NUMBER) {
+        round->pointsNumber[position] += BONUS;
+        round->bonus[position]         = 1;
+        game->wonStreak[index]         = 0;
         return 1;
     }
-    if (lostRounds == BONUS_ROUNDS_NUMBER) {
-        game->rounds[currentRound]->pointsNumber[position] -= BONUS;
-        game->rounds[currentRound]->bonus[position]         = 2;
+    if (game->lostStreak[index] == BONUS_ROUNDS_NUMBER) {
+        round->pointsNumber[position] -= BONUS;
+        round->bonus[position]         = 2;
+        game->lostStreak[index]        = 0;
         return 2;
     }
 
     return FUNCTION_NO_ERROR;
 }
 
-int game_rewardsPlayersFromGame(const struct Game* game, int currentRound)
+int game_rewardsPlayersFromGame(struct Game* game, int currentRound)
 {
     if (game == NULL)
         return GAME_NULL;
     if (currentRound < 0 || currentRound >= MAX_GAME_ROUNDS)
         return ILLEGAL_VALUE;
-    if (currentRound - BONUS_ROUNDS_NUMBER + 1 < 0)
-        return FUNCTION_NO_ERROR;
 
     for (int i = 0; i < MAX_GAME_PLAYERS; i++)
         if (game->players[i] != NULL) {
@@ -284,13 +477,11 @@ int game_getPlayerPosition(const struct Game *game,
     if (player == NULL)
         return PLAYER_NULL;
 
-    int position = -1;
-    for (int i = 0; i < MAX_GAME_PLAYERS; i++)
-        if (game->players[i] != NULL) {
-            position++;
-            if (game->players[i] == player)
-                return position;
-        }
+    /* The players are added in the first free positions and they are never
+     * removed, so the position of a player is his seat. */
+    if (player->seat >= 0 && player->seat < MAX_GAME_PLAYERS &&
+        game->players[player->seat] == player)
+        return player->seat;
 
     return NOT_FOUND;
 }
@@ -304,35 +495,137 @@ int game_checkIfPlayerIsAtReward(const struct Game* game, int currentRound,
         return PLAYER_NULL;
     if (currentRound < 0 || currentRound >= MAX_GAME_ROUNDS)
         return ILLEGAL_VALUE;
-    if (currentRound - BONUS_ROUNDS_NUMBER + 1 < 0)
-        return FUNCTION_NO_ERROR;
 
-    int wonRounds  = 0;
-    int lostRounds = 0;
-    int i = currentRound - BONUS_ROUNDS_NUMBER + 1;
-
-    for (; i < currentRound; i++)
-        if (game->rounds[i] != NULL) {
-            int position = round_getPlayerId(game->rounds[i], player);
-            if (position < 0)
-                return position;
-            if (game->rounds[i]->bonus[position] == 0 && 
-                game->rounds[i]->roundType != 1) {
-                if (game->rounds[i]->bids[position] == 
-                    game->rounds[i]->handsNumber[position])
-                    wonRounds++;
-                else
-                    lostRounds++;
-            }
-        } else {
-            return ROUND_NULL;
-        }
+    int index = game_getPlayerPosition(game, player);
+    if (index < 0)
+        return index;
+
+    /* The streaks only tell about the round after the last counted one. A
+     * round already counted can't be checked anymore and the rounds which
+     * weren't counted broke the streaks (see game_rewardsPlayer()). */
+    if (game->streakRound[index] >= currentRound)
+        return ILLEGAL_VALUE;
+    if (game->streakRound[index] != currentRound - 1)
+        return FUNCTION_NO_ERROR;
 
-    if (wonRounds == BONUS_ROUNDS_NUMBER - 1)
+    if (game->wonStreak[index] == BONUS_ROUNDS_NUMBER - 1)
         return 1;
-    if (lostRounds == BONUS_ROUNDS_NUMBER - 1)
+    if (game->lostStreak[index] == BONUS_ROUNDS_NUMBER - 1)
         return 2;
 
     return FUNCTION_NO_ERROR;
 }
 
+int game_getRoundsNumber(const struct Game* game)
+{
+    if (game == NULL)
+        return GAME_NULL;
+
+    return 12 + 3 * game->playersNumber;
+}
+
+/**
+ * @brief Function asks all the players of a round for their bids.
+ */
+static int game_playBids(struct Round* round,
+                         const struct GameCallbacks* callbacks)
+{
+    for (int i = 0; i < MAX_GAME_PLAYERS; i++) {
+        struct Player *player = round->players[i];
+        if (player == NULL)
+            continue;
+
+        int bid = callbacks->getBid(player, round, callbacks->data);
+        int check = round_applyMove(round, player, BID_MOVE, bid);
+        if (check != FUNCTION_NO_ERROR)
+            return check;
+    }
+
+    return FUNCTION_NO_ERROR;
+}
+
+/**
+ * @brief Function plays the current hand of a round. When the hand ends, the
+ *        winner is counted and he starts the next hand.
+ */
+static int game_playHand(struct Round* round,
+                         const struct GameCallbacks* callbacks)
+{
+    for (int i = 0; i < round->playersNumber; i++) {
+        struct Player *player = round->hand->players[i];
+        int cardId = callbacks->getCardId(player, round, callbacks->data);
+        int check = round_applyMove(round, player, CARD_MOVE, cardId);
+        if (check != FUNCTION_NO_ERROR)
+            return check;
+    }
+
+    return FUNCTION_NO_ERROR;
+}
+
+int game_playRound(struct Game* game, const struct GameCallbacks* callbacks)
+{
+    if (game == NULL)
+        return GAME_NULL;
+    if (callbacks == NULL || callbacks->getBid == NULL ||
+        callbacks->getCardId == NULL)
+        return POINTER_NULL;
+
+    int roundId = game->currentRound + 1;
+    if (roundId >= game_getRoundsNumber(game))
+        return GAME_OVER;
+
+    struct Round *round = game->rounds[roundId];
+    if (round == NULL)
+        return ROUND_NULL;
+
+    if (roundId > 0)
+        round_copyScore(game->rounds[roundId - 1], round);
+
+    int check = game_initializeDeck(game);
+    if (check != FUNCTION_NO_ERROR)
+        return check;
+    game_shuffleDeck(game);
+    check = round_distributeDeck(round, game->deck);
+    if (check != FUNCTION_NO_ERROR)
+        return check;
+
+    game->currentRound = roundId;
+
+    check = game_playBids(round, callbacks);
+    if (check != FUNCTION_NO_ERROR)
+        return check;
+
+    round_initializeHand(round);
+    round_addPlayersInHand(round, 0);
+    for (int i = 0; i < round->roundType; i++) {
+        check = game_playHand(round, callbacks);
+        if (check != FUNCTION_NO_ERROR)
+            return check;
+        if (callbacks->endHand != NULL)
+            callbacks->endHand(game, roundId, callbacks->data);
+    }
+
+    if (round_repeatRound(round) == 1) {
+        round_reinitializeRound(round);
+        game->currentRound--;
+        return FUNCTION_NO_ERROR;
+    }
+
+    round_determinesScore(round);
+    game_rewardsPlayersFromGame(game, roundId);
+    if (callbacks->endRound != NULL)
+        callbacks->endRound(game, roundId, callbacks->data);
+
+    return FUNCTION_NO_ERROR;
+}
+
+int game_run(struct Game* game, const struct GameCallbacks* callbacks)
+{
+    int check;
+    while ((check = game_playRound(game, callbacks)) == FUNCTION_NO_ERROR);
+
+    if (check == GAME_OVER)
+        return FUNCTION_NO_ERROR;
+
+    return check;
+}
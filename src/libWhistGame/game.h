@@ -9,12 +9,15 @@
 #include "deck.h"
 #include "player.h"
 #include "round.h"
+#include "arena.h"
 #include "constants.h"
 
 /**
  * @struct Game
  *
  * @brief Game structure. Structure used to keep informations about a game.
+ *        The game, its deck, its players and its rounds are allocated from
+ *        the arena of the game.
  *
  * @var Game::playersNumber
  *      The number of the player that are in game.
@@ -28,14 +31,79 @@
  *      Pointer to the players of the game.
  * @var Game::rounds
  *      Pointer to the rounds of the game.
+ * @var Game::arena
+ *      Pointer to the arena from which are allocated the objects of the game.
+ * @var Game::random
+ *      The generator used to shuffle the deck of the game.
+ * @var Game::wonStreak
+ *      For every player from Game::players, the number of the last rounds
+ *      which he won them one after another and which count for a reward.
+ * @var Game::lostStreak
+ *      For every player from Game::players, the number of the last rounds
+ *      which he lost them one after another and which count for a reward.
+ * @var Game::streakRound
+ *      For every player from Game::players, the id of the last round counted
+ *      in his streaks or -1.
  */
 struct Game {
     int playersNumber;
     int gameType;
     int currentRound;
+    struct Arena *arena;
+    struct Random random;
     struct Deck *deck;
     struct Player *players[MAX_GAME_PLAYERS];
     struct Round *rounds[MAX_GAME_ROUNDS];
+    int wonStreak[MAX_GAME_PLAYERS];
+    int lostStreak[MAX_GAME_PLAYERS];
+    int streakRound[MAX_GAME_PLAYERS];
+};
+
+/**
+ * @brief Function which gets the bid of a player, it must return a bid for
+ *        which round_checkBid() succeeds.
+ */
+typedef int (*GameBidFunction)(const struct Player *player,
+                               const struct Round *round, void *data);
+
+/**
+ * @brief Function which gets the id of the card put down by a player, it must
+ *        return a card for which hand_checkCard() returns 1.
+ */
+typedef int (*GameCardFunction)(const struct Player *player,
+                                const struct Round *round, void *data);
+
+/**
+ * @brief Function which is notified when a hand or a round of a game ended.
+ */
+typedef void (*GameEventFunction)(const struct Game *game, int roundId,
+                                  void *data);
+
+/**
+ * @struct GameCallbacks
+ *
+ * @brief GameCallbacks structure. Structure used by game_run() to ask the
+ *        players for their bids and cards.
+ *
+ * @var GameCallbacks::getBid
+ *      The function which gets the bids.
+ * @var GameCallbacks::getCardId
+ *      The function which gets the cards.
+ * @var GameCallbacks::endHand
+ *      The function called after every hand, it can be NULL. The cards of the
+ *      hand are in the last move of the round.
+ * @var GameCallbacks::endRound
+ *      The function called after every round which isn't repeated, it can be
+ *      NULL.
+ * @var GameCallbacks::data
+ *      Pointer which is passed to all the functions.
+ */
+struct GameCallbacks {
+    GameBidFunction getBid;
+    GameCardFunction getCardId;
+    GameEventFunction endHand;
+    GameEventFunction endRound;
+    void *data;
 };
 
 /**
@@ -48,7 +116,8 @@ struct Game {
 struct Game *game_createGame(int gameType);
 
 /**
- * @brief Function releases the memory a game and makes pointer NULL.
+ * @brief Function releases the memory a game and makes pointer NULL. All the
+ *        objects of the game are released with its arena.
  *
  * @param game Pointer to pointer to the game which to be released.
  *
@@ -57,7 +126,64 @@ struct Game *game_createGame(int gameType);
 int game_deleteGame(struct Game **game);
 
 /**
- * @brief Function adds deck in game.
+ * @brief Function allocates a copy of a game, with copies of its deck, its
+ *        players and its rounds. The copy is made with a single allocation
+ *        and a single memcpy.
+ *
+ * @param game Pointer to the game which is copied.
+ *
+ * @return Pointer to the new game on success, NULL on failure.
+ */
+struct Game *game_cloneGame(const struct Game *game);
+
+/**
+ * @brief Function overwrites a game with a copy of another game, without
+ *        allocating memory. The pointer to the destination remains valid, the
+ *        pointers to its old players and rounds become invalid.
+ *
+ * @param destination Pointer to the game which is overwritten.
+ * @param source Pointer to the game which is copied.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int game_copyGame(struct Game *destination, const struct Game *source);
+
+/**
+ * @brief Function releases all the objects of a game and initializes the game
+ *        again, reusing its arena. The pointer to the game remains valid and
+ *        the generator of the game isn't reseeded.
+ *
+ * @param game Pointer to the game which to be reinitialized.
+ * @param gameType The type of the game (1 or 8).
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int game_reinitializeGame(struct Game *game, int gameType);
+
+/**
+ * @brief Function sets the seed of the generator used to shuffle the deck of
+ *        a game. Two games with the same seed and the same players get the
+ *        same deals.
+ *
+ * @param game Pointer to the game for which is set the seed.
+ * @param seed The seed.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int game_setSeed(struct Game *game, uint64_t seed);
+
+/**
+ * @brief Function shuffles the deck of a game with the generator of the game.
+ *
+ * @param game Pointer to the game whose deck is shuffled.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int game_shuffleDeck(struct Game *game);
+
+/**
+ * @brief Function adds deck in game. The deck is copied in the arena of the
+ *        game and then it is released.
  *
  * @param game Pointer to the game in which will be added the deck.
  * @param deck Pointer to pointer to the deck which to be added.
@@ -67,7 +193,18 @@ int game_deleteGame(struct Game **game);
 int game_addDeck(struct Game *game, struct Deck **deck);
 
 /**
- * @brief Function adds a player in game.
+ * @brief Function puts all the cards in the deck of the game. The deck is
+ *        allocated from the arena of the game the first time.
+ *
+ * @param game Pointer to the game for which is initialized the deck.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int game_initializeDeck(struct Game *game);
+
+/**
+ * @brief Function adds a player in game. The player is copied in the arena of
+ *        the game and then it is released.
  *
  * @param game Pointer to the game in which to be added the player.
  * @param player Pointer to pointer to the player which to be added.
@@ -77,7 +214,8 @@ int game_addDeck(struct Game *game, struct Deck **deck);
 int game_addPlayer(struct Game *game, struct Player **player);
 
 /**
- * @brief Function adds a round in game.
+ * @brief Function adds a round in game. The round is copied in the arena of
+ *        the game and then it is released.
  *
  * @param game Pointer to the game in which to be added the round.
  * @param player Pointer to pointer to the round which to be added.
@@ -119,7 +257,9 @@ int game_createAndAddRounds(struct Game *game);
 
 /**
  * @brief This function check if a player must rewarded and if the player must
- *        to be rewarded then he is rewarded.
+ *        to be rewarded then he is rewarded. The streaks of the player are
+ *        updated with the current round, so the function must be called once
+ *        for every round, after what the score of the round was determined.
  *
  * @param game Pointer to the game in which are the rounds and the player.
  * @param player Pointer to the player which must checked.
@@ -130,7 +270,7 @@ int game_createAndAddRounds(struct Game *game);
  *         2 if the player was rewarded on negative.
  *         A negative value on failure.
  */
-int game_rewardsPlayer(const struct Game *game, const struct Player *player,
+int game_rewardsPlayer(struct Game *game, const struct Player *player,
                        int currentRound);
 
 /**
@@ -143,7 +283,7 @@ int game_rewardsPlayer(const struct Game *game, const struct Player *player,
  *
  * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
  */
-int game_rewardsPlayersFromGame(const struct Game *game, int currentRound);
+int game_rewardsPlayersFromGame(struct Game *game, int currentRound);
 
 /**
  * @brief Function calculates the position a player in game. The function
@@ -159,7 +299,11 @@ int game_getPlayerPosition(const struct Game *game,
                            const struct Player *player);
 
 /**
- * @brief Function check if the player is at reward.
+ * @brief Function check if the player is at reward. The streaks of the player
+ *        are read as game_rewardsPlayer() left them, so the check is valid
+ *        only before the current round is counted. If rounds before the
+ *        current round weren't counted, the streaks are broken and the player
+ *        isn't at reward.
  *
  * @param game Pointer to the game in which is the player.
  * @param currentround The id of the current round.
@@ -168,10 +312,48 @@ int game_getPlayerPosition(const struct Game *game,
  * @return FUNCTION_NO_ERROR or 0 if the player isn't at reward.
  *         1 if the player is at positive reward.
  *         2 if the player is at negative reward.
+ *         ILLEGAL_VALUE if the current round was already counted.
  *         A negative value on failure.
  */
 int game_checkIfPlayerIsAtReward(const struct Game* game, int currentRound,
                                  const struct Player* player);
 
+/**
+ * @brief Function calculates the number of the rounds of a game.
+ *
+ * @param game Pointer to the game.
+ *
+ * @return The number of the rounds on success, a negative value on failure.
+ */
+int game_getRoundsNumber(const struct Game *game);
+
+/**
+ * @brief Function plays the round which follows after game->currentRound:
+ *        deals the cards, asks for the bids and the cards, and then
+ *        determines the score and rewards the players. If the round must be
+ *        repeated, game->currentRound isn't advanced.
+ *
+ * @param game Pointer to the game, its rounds must be created and must have
+ *             the players.
+ * @param callbacks Pointer to the functions used to get bids and cards.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success.
+ *         GAME_OVER if all the rounds were played.
+ *         other value on failure.
+ */
+int game_playRound(struct Game *game, const struct GameCallbacks *callbacks);
+
+/**
+ * @brief Function plays all the remaining rounds of a game, without any
+ *        delay between the moves.
+ *
+ * @param game Pointer to the game, its rounds must be created and must have
+ *             the players.
+ * @param callbacks Pointer to the functions used to get bids and cards.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int game_run(struct Game *game, const struct GameCallbacks *callbacks);
+
 #endif
 
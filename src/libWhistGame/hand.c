@@ -16,12 +16,28 @@ struct Hand *hand_createHand()
     if (hand == NULL)
         return NULL;
 
+    hand_initializeHand(hand);
+
+    return hand;
+}
+
+int hand_initializeHand(struct Hand* hand)
+{
+    if (hand == NULL)
+        return HAND_NULL;
+
     for (int i = 0; i < MAX_GAME_PLAYERS; i++) {
-        hand->cards[i]   = NULL;
+        hand->cards[i]   = EMPTY_CARD;
         hand->players[i] = NULL;
     }
+    hand->playersNumber = 0;
+    hand->firstSeat     = 0;
+    hand->trump         = SuitEnd;
+    hand->cardsNumber   = 0;
+    hand->winnerId      = -1;
+    hand->winningCard   = EMPTY_CARD;
 
-    return hand;
+    return FUNCTION_NO_ERROR;
 }
 
 int hand_deleteHand(struct Hand** hand)
@@ -31,12 +47,8 @@ int hand_deleteHand(struct Hand** hand)
     if (*hand == NULL)
         return HAND_NULL;
 
-    for (int i = 0; i < MAX_GAME_PLAYERS; i++) {
-        if ((*hand)->cards[i] != NULL)
-            deck_deleteCard(&((*hand)->cards[i]));
-        if ((*hand)->players[i] != NULL)
-            (*hand)->players[i] = NULL;
-    }
+    for (int i = 0; i < MAX_GAME_PLAYERS; i++)
+        (*hand)->players[i] = NULL;
 
     free(*hand);
     *hand = NULL;
@@ -61,36 +73,122 @@ int hand_addPlayer(struct Hand* hand, struct Player* player)
 
     if (position != -1) {
         hand->players[position] = player;
+        hand->playersNumber++;
+        if (position == 0)
+            hand->firstSeat = player->seat;
         return FUNCTION_NO_ERROR;
     }
 
     return FULL;
 }
 
+/**
+ * @brief Function counts the cards of a hand and determines again the winner
+ *        comparing the cards in the order of the players.
+ */
+static void hand_updateWinner(struct Hand* hand)
+{
+    hand->cardsNumber = 0;
+    hand->winnerId    = -1;
+    hand->winningCard = EMPTY_CARD;
+
+    if (!deck_isCard(hand->cards[0])) {
+        for (int i = 0; i < MAX_GAME_PLAYERS; i++)
+            if (deck_isCard(hand->cards[i]))
+                hand->cardsNumber++;
+        return;
+    }
+
+    for (int i = 0; i < MAX_GAME_PLAYERS; i++)
+        if (deck_isCard(hand->cards[i])) {
+            hand->cardsNumber++;
+            if (i == 0 || deck_compareCards(hand->winningCard,
+                                            hand->cards[i],
+                                            hand->trump) == 2) {
+                hand->winnerId    = i;
+                hand->winningCard = hand->cards[i];
+            }
+        }
+}
+
 int hand_addCard(struct Hand* hand, const struct Player* player,
-                 struct Card** card)
+                 struct Card card)
 {
     if (hand == NULL)
         return HAND_NULL;
-    if (card == NULL)
-        return POINTER_NULL;
-    if (*card == NULL)
+    if (!deck_isCard(card))
         return CARD_NULL;
     if (player == NULL)
         return PLAYER_NULL;
 
-    for (int i = 0; i < MAX_GAME_PLAYERS; i++)
-        if (hand->players[i] == player) {
-            hand->cards[i] = *card;
-            *card = NULL;
-            return FUNCTION_NO_ERROR;
+    int position = hand_getPlayerId(hand, player);
+    if (position < 0)
+        return position;
+
+    /* The winner doesn't depend on the order of the cards once the first
+     * card is known, so a new card is only compared with the winning card. */
+    int isNew = !deck_isCard(hand->cards[position]);
+    hand->cards[position] = card;
+
+    if (isNew && position == 0 && hand->cardsNumber == 0) {
+        hand->cardsNumber = 1;
+        hand->winnerId    = 0;
+        hand->winningCard = card;
+    } else if (isNew && position > 0 && hand->winnerId >= 0) {
+        hand->cardsNumber++;
+        if (deck_compareCards(hand->winningCard, card, hand->trump) == 2) {
+            hand->winnerId    = position;
+            hand->winningCard = card;
         }
+    } else {
+        hand_updateWinner(hand);
+    }
 
-    return NOT_FOUND;
+    return FUNCTION_NO_ERROR;
+}
+
+int hand_removeCard(struct Hand* hand, const struct Player* player)
+{
+    if (hand == NULL)
+        return HAND_NULL;
+    if (player == NULL)
+        return PLAYER_NULL;
+
+    int position = hand_getPlayerId(hand, player);
+    if (position < 0)
+        return position;
+    if (!deck_isCard(hand->cards[position]))
+        return CARD_NULL;
+
+    hand->cards[position] = EMPTY_CARD;
+    hand_updateWinner(hand);
+
+    return FUNCTION_NO_ERROR;
+}
+
+int hand_setTrump(struct Hand* hand, struct Card trump)
+{
+    if (hand == NULL)
+        return HAND_NULL;
+
+    hand->trump = deck_getCardSuit(trump);
+    hand_updateWinner(hand);
+
+    return FUNCTION_NO_ERROR;
+}
+
+int hand_getWinnerId(const struct Hand* hand)
+{
+    if (hand == NULL)
+        return HAND_NULL;
+    if (hand->winnerId < 0)
+        return NOT_FOUND;
+
+    return hand->winnerId;
 }
 
 int hand_checkCard(const struct Hand* hand, const struct Player* player,
-                   int cardId, const struct Card* trump)
+                   int cardId, struct Card trump)
 {
     if (hand == NULL)
         return HAND_NULL;
@@ -98,35 +196,37 @@ int hand_checkCard(const struct Hand* hand, const struct Player* player,
         return PLAYER_NULL;
     if (cardId < 0 || cardId > MAX_CARDS - 1)
         return ILLEGAL_VALUE;
-    if (player->hand[cardId] == NULL)
+    if (!deck_isCard(player->hand[cardId]))
         return CARD_NULL;
-    if (hand->cards[0] == NULL)
-        return 1;
-
-    int playerFirstCard  = 0;
-    int playerSuitTrump  = 0;
-    enum Suit suitTrump;
-    if (trump != NULL)
-        suitTrump = trump->suit;
-    else
-        suitTrump = SuitEnd;
-
-    for (int i = 0; i < MAX_CARDS; i++) {
-        if (player->hand[i] != NULL) {
-            if (player->hand[i]->suit == hand->cards[0]->suit)
-                playerFirstCard = 1;
-            if (suitTrump != SuitEnd && player->hand[i]->suit == trump->suit)
-               playerSuitTrump = 1;
-        }
-    }
 
-    if ((player->hand[cardId]->suit == hand->cards[0]->suit) ||
-        (suitTrump == SuitEnd && playerFirstCard == 0) ||
-        (playerFirstCard == 0 && playerSuitTrump == 0) ||
-        (player->hand[cardId]->suit == suitTrump && playerFirstCard == 0))
-        return 1;
+    return (hand_getLegalCards(hand, player, trump) >> cardId) & 1;
+}
+
+int hand_getLegalCards(const struct Hand* hand, const struct Player* player,
+                       struct Card trump)
+{
+    if (hand == NULL)
+        return HAND_NULL;
+    if (player == NULL)
+        return PLAYER_NULL;
+
+    /* The cards of each suit, the last position is for the empty cards. */
+    int suits[SuitEnd + 1] = {0};
+    for (int i = 0; i < MAX_CARDS; i++)
+        suits[deck_getCardSuit(player->hand[i])] |= 1 << i;
 
-    return 0;
+    int cards = ((1 << MAX_CARDS) - 1) & ~suits[SuitEnd];
+    int first = suits[deck_getCardSuit(hand->cards[0])];
+    int trumps = suits[deck_getCardSuit(trump)];
+
+    if (!deck_isCard(hand->cards[0]))
+        return cards;
+    if (first != 0)
+        return first;
+    if (deck_isCard(trump) && trumps != 0)
+        return trumps;
+
+    return cards;
 }
 
 int hand_getPlayerId(const struct Hand* hand, const struct Player* player)
@@ -136,6 +236,14 @@ int hand_getPlayerId(const struct Hand* hand, const struct Player* player)
     if (player == NULL)
         return PLAYER_NULL;
 
+    if (player->seat >= 0 && hand->playersNumber > 0) {
+        int position = player->seat - hand->firstSeat;
+        if (position < 0)
+            position += hand->playersNumber;
+        if (position < MAX_GAME_PLAYERS && hand->players[position] == player)
+            return position;
+    }
+
     for (int i = 0; i < MAX_GAME_PLAYERS; i++)
         if (hand->players[i] == player)
             return i;
@@ -17,13 +17,35 @@
  *        be added in the order of the bids.
  *
  * @var Hand::cards
- *      Pointer to the cards of the hand.
+ *      The cards of the hand, EMPTY_CARD for the players which didn't put down
+ *      a card yet.
  * @var Hand::players
  *      Pointer to the players of the hand.
+ * @var Hand::playersNumber
+ *      The number of the players from Hand::players.
+ * @var Hand::firstSeat
+ *      The seat of the first player of the hand, the player with the seat s
+ *      has the id s - firstSeat modulo playersNumber.
+ * @var Hand::trump
+ *      The suit of the trump or SuitEnd if the round doesn't have a trump.
+ * @var Hand::cardsNumber
+ *      The number of the cards put down.
+ * @var Hand::winnerId
+ *      The id of the player which wins the hand with the cards put down until
+ *      now, -1 if there isn't a card.
+ * @var Hand::winningCard
+ *      The card which wins the hand until now, EMPTY_CARD if there isn't a
+ *      card.
  */
 struct Hand {
-    struct Card *cards[MAX_GAME_PLAYERS];
+    struct Card cards[MAX_GAME_PLAYERS];
     struct Player *players[MAX_GAME_PLAYERS];
+    int playersNumber;
+    int firstSeat;
+    enum Suit trump;
+    int cardsNumber;
+    int winnerId;
+    struct Card winningCard;
 };
 
 /**
@@ -33,6 +55,15 @@ struct Hand {
  */
 struct Hand *hand_createHand();
 
+/**
+ * @brief Function initializes a hand whose memory is already allocated.
+ *
+ * @param hand Pointer to the hand which to be initialized.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int hand_initializeHand(struct Hand* hand);
+
 /**
  * @brief Function releases the memory a hand.
  *
@@ -57,12 +88,44 @@ int hand_addPlayer(struct Hand* hand, struct Player* player);
  *
  * @param hand Pointer to the hand in which to be added the card.
  * @param player Pointer to the player which places the card.
- * @param card Pointer to pointer to the card which is added.
+ * @param card The card which is added.
  *
  * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
  */
 int hand_addCard(struct Hand* hand, const struct Player* player,
-                 struct Card** card);
+                 struct Card card);
+
+/**
+ * @brief Function takes back the card put down by a player in a hand.
+ *
+ * @param hand Pointer to the hand from which is taken back the card.
+ * @param player Pointer to the player which put down the card.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int hand_removeCard(struct Hand* hand, const struct Player* player);
+
+/**
+ * @brief Function sets the trump with which are compared the cards of a hand.
+ *
+ * @param hand Pointer to the hand for which is set the trump.
+ * @param trump The card which is the trump of the round or EMPTY_CARD if
+ *              the round doesn't have a trump.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int hand_setTrump(struct Hand* hand, struct Card trump);
+
+/**
+ * @brief Function gets the player which wins a hand with the cards put down
+ *        until now. The winner is updated by hand_addCard().
+ *
+ * @param hand Pointer to the hand.
+ *
+ * @return The id of the player on success, a negative value on failure or if
+ *         there isn't a card.
+ */
+int hand_getWinnerId(const struct Hand* hand);
 
 /**
  * @brief Function checks if a card can be put down.
@@ -71,17 +134,36 @@ int hand_addCard(struct Hand* hand, const struct Player* player,
  *             down.
  * @param player Pointer to the player which has the card.
  * @param cardId The id of the card from player's hand.
- * @param trump Pointer to the card which is the trump of the round.
+ * @param trump The card which is the trump of the round or EMPTY_CARD if
+ *              the round doesn't have a trump.
  *
  * @return 1 if the card can be put down.
  *         0 if the card can't be put down. 
  *         other value on failure.
  */
 int hand_checkCard(const struct Hand* hand, const struct Player* player,
-                   int cardId, const struct Card* trump);
+                   int cardId, struct Card trump);
+
+/**
+ * @brief Function gets all the cards which a player can put down: the cards
+ *        of the suit of the first card if he has them, else the trumps if he
+ *        has them, else all his cards.
+ *
+ * @param hand Pointer to the hand in which the cards are put down.
+ * @param player Pointer to the player which has the cards.
+ * @param trump The card which is the trump of the round or EMPTY_CARD if
+ *              the round doesn't have a trump.
+ *
+ * @return A mask in which the bit i is set if the card with the id i from
+ *         player's hand can be put down, a negative value on failure.
+ */
+int hand_getLegalCards(const struct Hand* hand, const struct Player* player,
+                       struct Card trump);
 
 /**
- * @brief Function get the id of the player.
+ * @brief Function get the id of the player. The id is calculated from the
+ *        seat of the player, the players are searched only if they don't
+ *        have seats.
  *
  * @param hand Pointer to the hand in which is the player.
  * @param player Pointer to the player for which it get the id.
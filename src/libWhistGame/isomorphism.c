@@ -0,0 +1,94 @@
+/**
+ * @file isomorphism.c
+ * @brief In this file are defined functions used for bringing the cards in
+ *        a canonical form, these functions are declared in the header file
+ *        isomorphism.h.
+ */
+
+#include "isomorphism.h"
+
+#include <stdlib.h>
+
+int isomorphism_getWidePermutation(const uint64_t* sets, int setsNumber,
+                                   enum Suit trump,
+                                   struct SuitPermutation* permutation)
+{
+    if (sets == NULL || permutation == NULL)
+        return POINTER_NULL;
+    if (setsNumber < 1 || setsNumber > ISOMORPHISM_MAX_SETS)
+        return ILLEGAL_VALUE;
+    if (trump < DIAMONDS || trump > SuitEnd)
+        return ILLEGAL_VALUE;
+
+    /* The cards of a suit are compared as two numbers, the first bitboard
+     * in the most significant bits. */
+    uint64_t high[SuitEnd];
+    uint64_t low[SuitEnd];
+    enum Suit order[SuitEnd];
+    int suitsNumber = 0;
+
+    for (enum Suit suit = DIAMONDS; suit < SuitEnd; suit++) {
+        if (suit == trump)
+            continue;
+
+        uint64_t suitHigh = 0;
+        uint64_t suitLow  = 0;
+        for (int i = 0; i < setsNumber; i++) {
+            uint64_t cards = (sets[i] >> (suit * RANKS_NUMBER)) &
+                             BITBOARD_SUIT_MASK;
+            if (i < ISOMORPHISM_PACKED_SETS)
+                suitHigh = (suitHigh << RANKS_NUMBER) | cards;
+            else
+                suitLow = (suitLow << RANKS_NUMBER) | cards;
+        }
+
+        int i = suitsNumber++;
+        for (; i > 0 && (high[i - 1] > suitHigh ||
+                         (high[i - 1] == suitHigh && low[i - 1] > suitLow));
+             i--) {
+            high[i]  = high[i - 1];
+            low[i]   = low[i - 1];
+            order[i] = order[i - 1];
+        }
+        high[i]  = suitHigh;
+        low[i]   = suitLow;
+        order[i] = suit;
+    }
+
+    for (int i = 0; i < suitsNumber; i++)
+        permutation->suits[order[i]] = i;
+    if (trump != SuitEnd)
+        permutation->suits[trump] = SuitEnd - 1;
+
+    return FUNCTION_NO_ERROR;
+}
+
+int isomorphism_canonicalize(uint64_t* sets, int setsNumber, enum Suit trump,
+                             struct SuitPermutation* permutation)
+{
+    struct SuitPermutation canonical;
+    int check = isomorphism_getPermutation(sets, setsNumber, trump,
+                                           &canonical);
+    if (check != FUNCTION_NO_ERROR)
+        return check;
+
+    for (int i = 0; i < setsNumber; i++)
+        sets[i] = isomorphism_permuteCards(sets[i], &canonical);
+
+    if (permutation != NULL)
+        *permutation = canonical;
+
+    return FUNCTION_NO_ERROR;
+}
+
+int isomorphism_invertPermutation(const struct SuitPermutation* permutation,
+                                  struct SuitPermutation* inverse)
+{
+    if (permutation == NULL || inverse == NULL)
+        return POINTER_NULL;
+
+    for (int i = 0; i < SuitEnd; i++)
+        inverse->suits[permutation->suits[i]] = i;
+
+    return FUNCTION_NO_ERROR;
+}
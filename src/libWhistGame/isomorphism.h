@@ -0,0 +1,193 @@
+/**
+ * @file isomorphism.h
+ * @brief SuitPermutation structure, as well as the functions which bring
+ *        the cards of a round in a canonical form. Two deals which differ
+ *        only by a permutation of the suits other than the trump are played
+ *        in the same way, so a cache can keep a single entry for them: the
+ *        entry of the canonical deal, in which the trump is the last suit
+ *        and the other suits are ordered by their cards.
+ */
+
+#ifndef ISOMORPHISM_H
+#define ISOMORPHISM_H
+
+#include "bitboard.h"
+#include "constants.h"
+#include "errors.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief The maximum number of bitboards which can be brought together in
+ *        a canonical form.
+ */
+#define ISOMORPHISM_MAX_SETS 10
+
+/**
+ * @brief The number of the bitboards whose cards of a suit are packed in a
+ *        64-bit value, together with the suit.
+ */
+#define ISOMORPHISM_PACKED_SETS ((64 - 2) / RANKS_NUMBER)
+
+/**
+ * @struct SuitPermutation
+ *
+ * @brief SuitPermutation structure.
+ *
+ * @var SuitPermutation::suits
+ *      For every suit, the suit in which are moved its cards.
+ */
+struct SuitPermutation {
+    enum Suit suits[SuitEnd];
+};
+
+/**
+ * @brief Function moves the cards of a bitboard in the suits given by a
+ *        permutation, the ranks of the cards aren't changed.
+ *
+ * @param cards The bitboard.
+ * @param permutation Pointer to the permutation.
+ *
+ * @return The bitboard with the moved cards.
+ */
+static inline uint64_t isomorphism_permuteCards(
+    uint64_t cards, const struct SuitPermutation* permutation)
+{
+    uint64_t permuted = 0;
+    for (int i = 0; i < SuitEnd; i++)
+        permuted |= ((cards >> (i * RANKS_NUMBER)) & BITBOARD_SUIT_MASK) <<
+                    (permutation->suits[i] * RANKS_NUMBER);
+
+    return permuted;
+}
+
+/**
+ * @brief Function moves a card in the suit given by a permutation.
+ *
+ * @param index The position of the bit of the card.
+ * @param permutation Pointer to the permutation.
+ *
+ * @return The position of the bit of the moved card, index if it isn't a
+ *         valid position.
+ */
+static inline int isomorphism_permuteCard(
+    int index, const struct SuitPermutation* permutation)
+{
+    if (index < 0 || index >= DECK_SIZE)
+        return index;
+
+    return permutation->suits[index / RANKS_NUMBER] * RANKS_NUMBER +
+           index % RANKS_NUMBER;
+}
+
+/**
+ * @brief Function determines the permutation which brings some bitboards in
+ *        the canonical form when there are more than ISOMORPHISM_PACKED_SETS
+ *        bitboards. Else it is called by isomorphism_getPermutation().
+ *
+ * @param sets The bitboards.
+ * @param setsNumber The number of the bitboards (1 - ISOMORPHISM_MAX_SETS).
+ * @param trump The suit of the trump or SuitEnd.
+ * @param permutation Pointer to the permutation which is determined.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int isomorphism_getWidePermutation(const uint64_t* sets, int setsNumber,
+                                   enum Suit trump,
+                                   struct SuitPermutation* permutation);
+
+/**
+ * @brief Function puts two values in ascending order.
+ */
+static inline void isomorphism_sortPair(uint64_t* first, uint64_t* second)
+{
+    uint64_t low  = *first < *second ? *first : *second;
+    uint64_t high = *first < *second ? *second : *first;
+    *first  = low;
+    *second = high;
+}
+
+/**
+ * @brief Function determines the permutation which brings some bitboards in
+ *        the canonical form: the trump becomes the last suit and the other
+ *        suits are ordered ascending by the mask of their cards from the
+ *        first bitboard, the ties being broken by the next bitboards. Without
+ *        trump all the suits are ordered. The suits which are equal in all
+ *        the bitboards keep their order.
+ *
+ *        For up to ISOMORPHISM_PACKED_SETS bitboards, every suit gets a
+ *        value with its cards from all the bitboards and with the suit in
+ *        the last two bits (the value of the trump being the biggest) and
+ *        the four values are sorted with a sorting network, without
+ *        branches.
+ *
+ * @param sets The bitboards, for example the hands of the players in the
+ *             order from Round::players.
+ * @param setsNumber The number of the bitboards (1 - ISOMORPHISM_MAX_SETS).
+ * @param trump The suit of the trump or SuitEnd.
+ * @param permutation Pointer to the permutation which is determined.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+static inline int isomorphism_getPermutation(
+    const uint64_t* sets, int setsNumber, enum Suit trump,
+    struct SuitPermutation* permutation)
+{
+    if (setsNumber > ISOMORPHISM_PACKED_SETS || setsNumber < 1 ||
+        sets == NULL || permutation == NULL ||
+        trump < DIAMONDS || trump > SuitEnd)
+        return isomorphism_getWidePermutation(sets, setsNumber, trump,
+                                              permutation);
+
+    uint64_t keys[SuitEnd];
+    for (int suit = DIAMONDS; suit < SuitEnd; suit++) {
+        uint64_t key = 0;
+        for (int i = 0; i < setsNumber; i++)
+            key = (key << RANKS_NUMBER) |
+                  ((sets[i] >> (suit * RANKS_NUMBER)) & BITBOARD_SUIT_MASK);
+        keys[suit] = (key << 2) | suit;
+    }
+    if (trump != SuitEnd)
+        keys[trump] = UINT64_MAX - SuitEnd + 1 + trump;
+
+    isomorphism_sortPair(&keys[0], &keys[1]);
+    isomorphism_sortPair(&keys[2], &keys[3]);
+    isomorphism_sortPair(&keys[0], &keys[2]);
+    isomorphism_sortPair(&keys[1], &keys[3]);
+    isomorphism_sortPair(&keys[1], &keys[2]);
+
+    for (int i = 0; i < SuitEnd; i++)
+        permutation->suits[keys[i] & 3] = i;
+
+    return FUNCTION_NO_ERROR;
+}
+
+/**
+ * @brief Function brings some bitboards in the canonical form (see
+ *        isomorphism_getPermutation()).
+ *
+ * @param sets The bitboards, they are replaced with the canonical ones.
+ * @param setsNumber The number of the bitboards (1 - ISOMORPHISM_MAX_SETS).
+ * @param trump The suit of the trump or SuitEnd.
+ * @param permutation Pointer to the permutation which was applied, it can
+ *                    be NULL.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int isomorphism_canonicalize(uint64_t* sets, int setsNumber, enum Suit trump,
+                             struct SuitPermutation* permutation);
+
+/**
+ * @brief Function determines the inverse of a permutation, which moves the
+ *        canonical cards back in their suits.
+ *
+ * @param permutation Pointer to the permutation.
+ * @param inverse Pointer to the inverse permutation which is determined.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int isomorphism_invertPermutation(const struct SuitPermutation* permutation,
+                                  struct SuitPermutation* inverse);
+
+#endif
@@ -7,6 +7,12 @@
 #include "game.h"
 #include "deck.h"
 #include "player.h"
+#include "bitboard.h"
+#include "isomorphism.h"
+#include "deal.h"
+#include "arena.h"
+#include "random.h"
+#include "zobrist.h"
 
 #endif
 
@@ -13,25 +13,36 @@
 
 struct Player *player_createPlayer(const char* name, int isHuman)
 {
-    if (name == NULL)
+    if (name == NULL || strlen(name) > MAX_NAME_LENGTH)
         return NULL;
 
     struct Player *player = malloc(sizeof(struct Player));
     if (player == NULL)
         return NULL;
 
-    player->name = malloc((strlen(name) + 1) * sizeof(char));
-    if (player->name != NULL)
-        strcpy(player->name, name);
-    else
-        return NULL;
+    player_initializePlayer(player, name, isHuman);
+
+    return player;
+}
+
+int player_initializePlayer(struct Player* player, const char* name,
+                            int isHuman)
+{
+    if (player == NULL)
+        return PLAYER_NULL;
+    if (name == NULL)
+        return POINTER_NULL;
+    if (strlen(name) > MAX_NAME_LENGTH)
+        return INCORRECT_NAME;
 
+    strcpy(player->name, name);
     player->isHuman = isHuman;
+    player->seat    = -1;
 
     for (int i = 0; i < MAX_CARDS; i++)
-        player->hand[i] = NULL;
+        player->hand[i] = EMPTY_CARD;
 
-    return player;
+    return FUNCTION_NO_ERROR;
 }
 
 int player_deletePlayer(struct Player** player)
@@ -41,49 +52,52 @@ int player_deletePlayer(struct Player** player)
     if (*player == NULL)
         return PLAYER_NULL;
 
-    free((*player)->name);
-    (*player)->name = NULL;
-
     free(*player);
     *player = NULL;
 
     return FUNCTION_NO_ERROR;
 }
 
-int player_addCard(struct Player* player, struct Card** card)
+int player_addCard(struct Player* player, struct Card card)
 {
     if (player == NULL)
         return PLAYER_NULL;
-    if (card == NULL)
-        return POINTER_NULL;
-    if (*card == NULL)
+    if (!deck_isCard(card))
         return CARD_NULL;
 
     int position = -1;
     for (int i = 0; i < MAX_CARDS; i++) {
-        if (player->hand[i] == *card)
-            return DUPLICATE_POINTER;
-        if (position == -1 && player->hand[i] == NULL)
+        if (player->hand[i].id == card.id)
+            return DUPLICATE_CARD;
+        if (position == -1 && !deck_isCard(player->hand[i]))
             position = i;
     }
 
     if (position != -1) {
-        player->hand[position] = *card;
-        *card = NULL;
+        player->hand[position] = card;
         return FUNCTION_NO_ERROR;
     }
 
     return FULL;
 }
 
-int player_compareCards(const void* const a, const void* const b)
+int player_removeCard(struct Player* player, int cardId)
 {
-    int suit = (*(struct Card**)a)->suit - (*(struct Card**)b)->suit;
-    int value = (*(struct Card**)a)->value - (*(struct Card**)b)->value;
-    if (suit == 0)
-        return value;
+    if (player == NULL)
+        return PLAYER_NULL;
+    if (cardId < 0 || cardId > MAX_CARDS - 1)
+        return ILLEGAL_VALUE;
+    if (!deck_isCard(player->hand[cardId]))
+        return CARD_NULL;
 
-    return suit;
+    player->hand[cardId] = EMPTY_CARD;
+
+    return FUNCTION_NO_ERROR;
+}
+
+int player_compareCards(const void* const a, const void* const b)
+{
+    return ((const struct Card*)a)->id - ((const struct Card*)b)->id;
 }
 
 int player_checkPlayerName(const char* name)
@@ -92,7 +106,8 @@ int player_checkPlayerName(const char* name)
         return POINTER_NULL;
 
     int firstLetter = (int)tolower(name[0]);
-    if (strlen(name) < 5 || firstLetter < 97 || firstLetter > 122)
+    if (strlen(name) < 5 || strlen(name) > MAX_NAME_LENGTH ||
+        firstLetter < 97 || firstLetter > 122)
         return INCORRECT_NAME;
 
     return FUNCTION_NO_ERROR;
@@ -108,7 +123,7 @@ int player_getIdNumberthCardWhichIsNotNull(const struct Player* player,
 
     int noOfCards = 0;
     for (int i = 0; i < MAX_CARDS; i++)
-        if (player->hand[i] != NULL) {
+        if (deck_isCard(player->hand[i])) {
             noOfCards++;
             if (noOfCards == number)
                 return i;
@@ -124,7 +139,7 @@ int player_getCardsNumber(const struct Player* player)
 
     int cardsNumber = 0;
     for (int i = 0; i < MAX_CARDS; i++)
-        if (player->hand[i] != NULL)
+        if (deck_isCard(player->hand[i]))
             cardsNumber++;
 
     return cardsNumber;
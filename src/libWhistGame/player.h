@@ -18,26 +18,43 @@
  *      Variable used to indicate if the player is human or robot, 0 for AI and
  *      non-zero for human.
  * @var Player::name
- *      Pointer to the name of the player.
+ *      The name of the player.
  * @var Player::hand
- *      Pointer to the cards of the player.
+ *      The cards of the player, EMPTY_CARD for the positions without a card.
+ * @var Player::seat
+ *      The position of the player in Game::players, -1 if the player isn't in
+ *      a game. The ids of the player in rounds and hands are calculated from
+ *      it.
  */
 struct Player {
     int isHuman;
-    char *name;
-    struct Card *hand[MAX_CARDS];
+    int seat;
+    char name[MAX_NAME_LENGTH + 1];
+    struct Card hand[MAX_CARDS];
 };
 
 /**
  * @brief Allocates and initializes a player.
  *
- * @param name The name of the player.
+ * @param name The name of the player, at most MAX_NAME_LENGTH characters.
  * @param isHuman Indicate the player type.
  *
  * @return Pointer to the new player on success or NULL on failure.
  */
 struct Player *player_createPlayer(const char* name, int isHuman);
 
+/**
+ * @brief Function initializes a player whose memory is already allocated.
+ *
+ * @param player Pointer to the player which to be initialized.
+ * @param name The name of the player, at most MAX_NAME_LENGTH characters.
+ * @param isHuman Indicate the player type.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int player_initializePlayer(struct Player* player, const char* name,
+                            int isHuman);
+
 /**
  * @brief Function releases the memory of a player and makes pointer NULL.
  *
@@ -51,19 +68,29 @@ int player_deletePlayer(struct Player** player);
  * @brief Function add the card of the player.
  *
  * @param player Pointer to the player which receives the card.
- * @param card Pointer to pointer to the card which is added.
+ * @param card The card which is added.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int player_addCard(struct Player* player, struct Card card);
+
+/**
+ * @brief Function removes a card from the hand of the player.
+ *
+ * @param player Pointer to the player which gives the card.
+ * @param cardId The id of the card from player's hand.
  *
  * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
  */
-int player_addCard(struct Player* player, struct Card** card);
+int player_removeCard(struct Player* player, int cardId);
 
 /**
  * @brief Function compare two cards. This function will be used of qsort().
  *
- * @param a Pointer to void. This pointer will be convert to struct Card and
- *          will be compared with the second card.
- * @param b Pointer to void. This pointer will be convert to struct Card and
- *          will be compared with the first card.
+ * @param a Pointer to void. This pointer will be convert to pointer to
+ *          struct Card and will be compared with the second card.
+ * @param b Pointer to void. This pointer will be convert to pointer to
+ *          struct Card and will be compared with the first card.
  *
  * @return A positive value if the first card is greater, otherwise a negative
  *         value.
@@ -80,13 +107,13 @@ int player_compareCards(const void* const a, const void* const b);
 int player_checkPlayerName(const char* name);
 
 /**
- * @brief Function get the position of the number-th card which is not null
+ * @brief Function get the position of the number-th card which is not empty
  *        from cards a player.
  *
  * @param player Pointer to the player for which is obtained the position of
  *               the number-th card.
- * @param number Indicates the number of NULL cards on which the function not
- *               consider.
+ * @param number Indicates the number of not empty cards on which the
+ *               function not consider.
  *
  * @return A value between 0 and MAX_CARDS - 1 on success, a negative value on
  *         failure.
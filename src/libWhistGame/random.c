@@ -0,0 +1,90 @@
+/**
+ * @file random.c
+ * @brief In this file are defined functions used for Random-related
+ *        operations, these functions are declared in the header file random.h.
+ */
+
+#include "random.h"
+#include "errors.h"
+
+#include <stdlib.h>
+#include <time.h>
+
+/**
+ * @brief Function mixes a number with the splitmix64 algorithm and advances
+ *        it, it is used to spread a seed over the state of a generator.
+ */
+static uint64_t random_splitMix(uint64_t* x)
+{
+    uint64_t z = (*x += UINT64_C(0x9E3779B97F4A7C15));
+    z = (z ^ (z >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+    z = (z ^ (z >> 27)) * UINT64_C(0x94D049BB133111EB);
+    return z ^ (z >> 31);
+}
+
+static inline uint64_t random_rotateLeft(uint64_t x, int k)
+{
+    return (x << k) | (x >> (64 - k));
+}
+
+uint64_t random_createSeed()
+{
+    static uint64_t counter = 0;
+
+    uint64_t seed = (uint64_t)time(NULL);
+    seed ^= (uint64_t)clock() << 32;
+    seed ^= (uint64_t)(uintptr_t)&seed;
+    seed ^= __atomic_add_fetch(&counter, 1, __ATOMIC_RELAXED) *
+            UINT64_C(0x9E3779B97F4A7C15);
+
+    return random_splitMix(&seed);
+}
+
+int random_setSeed(struct Random* random, uint64_t seed)
+{
+    if (random == NULL)
+        return POINTER_NULL;
+
+    for (int i = 0; i < 4; i++)
+        random->state[i] = random_splitMix(&seed);
+
+    return FUNCTION_NO_ERROR;
+}
+
+uint64_t random_getNumber(struct Random* random)
+{
+    if (random == NULL)
+        return 0;
+
+    uint64_t *s = random->state;
+    uint64_t result = random_rotateLeft(s[1] * 5, 7) * 9;
+    uint64_t t = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = random_rotateLeft(s[3], 45);
+
+    return result;
+}
+
+int random_getBoundedNumber(struct Random* random, int bound)
+{
+    if (random == NULL)
+        return POINTER_NULL;
+    if (bound <= 0)
+        return ILLEGAL_VALUE;
+
+    /* The high 32 bits are scaled to [0, bound) and the few values which
+     * would make the result biased are rejected. */
+    uint32_t range     = (uint32_t)bound;
+    uint32_t threshold = -range % range;
+    uint64_t product;
+    do {
+        product = (random_getNumber(random) >> 32) * range;
+    } while ((uint32_t)product < threshold);
+
+    return (int)(product >> 32);
+}
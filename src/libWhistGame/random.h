@@ -0,0 +1,66 @@
+/**
+ * @file random.h
+ * @brief Random structure, as well as helper functions. The numbers are
+ *        generated with the xoshiro256** algorithm, every Random having its
+ *        own state, so different games can be played in different threads.
+ */
+
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <stdint.h>
+
+/**
+ * @struct Random
+ *
+ * @brief Random structure. Structure used to keep the state of a generator of
+ *        random numbers.
+ *
+ * @var Random::state
+ *      The state of the generator, it is never all zero.
+ */
+struct Random {
+    uint64_t state[4];
+};
+
+/**
+ * @brief Function gets a seed which differs at every call, even if the calls
+ *        are made in the same second.
+ *
+ * @return The seed.
+ */
+uint64_t random_createSeed();
+
+/**
+ * @brief Function initializes the state of a generator from a seed. Two
+ *        generators initialized with the same seed generate the same numbers.
+ *
+ * @param random Pointer to the generator which is initialized.
+ * @param seed The seed of the generator.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int random_setSeed(struct Random* random, uint64_t seed);
+
+/**
+ * @brief Function generates a random number.
+ *
+ * @param random Pointer to the generator which generates the number.
+ *
+ * @return A random number, 0 if random is NULL.
+ */
+uint64_t random_getNumber(struct Random* random);
+
+/**
+ * @brief Function generates a random number smaller than a bound. All the
+ *        numbers smaller than the bound have the same probability.
+ *
+ * @param random Pointer to the generator which generates the number.
+ * @param bound The bound of the number, it must be positive.
+ *
+ * @return A number between 0 and bound - 1 on success, a negative value on
+ *         failure.
+ */
+int random_getBoundedNumber(struct Random* random, int bound);
+
+#endif
@@ -9,6 +9,40 @@
 
 #include <stdlib.h>
 
+/**
+ * @brief Function adds difference to the number of the hands which a player
+ *        still needs and updates the key of the round. Only the key is
+ *        modified, the caller modifies the bid or the won hands.
+ */
+static void round_changeNeed(struct Round* round, int playerId,
+                             int difference)
+{
+    int need = round->bids[playerId] - round->handsNumber[playerId];
+    round->key ^= zobrist_getNeedKey(playerId, need) ^
+                  zobrist_getNeedKey(playerId, need + difference);
+}
+
+/**
+ * @brief Function removes the current hand of a round, together with its keys.
+ */
+static void round_clearHand(struct Round* round)
+{
+    const struct Hand *hand = round->hand;
+    if (hand == NULL)
+        return;
+
+    for (int i = 0; i < hand->playersNumber; i++)
+        if (deck_isCard(hand->cards[i]))
+            round->key ^= zobrist_getTableKey(
+                              round_getPlayerId(round, hand->players[i]),
+                              hand->cards[i].id);
+    if (hand->playersNumber > 0)
+        round->key ^= zobrist_getLeaderKey(
+                          round_getPlayerId(round, hand->players[0]));
+
+    round->hand = NULL;
+}
+
 struct Round *round_createRound(int roundType)
 {
     if (roundType < MIN_CARDS || roundType > MAX_CARDS)
@@ -18,6 +52,18 @@ struct Round *round_createRound(int roundType)
     if (round == NULL)
         return NULL;
 
+    round_initializeRound(round, roundType);
+
+    return round;
+}
+
+int round_initializeRound(struct Round* round, int roundType)
+{
+    if (round == NULL)
+        return ROUND_NULL;
+    if (roundType < MIN_CARDS || roundType > MAX_CARDS)
+        return ILLEGAL_VALUE;
+
     for (int i = 0; i < MAX_GAME_PLAYERS; i++) {
         round->bids[i]         = 0;
         round->pointsNumber[i] = 0;
@@ -27,10 +73,16 @@ struct Round *round_createRound(int roundType)
     }
 
     round->hand      = NULL;
-    round->trump     = NULL;
-    round->roundType = roundType;
+    round->trump     = EMPTY_CARD;
+    round->roundType     = roundType;
+    round->playersNumber = 0;
+    round->firstSeat     = 0;
+    round->bidsNumber    = 0;
+    round->movesNumber   = 0;
+    round->key           = 0;
+    hand_initializeHand(&round->currentHand);
 
-    return round;
+    return FUNCTION_NO_ERROR;
 }
 
 int round_deleteRound(struct Round** round)
@@ -40,14 +92,6 @@ int round_deleteRound(struct Round** round)
     if (*round == NULL)
         return ROUND_NULL;
 
-    if ((*round)->hand != NULL)
-        hand_deleteHand(&((*round)->hand));
-    if ((*round)->trump != NULL)
-        deck_deleteCard(&((*round)->trump));
-
-    for (int i = 0; i < MAX_GAME_PLAYERS; i++)
-        (*round)->players[i] = NULL;
-    
     free(*round);
     *round = NULL;
 
@@ -71,6 +115,11 @@ int round_addPlayer(struct Round* round, struct Player* player)
 
     if (position != -1) {
         round->players[position] = player;
+        round->playersNumber++;
+        round->key ^= zobrist_getNeedKey(position, round->bids[position] -
+                                         round->handsNumber[position]);
+        if (position == 0)
+            round->firstSeat = player->seat;
         return FUNCTION_NO_ERROR;
     }
 
@@ -86,32 +135,41 @@ int round_addHand(struct Round* round, struct Hand** hand)
     if (*hand == NULL)
         return HAND_NULL;
 
-    if (round->hand != NULL)
-        hand_deleteHand(&(round->hand));
-
-    round->hand = *hand;
-    *hand = NULL;    
+    round->currentHand = **hand;
+    hand_setTrump(&round->currentHand, round->trump);
+    round->hand = &round->currentHand;
+    round->key  = round_computeKey(round);
+    hand_deleteHand(hand);
 
     return FUNCTION_NO_ERROR;
 }
 
-int round_addTrump(struct Round* round, struct Card** trump)
+int round_initializeHand(struct Round* round)
 {
     if (round == NULL)
         return ROUND_NULL;
-    if (trump == NULL)
-        return POINTER_NULL;
 
-    if (round->trump != NULL)
-        deck_deleteCard(&(round->trump));
+    round_clearHand(round);
+    hand_initializeHand(&round->currentHand);
+    hand_setTrump(&round->currentHand, round->trump);
+    round->hand = &round->currentHand;
 
-    round->trump = *trump;
-    *trump = NULL;
+    return FUNCTION_NO_ERROR;
+}
+
+int round_addTrump(struct Round* round, struct Card trump)
+{
+    if (round == NULL)
+        return ROUND_NULL;
+
+    round->trump = trump;
+    if (round->hand != NULL)
+        hand_setTrump(round->hand, trump);
 
     return FUNCTION_NO_ERROR;
 }
 
-int round_addPlayersInHand(const struct Round* round, int firstPlayer)
+int round_addPlayersInHand(struct Round* round, int firstPlayer)
 {
     if (round == NULL)
         return ROUND_NULL;
@@ -120,12 +178,7 @@ int round_addPlayersInHand(const struct Round* round, int firstPlayer)
     if (round->hand == NULL)
         return HAND_NULL;
 
-    int playersNumber = 0;
-    for (int i = 0; i < MAX_GAME_PLAYERS; i++)
-        if (round->players[i] != NULL)
-            playersNumber++;
-
-    if (playersNumber < MIN_GAME_PLAYERS)
+    if (round->playersNumber < MIN_GAME_PLAYERS)
         return INSUFFICIENT_PLAYERS;
 
     for (int i = firstPlayer; i < MAX_GAME_PLAYERS; i++)
@@ -133,10 +186,12 @@ int round_addPlayersInHand(const struct Round* round, int firstPlayer)
     for (int i = 0; i < firstPlayer; i++)
         hand_addPlayer(round->hand, round->players[i]);
 
+    round->key ^= zobrist_getLeaderKey(firstPlayer);
+
     return FUNCTION_NO_ERROR;
 }
 
-int round_distributeCard(const struct Round* round, struct Deck* deck)
+int round_distributeCard(struct Round* round, struct Deck* deck)
 {
     if (round == NULL)
         return ROUND_NULL;
@@ -158,14 +213,16 @@ int round_distributeCard(const struct Round* round, struct Deck* deck)
 
     int i,j;
     for (i = 0, j = 0; i < MAX_GAME_PLAYERS && j < DECK_SIZE; i++, j++) {
-        while (deck->cards[j] == NULL && j < DECK_SIZE)
+        while (j < DECK_SIZE && !deck_isCard(deck->cards[j]))
             j++;
-        while (round->players[i] == NULL && i < MAX_GAME_PLAYERS)
+        while (i < MAX_GAME_PLAYERS && round->players[i] == NULL)
             i++;
         if (i < MAX_GAME_PLAYERS && j < DECK_SIZE) {
-            int check = player_addCard(round->players[i], &deck->cards[j]);
+            int check = player_addCard(round->players[i], deck->cards[j]);
             if (check != FUNCTION_NO_ERROR)
                 return check;
+            round->key ^= zobrist_getHandKey(i, deck->cards[j].id);
+            deck->cards[j] = EMPTY_CARD;
         }
     }
 
@@ -186,11 +243,13 @@ int round_distributeDeck(struct Round* round, struct Deck* deck)
     }
 
     int i = 0;
-    while (deck->cards[i] == NULL && i < DECK_SIZE)
+    while (i < DECK_SIZE && !deck_isCard(deck->cards[i]))
         i++;
 
-    if (i < DECK_SIZE)
-        round_addTrump(round, &deck->cards[i]);
+    if (i < DECK_SIZE) {
+        round_addTrump(round, deck->cards[i]);
+        deck->cards[i] = EMPTY_CARD;
+    }
 
     return FUNCTION_NO_ERROR;
 }
@@ -203,6 +262,14 @@ int round_getPlayerId(const struct Round* round,
     if (player == NULL)
         return PLAYER_NULL;
 
+    if (player->seat >= 0 && round->playersNumber > 0) {
+        int position = player->seat - round->firstSeat;
+        if (position < 0)
+            position += round->playersNumber;
+        if (position < MAX_GAME_PLAYERS && round->players[position] == player)
+            return position;
+    }
+
     for (int i = 0; i < MAX_GAME_PLAYERS; i++)
         if (round->players[i] == player)
             return i;
@@ -237,9 +304,8 @@ int round_checkBid(const struct Round* round,
     if (position < 0)
         return position;
 
-    for (int i = position + 1; i < MAX_GAME_PLAYERS; i++)
-        if (round->players[i] != NULL)
-            return FUNCTION_NO_ERROR;
+    if (position != round->playersNumber - 1)
+        return FUNCTION_NO_ERROR;
 
     if (round_getBidsSum(round) + bid == round->roundType)
         return ILLEGAL_BID;
@@ -254,7 +320,189 @@ int round_placeBid(struct Round* round, const struct Player* player, int bid)
         return check;
 
     int position = round_getPlayerId(round, player);
+    if (position != round->bidsNumber)
+        return ILLEGAL_BID;
+
+    round_changeNeed(round, position, bid - round->bids[position]);
     round->bids[position] = bid;
+    round->bidsNumber++;
+
+    return FUNCTION_NO_ERROR;
+}
+
+int round_playCard(struct Round* round, struct Player* player, int cardId)
+{
+    if (round == NULL)
+        return ROUND_NULL;
+    if (player == NULL)
+        return PLAYER_NULL;
+    if (cardId < 0 || cardId > MAX_CARDS - 1)
+        return ILLEGAL_VALUE;
+
+    struct Card card = player->hand[cardId];
+    int check = hand_addCard(round->hand, player, card);
+    if (check != FUNCTION_NO_ERROR)
+        return check;
+
+    int position = round_getPlayerId(round, player);
+    round->key ^= zobrist_getHandKey(position, card.id) ^
+                  zobrist_getTableKey(position, card.id);
+
+    return player_removeCard(player, cardId);
+}
+
+/**
+ * @brief Function checks if a player can put down a card for
+ *        round_applyMove().
+ */
+static int round_checkCardMove(const struct Round* round,
+                               const struct Player* player, int cardId)
+{
+    if (cardId < 0 || cardId > MAX_CARDS - 1)
+        return ILLEGAL_VALUE;
+    if (!deck_isCard(player->hand[cardId]))
+        return CARD_NULL;
+    if (round->bidsNumber < round->playersNumber)
+        return ILLEGAL_MOVE;
+
+    const struct Hand *hand = round->hand;
+    if (hand == NULL)
+        return player == round->players[0] ? FUNCTION_NO_ERROR : ILLEGAL_MOVE;
+
+    if (hand->cardsNumber >= hand->playersNumber ||
+        hand->players[hand->cardsNumber] != player)
+        return ILLEGAL_MOVE;
+    if (deck_isCard(hand->cards[hand->cardsNumber]))
+        return DUPLICATE_CARD;
+    if (hand_checkCard(hand, player, cardId, round->trump) != 1)
+        return ILLEGAL_VALUE;
+
+    return FUNCTION_NO_ERROR;
+}
+
+/**
+ * @brief Function puts down a card for round_applyMove(), the move is checked
+ *        and it is pushed on the stack only if the card was put down.
+ */
+static int round_applyCardMove(struct Round* round, struct Player* player,
+                               struct RoundMove* move)
+{
+    if (round->hand == NULL) {
+        round_initializeHand(round);
+        round_addPlayersInHand(round, 0);
+        move->startedHand = 1;
+    }
+
+    int check = round_playCard(round, player, move->value);
+    if (check != FUNCTION_NO_ERROR) {
+        if (move->startedHand)
+            round_clearHand(round);
+        return check;
+    }
+
+    struct Hand *hand = round->hand;
+    if (hand->cardsNumber < hand->playersNumber)
+        return FUNCTION_NO_ERROR;
+
+    int winnerId = round_getPlayerId(round, hand->players[hand->winnerId]);
+    round_addWonHand(round, winnerId);
+
+    move->winnerId = winnerId;
+    move->leaderId = round_getPlayerId(round, hand->players[0]);
+    for (int i = 0; i < MAX_GAME_PLAYERS; i++)
+        move->trick[i] = hand->cards[i];
+
+    round_initializeHand(round);
+    round_addPlayersInHand(round, winnerId);
+
+    return FUNCTION_NO_ERROR;
+}
+
+int round_applyMove(struct Round* round, struct Player* player,
+                    enum MoveType type, int value)
+{
+    if (round == NULL)
+        return ROUND_NULL;
+    if (player == NULL)
+        return PLAYER_NULL;
+    if (round->movesNumber >= ROUND_MOVES_NUMBER)
+        return FULL;
+
+    int playerId = round_getPlayerId(round, player);
+    if (playerId < 0)
+        return playerId;
+
+    struct RoundMove *move = &(round->moves[round->movesNumber]);
+    move->type        = type;
+    move->playerId    = playerId;
+    move->startedHand = 0;
+    move->winnerId    = -1;
+    move->leaderId    = -1;
+
+    if (type == BID_MOVE) {
+        move->value = round->bids[playerId];
+        int check = round_placeBid(round, player, value);
+        if (check != FUNCTION_NO_ERROR)
+            return check;
+    } else if (type == CARD_MOVE) {
+        int check = round_checkCardMove(round, player, value);
+        if (check != FUNCTION_NO_ERROR)
+            return check;
+
+        move->value = value;
+        move->card  = player->hand[value];
+        check = round_applyCardMove(round, player, move);
+        if (check != FUNCTION_NO_ERROR)
+            return check;
+    } else {
+        return ILLEGAL_VALUE;
+    }
+
+    round->movesNumber++;
+
+    return FUNCTION_NO_ERROR;
+}
+
+int round_undoMove(struct Round* round)
+{
+    if (round == NULL)
+        return ROUND_NULL;
+    if (round->movesNumber == 0)
+        return NOT_FOUND;
+
+    const struct RoundMove *move = &(round->moves[--(round->movesNumber)]);
+    struct Player *player = round->players[move->playerId];
+
+    if (move->type == BID_MOVE) {
+        round_changeNeed(round, move->playerId,
+                         move->value - round->bids[move->playerId]);
+        round->bids[move->playerId] = move->value;
+        round->bidsNumber--;
+        return FUNCTION_NO_ERROR;
+    }
+
+    if (move->winnerId >= 0) {
+        round_changeNeed(round, move->winnerId, 1);
+        round->handsNumber[move->winnerId]--;
+        round_initializeHand(round);
+        round_addPlayersInHand(round, move->leaderId);
+        for (int i = 0; i < MAX_GAME_PLAYERS; i++)
+            if (deck_isCard(move->trick[i])) {
+                struct Player *trickPlayer = round->hand->players[i];
+                hand_addCard(round->hand, trickPlayer, move->trick[i]);
+                round->key ^= zobrist_getTableKey(
+                                  round_getPlayerId(round, trickPlayer),
+                                  move->trick[i].id);
+            }
+    }
+
+    hand_removeCard(round->hand, player);
+    player->hand[move->value] = move->card;
+    round->key ^= zobrist_getHandKey(move->playerId, move->card.id) ^
+                  zobrist_getTableKey(move->playerId, move->card.id);
+
+    if (move->startedHand)
+        round_clearHand(round);
 
     return FUNCTION_NO_ERROR;
 }
@@ -264,33 +512,16 @@ struct Player *round_getPlayerWhichWonHand(const struct Round* round)
     if (round == NULL || round->hand == NULL)
         return NULL;
 
-    int playersNumber = 0;
-    int cardsNumber = 0;
-    for (int i = 0; i < MAX_GAME_PLAYERS; i++) {
-        if (round->hand->players[i] != NULL)
-            playersNumber++;
-        if (round->hand->cards[i] != NULL)
-            cardsNumber++;
-    }
-
-    if (playersNumber < MIN_GAME_PLAYERS || playersNumber != cardsNumber)
+    const struct Hand *hand = round->hand;
+    if (hand->playersNumber < MIN_GAME_PLAYERS ||
+        hand->playersNumber != hand->cardsNumber)
         return NULL;
 
-    struct Player *winningPlayer = round->hand->players[0];
-    struct Card   *winningCard   = round->hand->cards[0];
-    enum Suit trump;
-    if (round->trump == NULL)
-        trump = SuitEnd;
-    else
-        trump = round->trump->suit;
-
-    for (int i = 1; i < MAX_GAME_PLAYERS; i++)
-        if (deck_compareCards(winningCard, round->hand->cards[i], trump) == 2) {
-            winningPlayer = round->hand->players[i];
-            winningCard   = round->hand->cards[i];
-        }
+    int winnerId = hand_getWinnerId(hand);
+    if (winnerId < 0)
+        return NULL;
 
-    return winningPlayer;
+    return hand->players[winnerId];
 }
 
 int round_determinesScore(struct Round* round)
@@ -353,9 +584,56 @@ int round_reinitializeRound(struct Round* round)
         round->handsNumber[i] = 0;
     }
 
-    deck_deleteCard(&(round->trump));
-    hand_deleteHand(&(round->hand));
+    round->bidsNumber  = 0;
+    round->trump       = EMPTY_CARD;
+    round->hand        = NULL;
+    round->movesNumber = 0;
+    round->key         = round_computeKey(round);
+
+    return FUNCTION_NO_ERROR;
+}
+
+int round_addWonHand(struct Round* round, int playerId)
+{
+    if (round == NULL)
+        return ROUND_NULL;
+    if (playerId < 0 || playerId >= round->playersNumber)
+        return ILLEGAL_VALUE;
+
+    round_changeNeed(round, playerId, -1);
+    round->handsNumber[playerId]++;
 
     return FUNCTION_NO_ERROR;
 }
 
+uint64_t round_computeKey(const struct Round* round)
+{
+    if (round == NULL)
+        return 0;
+
+    uint64_t key = 0;
+    for (int i = 0; i < MAX_GAME_PLAYERS; i++) {
+        const struct Player *player = round->players[i];
+        if (player == NULL)
+            continue;
+
+        key ^= zobrist_getNeedKey(i, round->bids[i] - round->handsNumber[i]);
+        for (int j = 0; j < MAX_CARDS; j++)
+            if (deck_isCard(player->hand[j]))
+                key ^= zobrist_getHandKey(i, player->hand[j].id);
+    }
+
+    const struct Hand *hand = round->hand;
+    if (hand != NULL) {
+        for (int i = 0; i < hand->playersNumber; i++)
+            if (deck_isCard(hand->cards[i]))
+                key ^= zobrist_getTableKey(
+                           round_getPlayerId(round, hand->players[i]),
+                           hand->cards[i].id);
+        if (hand->playersNumber > 0)
+            key ^= zobrist_getLeaderKey(
+                       round_getPlayerId(round, hand->players[0]));
+    }
+
+    return key;
+}
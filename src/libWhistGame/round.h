@@ -8,8 +8,60 @@
 
 #include "player.h"
 #include "hand.h"
+#include "zobrist.h"
 #include "constants.h"
 
+#include <stdint.h>
+
+/**
+ * @brief The maximum number of moves made in a round: a bid and MAX_CARDS
+ *        cards for every player.
+ */
+#define ROUND_MOVES_NUMBER (MAX_GAME_PLAYERS * (MAX_CARDS + 1))
+
+/**
+ * @enum MoveType
+ *
+ * @brief The types of the moves which can be made in a round.
+ */
+enum MoveType {BID_MOVE = 0, CARD_MOVE};
+
+/**
+ * @struct RoundMove
+ *
+ * @brief RoundMove structure. Structure used to keep what is needed to undo a
+ *        move made with round_applyMove().
+ *
+ * @var RoundMove::type
+ *      The type of the move (one of MoveType).
+ * @var RoundMove::playerId
+ *      The id in round of the player which made the move.
+ * @var RoundMove::value
+ *      For BID_MOVE, the previous bid of the player. For CARD_MOVE, the id
+ *      of the card from player's hand.
+ * @var RoundMove::startedHand
+ *      1 if the round didn't have a hand before the move, 0 otherwise.
+ * @var RoundMove::winnerId
+ *      The id in round of the player which won the hand ended by the move, -1
+ *      if the move didn't end a hand.
+ * @var RoundMove::leaderId
+ *      The id in round of the first player of the hand ended by the move.
+ * @var RoundMove::card
+ *      The card put down.
+ * @var RoundMove::trick
+ *      The cards of the hand ended by the move.
+ */
+struct RoundMove {
+    signed char type;
+    signed char playerId;
+    signed char value;
+    signed char startedHand;
+    signed char winnerId;
+    signed char leaderId;
+    struct Card card;
+    struct Card trick[MAX_GAME_PLAYERS];
+};
+
 /**
  * @struct Round
  *
@@ -18,7 +70,8 @@
  * @var Round::roundType
  *      Variable used to indicate the round type (1, 2, 3, 4, 5, 6, 7, 8).
  * @var Round::trump
- *      Pointer to the card which is the trump of the round, if this exists.
+ *      The card which is the trump of the round or EMPTY_CARD if the round
+ *      doesn't have a trump.
  * @var Round::bids
  *      The bids of the players.
  * @var Round::handsNumber
@@ -32,18 +85,44 @@
  *      The score of the players.
  * @var Round::players
  *      Pointer to the players of the round.
- * @var Round::hands
- *      Pointer to the hand of the round.
+ * @var Round::hand
+ *      Pointer to the current hand of the round, NULL while the players bid.
+ *      When it isn't NULL it points to Round::currentHand.
+ * @var Round::currentHand
+ *      The memory of the current hand, reused by every hand of the round.
+ * @var Round::playersNumber
+ *      The number of the players from Round::players.
+ * @var Round::firstSeat
+ *      The seat of the first player of the round, the player with the seat s
+ *      has the id s - firstSeat modulo playersNumber.
+ * @var Round::bidsNumber
+ *      The number of the players which placed their bids, the players bid in
+ *      the order from Round::players.
+ * @var Round::key
+ *      The Zobrist key of the state of the round (see zobrist.h), it is
+ *      updated by all the functions which modify the round.
+ * @var Round::movesNumber
+ *      The number of the moves from Round::moves.
+ * @var Round::moves
+ *      The stack of the moves made with round_applyMove(), which can be
+ *      undone with round_undoMove().
  */
 struct Round {
     int roundType;
-    struct Card *trump;
+    struct Card trump;
     int bids[MAX_GAME_PLAYERS];
     int handsNumber[MAX_GAME_PLAYERS];
     int bonus[MAX_GAME_PLAYERS];
     int pointsNumber[MAX_GAME_PLAYERS];
     struct Player *players[MAX_GAME_PLAYERS];
     struct Hand *hand;
+    struct Hand currentHand;
+    int playersNumber;
+    int firstSeat;
+    int bidsNumber;
+    uint64_t key;
+    int movesNumber;
+    struct RoundMove moves[ROUND_MOVES_NUMBER];
 };
 
 /**
@@ -55,6 +134,16 @@ struct Round {
  */
 struct Round *round_createRound(int roundType);
 
+/**
+ * @brief Function initializes a round whose memory is already allocated.
+ *
+ * @param round Pointer to the round which to be initialized.
+ * @param roundType The round type (1, 2, 3, 4, 5, 6, 7, 8).
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int round_initializeRound(struct Round* round, int roundType);
+
 /**
  * @brief Function releases the memory of the round.
  *
@@ -75,7 +164,8 @@ int round_deleteRound(struct Round** round);
 int round_addPlayer(struct Round* round, struct Player* player);
 
 /**
- * @brief Function adds a hand in a round.
+ * @brief Function adds a hand in a round. The hand is copied in the memory of
+ *        the round and then it is released.
  *
  * @param round Pointer to the round in which is added the hand.
  * @param hand Pointer to pointer to the hand which to be added.
@@ -85,14 +175,25 @@ int round_addPlayer(struct Round* round, struct Player* player);
 int round_addHand(struct Round* round, struct Hand** hand);
 
 /**
- * @brief Function adds the trump in a round.
+ * @brief Function begins a new hand in a round, without allocating memory.
+ *        The players are added after with round_addPlayersInHand().
+ *
+ * @param round Pointer to the round in which begins the hand.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int round_initializeHand(struct Round* round);
+
+/**
+ * @brief Function adds the trump in a round. The current hand, if the round
+ *        has one, compares its cards with the new trump.
  *
  * @param round Pointer to the round in which is added the trump.
- * @param trump Pointer to pointer to the card which to be added as trump.
+ * @param trump The card which to be added as trump.
  *
  * @return FUNCTION_NO_ERROR or 0 on succes, other value on failure.
  */
-int round_addTrump(struct Round* round, struct Card** trump);
+int round_addTrump(struct Round* round, struct Card trump);
 
 /**
  * @brief Function adds players in hand in a certain order.
@@ -102,7 +203,7 @@ int round_addTrump(struct Round* round, struct Card** trump);
  *
  * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
  */
-int round_addPlayersInHand(const struct Round* round, int firstPlayer);
+int round_addPlayersInHand(struct Round* round, int firstPlayer);
 
 /**
  * @brief Function distributes one card each player from round.
@@ -112,7 +213,7 @@ int round_addPlayersInHand(const struct Round* round, int firstPlayer);
  *
  * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
  */
-int round_distributeCard(const struct Round* round, struct Deck* deck);
+int round_distributeCard(struct Round* round, struct Deck* deck);
 
 /**
  * @brief Function distributes the cards of the players.
@@ -125,7 +226,9 @@ int round_distributeCard(const struct Round* round, struct Deck* deck);
 int round_distributeDeck(struct Round* round, struct Deck* deck);
 
 /**
- * @brief Function get the id of the player.
+ * @brief Function get the id of the player. The id is calculated from the
+ *        seat of the player, the players are searched only if they don't
+ *        have seats.
  *
  * @param round Pointer to the round in which is the player.
  * @param player Pointer to the player for which it get the id.
@@ -159,7 +262,9 @@ int round_checkBid(const struct Round* round,
                    const struct Player* player, int bid);
 
 /**
- * @brief Function places a bid of a player.
+ * @brief Function places a bid of a player. The players bid in the order from
+ *        Round::players, so the bid is placed only if the player is the next
+ *        one which has to bid.
  *
  * @param round Pointer to the round in which is found the player.
  * @param player Pointer to the player who places the bid.
@@ -169,6 +274,69 @@ int round_checkBid(const struct Round* round,
  */
 int round_placeBid(struct Round* round, const struct Player* player, int bid);
 
+/**
+ * @brief Function moves a card from the hand of a player in the hand of the
+ *        round.
+ *
+ * @param round Pointer to the round in which is put down the card.
+ * @param player Pointer to the player who puts down the card.
+ * @param cardId The id of the card from player's hand.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int round_playCard(struct Round* round, struct Player* player, int cardId);
+
+/**
+ * @brief Function makes a move and keeps it on the stack of the round so it
+ *        can be undone. A bid is placed like round_placeBid() does. A card is
+ *        accepted only after all the players bid, from the player whose turn
+ *        is in the current hand and only if it can be put down. It is put
+ *        down like round_playCard() does, after what the first hand is
+ *        started if the round didn't have one, and if the card ends the hand,
+ *        handsNumber of the winner is incremented and the next hand is
+ *        started by the winner.
+ *
+ * @param round Pointer to the round in which is made the move.
+ * @param player Pointer to the player which makes the move.
+ * @param type The type of the move.
+ * @param value The bid for BID_MOVE, the id of the card from player's hand for
+ *              CARD_MOVE.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure (the
+ *         round isn't modified).
+ */
+int round_applyMove(struct Round* round, struct Player* player,
+                    enum MoveType type, int value);
+
+/**
+ * @brief Function undoes the last move made with round_applyMove().
+ *
+ * @param round Pointer to the round in which is undone the move.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int round_undoMove(struct Round* round);
+
+/**
+ * @brief Function increments the number of the hands won by a player.
+ *
+ * @param round Pointer to the round in which the player won the hand.
+ * @param playerId The id of the player in round.
+ *
+ * @return FUNCTION_NO_ERROR or 0 on success, other value on failure.
+ */
+int round_addWonHand(struct Round* round, int playerId);
+
+/**
+ * @brief Function calculates the Zobrist key of a round from scratch. It is
+ *        equal with Round::key.
+ *
+ * @param round Pointer to the round.
+ *
+ * @return The key of the round, 0 if round is NULL.
+ */
+uint64_t round_computeKey(const struct Round* round);
+
 /**
  * @brief Function determines who won the hand and incremets handsNumber for
  *        the winning player.
@@ -0,0 +1,97 @@
+/**
+ * @file zobrist.h
+ * @brief Helper functions for the Zobrist keys of the rounds. The key of a
+ *        round is the xor of the keys of: the cards from the hands of the
+ *        players, the cards put down in the current hand, the first player of
+ *        the current hand and the number of hands which each player still
+ *        needs. The keys are calculated from their indices with a mixing
+ *        function, so they don't need tables or initialization.
+ */
+
+#ifndef ZOBRIST_H
+#define ZOBRIST_H
+
+#include "constants.h"
+
+#include <stdint.h>
+
+/**
+ * @brief The first index of each kind of key.
+ */
+#define ZOBRIST_HAND_KEYS   0
+#define ZOBRIST_TABLE_KEYS  (ZOBRIST_HAND_KEYS + MAX_GAME_PLAYERS * DECK_SIZE)
+#define ZOBRIST_LEADER_KEYS (ZOBRIST_TABLE_KEYS + MAX_GAME_PLAYERS * DECK_SIZE)
+#define ZOBRIST_NEED_KEYS   (ZOBRIST_LEADER_KEYS + MAX_GAME_PLAYERS)
+
+/**
+ * @brief Function gets the key with an index, the keys are the values of the
+ *        splitmix64 mixing function.
+ *
+ * @param index The index of the key.
+ *
+ * @return The key.
+ */
+static inline uint64_t zobrist_getKey(int index)
+{
+    uint64_t z = (uint64_t)(index + 1) * UINT64_C(0x9E3779B97F4A7C15);
+    z = (z ^ (z >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+    z = (z ^ (z >> 27)) * UINT64_C(0x94D049BB133111EB);
+    return z ^ (z >> 31);
+}
+
+/**
+ * @brief Function gets the key of a card from the hand of a player.
+ *
+ * @param playerId The id of the player in round.
+ * @param cardId The id of the card (struct Card::id).
+ *
+ * @return The key.
+ */
+static inline uint64_t zobrist_getHandKey(int playerId, int cardId)
+{
+    return zobrist_getKey(ZOBRIST_HAND_KEYS + playerId * DECK_SIZE + cardId);
+}
+
+/**
+ * @brief Function gets the key of a card put down by a player in the current
+ *        hand.
+ *
+ * @param playerId The id of the player in round.
+ * @param cardId The id of the card (struct Card::id).
+ *
+ * @return The key.
+ */
+static inline uint64_t zobrist_getTableKey(int playerId, int cardId)
+{
+    return zobrist_getKey(ZOBRIST_TABLE_KEYS + playerId * DECK_SIZE + cardId);
+}
+
+/**
+ * @brief Function gets the key of the first player of the current hand.
+ *
+ * @param playerId The id of the player in round.
+ *
+ * @return The key.
+ */
+static inline uint64_t zobrist_getLeaderKey(int playerId)
+{
+    return zobrist_getKey(ZOBRIST_LEADER_KEYS + playerId);
+}
+
+/**
+ * @brief Function gets the key of the number of hands which a player still
+ *        needs to win.
+ *
+ * @param playerId The id of the player in round.
+ * @param need The bid of the player minus his won hands (between -MAX_CARDS
+ *             and MAX_CARDS).
+ *
+ * @return The key.
+ */
+static inline uint64_t zobrist_getNeedKey(int playerId, int need)
+{
+    return zobrist_getKey(ZOBRIST_NEED_KEYS + playerId * (2 * MAX_CARDS + 1) +
+                          need + MAX_CARDS);
+}
+
+#endif
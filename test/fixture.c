@@ -0,0 +1,92 @@
+#include "fixture.h"
+
+#include <deck.h>
+#include <player.h>
+#include <hand.h>
+#include <errors.h>
+#include <constants.h>
+
+#include <cutter.h>
+
+struct Round *fixture_createDealtRound(int roundType, int playersNumber,
+                                       struct Random *random)
+{
+    struct Round *round = round_createRound(roundType);
+    struct Deck  *deck  = deck_createDeck(playersNumber);
+
+    for (int i = 0; i < playersNumber; i++) {
+        struct Player *player = player_createPlayer("A", 0);
+        player->seat = i;
+        round_addPlayer(round, player);
+    }
+
+    deck_shuffleDeck(deck, random);
+    round_distributeDeck(round, deck);
+    deck_deleteDeck(&deck);
+
+    return round;
+}
+
+void fixture_deleteDealtRound(struct Round **round)
+{
+    for (int i = 0; i < MAX_GAME_PLAYERS; i++)
+        player_deletePlayer(&(*round)->players[i]);
+    round_deleteRound(round);
+}
+
+struct Player *fixture_getPlayerToMove(const struct Round *round)
+{
+    if (round->bidsNumber < round->playersNumber)
+        return round->players[round->bidsNumber];
+    if (round->hand == NULL)
+        return round->players[0];
+
+    return round->hand->players[round->hand->cardsNumber];
+}
+
+int fixture_getLegalCards(const struct Round *round,
+                          const struct Player *player)
+{
+    int cards = 0;
+    for (int i = 0; i < MAX_CARDS; i++)
+        if (deck_isCard(player->hand[i]))
+            cards |= 1 << i;
+    if (round->hand != NULL)
+        cards &= hand_getLegalCards(round->hand, player, round->trump);
+
+    return cards;
+}
+
+int fixture_applyRandomMove(struct Round *round, struct Random *random)
+{
+    struct Player *player = fixture_getPlayerToMove(round);
+
+    if (round->bidsNumber < round->playersNumber) {
+        int bid;
+        do {
+            bid = random_getBoundedNumber(random, round->roundType + 1);
+        } while (round_checkBid(round, player, bid) != FUNCTION_NO_ERROR);
+        cut_assert_equal_int(FUNCTION_NO_ERROR,
+                             round_applyMove(round, player, BID_MOVE, bid));
+        return 1;
+    }
+
+    int cards = fixture_getLegalCards(round, player);
+    if (cards == 0)
+        return 0;
+
+    int cardId;
+    do {
+        cardId = random_getBoundedNumber(random, MAX_CARDS);
+    } while (((cards >> cardId) & 1) == 0);
+    cut_assert_equal_int(FUNCTION_NO_ERROR,
+                         round_applyMove(round, player, CARD_MOVE, cardId));
+
+    return 1;
+}
+
+void fixture_placeRandomBids(struct Round *round, struct Random *random)
+{
+    while (round->bidsNumber < round->playersNumber)
+        fixture_applyRandomMove(round, random);
+}
@@ -0,0 +1,72 @@
+/**
+ * @file fixture.h
+ * @brief Functions shared by the tests which play random rounds.
+ */
+
+#ifndef FIXTURE_H
+#define FIXTURE_H
+
+#include <round.h>
+#include <random.h>
+
+/**
+ * @brief Function creates a round with playersNumber players and deals them a
+ *        shuffled deck.
+ *
+ * @param roundType The round type.
+ * @param playersNumber The number of the players.
+ * @param random Pointer to the generator which shuffles the deck.
+ *
+ * @return Pointer to the new round.
+ */
+struct Round *fixture_createDealtRound(int roundType, int playersNumber,
+                                       struct Random *random);
+
+/**
+ * @brief Function deletes a round made by fixture_createDealtRound() and its
+ *        players.
+ *
+ * @param round Pointer to pointer to the round.
+ */
+void fixture_deleteDealtRound(struct Round **round);
+
+/**
+ * @brief Function gets the player which must make the next move.
+ *
+ * @param round Pointer to the round.
+ *
+ * @return Pointer to the player.
+ */
+struct Player *fixture_getPlayerToMove(const struct Round *round);
+
+/**
+ * @brief Function gets the cards which a player can put down.
+ *
+ * @param round Pointer to the round.
+ * @param player Pointer to the player.
+ *
+ * @return The mask of the ids of the cards.
+ */
+int fixture_getLegalCards(const struct Round *round,
+                          const struct Player *player);
+
+/**
+ * @brief Function makes a random legal move in a round: a bid while not all
+ *        the players bid, a card after that.
+ *
+ * @param round Pointer to the round.
+ * @param random Pointer to the generator.
+ *
+ * @return 1 if a move was made, 0 if the round is over.
+ */
+int fixture_applyRandomMove(struct Round *round, struct Random *random);
+
+/**
+ * @brief Function places random legal bids for all the players of a round.
+ *
+ * @param round Pointer to the round.
+ * @param random Pointer to the generator.
+ */
+void fixture_placeRandomBids(struct Round *round, struct Random *random);
+
+#endif
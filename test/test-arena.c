@@ -0,0 +1,108 @@
+#include <arena.h>
+#include <errors.h>
+
+#include <cutter.h>
+#include <stdint.h>
+#include <string.h>
+
+void test_arena_allocate()
+{
+    cut_assert_equal_pointer(NULL, arena_allocate(NULL, 1));
+
+    struct Arena *arena = arena_createArena(100);
+    cut_assert_not_null(arena);
+    cut_assert_equal_uint(ARENA_ALIGN(100), arena->size);
+    cut_assert_equal_uint(0, arena->used);
+
+    /* Every allocation is aligned, whatever the size of the one before. */
+    size_t sizes[] = { 1, 15, 16, 17, 0, 3 };
+    unsigned char *previous = NULL;
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        unsigned char *memory = arena_allocate(arena, sizes[i]);
+        cut_assert_not_null(memory);
+        cut_assert_equal_uint(0, (uintptr_t)memory % ARENA_ALIGNMENT);
+        if (previous != NULL)
+            cut_assert_true(memory >= previous);
+        memset(memory, 0xAB, sizes[i]);
+        previous = memory;
+    }
+    cut_assert_equal_uint(ARENA_ALIGN(1) + ARENA_ALIGN(15) + ARENA_ALIGN(16) +
+                          ARENA_ALIGN(17) + ARENA_ALIGN(3), arena->used);
+
+    /* The arena is full when the aligned size doesn't fit anymore. */
+    size_t left = arena->size - arena->used;
+    cut_assert_equal_pointer(NULL, arena_allocate(arena, left + 1));
+    cut_assert_not_null(arena_allocate(arena, left));
+    cut_assert_equal_uint(arena->size, arena->used);
+    cut_assert_equal_pointer(NULL, arena_allocate(arena, 1));
+    cut_assert_equal_pointer(NULL, arena_allocate(arena, SIZE_MAX));
+
+    arena_deleteArena(&arena);
+}
+
+void test_arena_reset()
+{
+    cut_assert_equal_int(POINTER_NULL, arena_reset(NULL));
+
+    struct Arena *arena = arena_createArena(4 * ARENA_ALIGNMENT);
+    void *first = arena_allocate(arena, 4 * ARENA_ALIGNMENT);
+    cut_assert_not_null(first);
+    cut_assert_equal_pointer(NULL, arena_allocate(arena, 1));
+
+    cut_assert_equal_int(FUNCTION_NO_ERROR, arena_reset(arena));
+    cut_assert_equal_uint(0, arena->used);
+    cut_assert_false(arena_contains(arena, first));
+    cut_assert_equal_pointer(first, arena_allocate(arena, 1));
+
+    cut_assert_equal_int(POINTER_NULL, arena_deleteArena(NULL));
+    cut_assert_equal_int(FUNCTION_NO_ERROR, arena_deleteArena(&arena));
+    cut_assert_equal_pointer(NULL, arena);
+    cut_assert_equal_int(POINTER_NULL, arena_deleteArena(&arena));
+}
+
+void test_arena_contains()
+{
+    struct Arena *arena = arena_createArena(8 * ARENA_ALIGNMENT);
+    unsigned char *memory = arena_allocate(arena, 2 * ARENA_ALIGNMENT);
+
+    /* Only the used part of the arena is considered. */
+    cut_assert_true(arena_contains(arena, memory));
+    cut_assert_true(arena_contains(arena, memory + 2 * ARENA_ALIGNMENT - 1));
+    cut_assert_false(arena_contains(arena, memory + 2 * ARENA_ALIGNMENT));
+    cut_assert_false(arena_contains(arena, memory - 1));
+    cut_assert_false(arena_contains(arena, arena));
+    cut_assert_false(arena_contains(arena, NULL));
+
+    int local;
+    cut_assert_false(arena_contains(arena, &local));
+
+    arena_deleteArena(&arena);
+}
+
+void test_arena_copyArena()
+{
+    struct Arena *source      = arena_createArena(4 * ARENA_ALIGNMENT);
+    struct Arena *destination = arena_createArena(4 * ARENA_ALIGNMENT);
+    struct Arena *small       = arena_createArena(ARENA_ALIGNMENT);
+
+    cut_assert_equal_int(POINTER_NULL, arena_copyArena(NULL, source));
+    cut_assert_equal_int(POINTER_NULL, arena_copyArena(destination, NULL));
+
+    unsigned char *memory = arena_allocate(source, 2 * ARENA_ALIGNMENT);
+    for (int i = 0; i < 2 * ARENA_ALIGNMENT; i++)
+        memory[i] = (unsigned char)i;
+
+    /* A too small arena is left as it was. */
+    cut_assert_equal_int(FULL, arena_copyArena(small, source));
+    cut_assert_equal_uint(0, small->used);
+
+    cut_assert_equal_int(FUNCTION_NO_ERROR,
+                         arena_copyArena(destination, source));
+    cut_assert_equal_uint(source->used, destination->used);
+    cut_assert_equal_memory(source->memory, source->used,
+                            destination->memory, destination->used);
+
+    arena_deleteArena(&source);
+    arena_deleteArena(&destination);
+    arena_deleteArena(&small);
+}
@@ -0,0 +1,265 @@
+#include <bidtable.h>
+#include <robot.h>
+#include <round.h>
+#include <deck.h>
+#include <random.h>
+#include <errors.h>
+#include <constants.h>
+
+#include <cutter.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fixture.h"
+
+#define BIDTABLE_FILE "test-bidtable.bin"
+
+void test_bidtable_addSample()
+{
+    struct BidTable *table = bidtable_createBidTable(4);
+
+    cut_assert_equal_pointer(NULL, bidtable_createBidTable(3));
+    cut_assert_equal_int(POINTER_NULL, bidtable_addSample(NULL, 1, 0));
+    cut_assert_equal_int(ILLEGAL_VALUE, bidtable_addSample(table, 0, 0));
+    cut_assert_equal_int(ILLEGAL_VALUE,
+                         bidtable_addSample(table, 1, MAX_CARDS + 1));
+
+    /* An empty entry is kept for every eight entries. */
+    int entriesNumber = 15 - 15 / 8;
+    for (int i = 1; i <= entriesNumber; i++) {
+        cut_assert_equal_int(FUNCTION_NO_ERROR,
+                             bidtable_addSample(table, i, i % 3));
+        cut_assert_equal_int(FUNCTION_NO_ERROR,
+                             bidtable_addSample(table, i, 1));
+    }
+    cut_assert_equal_int(FULL, bidtable_addSample(table, 100, 0));
+    cut_assert_equal_int(entriesNumber, table->header.entriesNumber);
+
+    for (int i = 1; i <= entriesNumber; i++) {
+        const struct BidTableEntry *entry = bidtable_findEntry(table, i);
+        cut_assert_not_null(entry);
+        cut_assert_equal_int(2, entry->samplesNumber);
+        cut_assert_equal_int(i % 3 == 1 ? 2 : 1, entry->hands[1]);
+    }
+    cut_assert_null(bidtable_findEntry(table, 100));
+
+    bidtable_deleteBidTable(&table);
+}
+
+void test_bidtable_loadBidTable()
+{
+    struct BidTable *table = bidtable_createBidTable(6);
+    for (int i = 1; i <= 40; i++)
+        bidtable_addSample(table, i * 1000003, i % (MAX_CARDS + 1));
+
+    cut_assert_null(bidtable_loadBidTable(NULL));
+    cut_assert_equal_int(FUNCTION_NO_ERROR,
+                         bidtable_saveBidTable(table, BIDTABLE_FILE));
+    struct BidTable *loaded = bidtable_loadBidTable(BIDTABLE_FILE);
+    cut_assert_not_null(loaded);
+    cut_assert_equal_int(0, memcmp(&table->header, &loaded->header,
+                                   sizeof(struct BidTableHeader)));
+    cut_assert_equal_int(0, memcmp(table->entries, loaded->entries,
+                                   64 * sizeof(struct BidTableEntry)));
+    bidtable_deleteBidTable(&loaded);
+
+    /* A file whose number of entries doesn't match its entries. */
+    table->header.entriesNumber--;
+    bidtable_saveBidTable(table, BIDTABLE_FILE);
+    cut_assert_null(bidtable_loadBidTable(BIDTABLE_FILE));
+
+    /* A file without empty entries, in which a search wouldn't stop. */
+    for (int i = 0; i < 64; i++)
+        table->entries[i].key = i + 1;
+    table->header.entriesNumber = 64;
+    bidtable_saveBidTable(table, BIDTABLE_FILE);
+    cut_assert_null(bidtable_loadBidTable(BIDTABLE_FILE));
+
+    remove(BIDTABLE_FILE);
+    bidtable_deleteBidTable(&table);
+}
+
+/**
+ * @brief Function gives to a player the cards of another player.
+ */
+static void copyCards(struct Player *destination, const struct Player *source)
+{
+    for (int i = 0; i < MAX_CARDS; i++)
+        destination->hand[i] = source->hand[i];
+}
+
+/**
+ * @brief Function gets the key of a player, the key must be found.
+ */
+static uint64_t getKey(const struct Player *player, const struct Round *round)
+{
+    uint64_t key = 0;
+    cut_assert_equal_int(FUNCTION_NO_ERROR,
+                         bidtable_getKey(player, round, &key));
+    cut_assert_true(key != 0);
+
+    return key;
+}
+
+void test_bidtable_getKey()
+{
+    struct Random random;
+    random_setSeed(&random, 1);
+    uint64_t key;
+
+    struct Round *round = fixture_createDealtRound(5, 4, &random);
+    struct Player *player = round->players[1];
+    cut_assert_equal_int(PLAYER_NULL, bidtable_getKey(NULL, round, &key));
+    cut_assert_equal_int(ROUND_NULL, bidtable_getKey(player, NULL, &key));
+    cut_assert_equal_int(POINTER_NULL, bidtable_getKey(player, round, NULL));
+
+    uint64_t first = getKey(player, round);
+    enum Suit trump = deck_getCardSuit(round->trump);
+
+    /* All the orders of the suits other than the trump are the same hand. */
+    enum Suit others[SuitEnd - 1];
+    int othersNumber = 0;
+    for (int i = 0; i < SuitEnd; i++)
+        if (i != trump)
+            others[othersNumber++] = i;
+    struct Card cards[MAX_CARDS];
+    for (int i = 0; i < MAX_CARDS; i++)
+        cards[i] = player->hand[i];
+    for (int permutation = 0; permutation < 6; permutation++) {
+        enum Suit suits[SuitEnd];
+        suits[trump] = trump;
+        for (int i = 0; i < othersNumber; i++)
+            suits[others[i]] = others[(i + permutation) % othersNumber];
+        if (permutation >= 3) {
+            enum Suit swap = suits[others[0]];
+            suits[others[0]] = suits[others[1]];
+            suits[others[1]] = swap;
+        }
+
+        for (int i = 0; i < MAX_CARDS; i++)
+            if (deck_isCard(cards[i]))
+                player->hand[i] = deck_createCard(
+                                      suits[deck_getCardSuit(cards[i])],
+                                      deck_getCardValue(cards[i]));
+        cut_assert_equal_int(1, first == getKey(player, round));
+    }
+    for (int i = 0; i < MAX_CARDS; i++)
+        player->hand[i] = cards[i];
+
+    /* Another trump, or none. */
+    struct Card oldTrump = round->trump;
+    round_addTrump(round, deck_createCard(others[0], VALUES[0]));
+    cut_assert_equal_int(0, first == getKey(player, round));
+    round_addTrump(round, EMPTY_CARD);
+    cut_assert_equal_int(0, first == getKey(player, round));
+    round_addTrump(round, oldTrump);
+    cut_assert_equal_int(1, first == getKey(player, round));
+
+    /* The same cards in another seat, with other players and in another
+     * type of round. */
+    struct Round *other = fixture_createDealtRound(5, 4, &random);
+    round_addTrump(other, round->trump);
+    copyCards(other->players[1], player);
+    cut_assert_equal_int(1, first == getKey(other->players[1], other));
+    copyCards(other->players[2], player);
+    cut_assert_equal_int(0, first == getKey(other->players[2], other));
+    fixture_deleteDealtRound(&other);
+
+    other = fixture_createDealtRound(5, 5, &random);
+    round_addTrump(other, round->trump);
+    copyCards(other->players[1], player);
+    cut_assert_equal_int(0, first == getKey(other->players[1], other));
+    fixture_deleteDealtRound(&other);
+
+    other = fixture_createDealtRound(6, 4, &random);
+    round_addTrump(other, round->trump);
+    copyCards(other->players[1], player);
+    cut_assert_equal_int(0, first == getKey(other->players[1], other));
+    fixture_deleteDealtRound(&other);
+
+    fixture_deleteDealtRound(&round);
+}
+
+/**
+ * @brief Function gets the sum of the points of a bid over the rounds of an
+ *        entry.
+ */
+static long getPoints(const struct BidTableEntry *entry, int roundType,
+                      int bid)
+{
+    long points = 0;
+    for (int hands = 0; hands <= roundType; hands++) {
+        if (hands == bid)
+            points += (long)entry->hands[hands] * (POINTS_PER_ROUND + bid);
+        else
+            points -= (long)entry->hands[hands] * abs(hands - bid);
+    }
+
+    return points;
+}
+
+void test_bidtable_getBid()
+{
+    struct BidTable *table = bidtable_createBidTable(8);
+    struct Random random;
+    random_setSeed(&random, 2);
+
+    /* The bid with the most points on average, which isn't always the
+     * number of hands won most often. */
+    for (int test = 0; test < 20; test++) {
+        struct Round *round = fixture_createDealtRound(MAX_CARDS, 4, &random);
+        struct Player *player = round->players[0];
+        uint64_t key = getKey(player, round);
+
+        for (int i = 0; i < BIDTABLE_MIN_SAMPLES * 4; i++)
+            bidtable_addSample(table, key,
+                               random_getBoundedNumber(&random, 3) +
+                               random_getBoundedNumber(&random, 4));
+        const struct BidTableEntry *entry = bidtable_findEntry(table, key);
+        cut_assert_not_null(entry);
+
+        int bid = bidtable_getBid(table, player, round);
+        cut_assert_equal_int(FUNCTION_NO_ERROR,
+                             round_checkBid(round, player, bid));
+        for (int i = 0; i <= MAX_CARDS; i++)
+            cut_assert_operator_int(getPoints(entry, MAX_CARDS, i), <=,
+                                    getPoints(entry, MAX_CARDS, bid));
+
+        fixture_deleteDealtRound(&round);
+    }
+
+    /* The last player can't bid so that the sum of the bids is the number
+     * of hands, even if that bid has the most points. */
+    struct Round *round = fixture_createDealtRound(MAX_CARDS, 4, &random);
+    for (int i = 0; i < 3; i++)
+        round_placeBid(round, round->players[i], 1);
+    struct Player *player = round->players[3];
+    uint64_t key = getKey(player, round);
+    for (int i = 0; i < BIDTABLE_MIN_SAMPLES; i++)
+        bidtable_addSample(table, key, MAX_CARDS - 3);
+    cut_assert_equal_int(ILLEGAL_BID,
+                         round_checkBid(round, player, MAX_CARDS - 3));
+    int bid = bidtable_getBid(table, player, round);
+    cut_assert_not_equal_int(MAX_CARDS - 3, bid);
+    cut_assert_equal_int(FUNCTION_NO_ERROR,
+                         round_checkBid(round, player, bid));
+    fixture_deleteDealtRound(&round);
+
+    /* With too few rounds, or without the table, the heuristic robot bids. */
+    round = fixture_createDealtRound(MAX_CARDS, 4, &random);
+    player = round->players[0];
+    key = getKey(player, round);
+    int robotBid = robot_getBid(player, round);
+    int tableBid = (robotBid + 1) % (MAX_CARDS + 1);
+    for (int i = 0; i < BIDTABLE_MIN_SAMPLES - 1; i++)
+        bidtable_addSample(table, key, tableBid);
+    cut_assert_equal_int(robotBid, bidtable_getBid(table, player, round));
+    cut_assert_equal_int(robotBid, bidtable_getBid(NULL, player, round));
+    bidtable_addSample(table, key, tableBid);
+    cut_assert_equal_int(tableBid, bidtable_getBid(table, player, round));
+    cut_assert_equal_int(PLAYER_NULL, bidtable_getBid(table, NULL, round));
+    fixture_deleteDealtRound(&round);
+
+    bidtable_deleteBidTable(&table);
+}
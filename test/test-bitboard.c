@@ -0,0 +1,146 @@
+#include <bitboard.h>
+#include <player.h>
+#include <round.h>
+#include <random.h>
+#include <errors.h>
+#include <constants.h>
+
+#include <cutter.h>
+
+#include "fixture.h"
+
+/**
+ * @brief Function checks that a bitboard has exactly the cards of a player.
+ */
+static void checkPlayerCards(uint64_t cards, const struct Player *player)
+{
+    cut_assert_equal_int(player_getCardsNumber(player),
+                         bitboard_countCards(cards));
+
+    for (int i = 0; i < MAX_CARDS; i++)
+        if (deck_isCard(player->hand[i]))
+            cut_assert_true((cards & bitboard_getCardMask(player->hand[i])) !=
+                            0);
+
+    for (uint64_t rest = cards; rest != 0; rest &= rest - 1) {
+        int index = __builtin_ctzll(rest);
+        int found = 0;
+        for (int i = 0; i < MAX_CARDS; i++)
+            if (deck_isCard(player->hand[i]) && player->hand[i].id == index)
+                found++;
+        cut_assert_equal_int(1, found);
+    }
+}
+
+void test_bitboard_getPlayerCards()
+{
+    struct Random random;
+    random_setSeed(&random, 1);
+
+    cut_assert_true(bitboard_getPlayerCards(NULL) == 0);
+
+    for (int playersNumber = MIN_GAME_PLAYERS;
+         playersNumber <= MAX_GAME_PLAYERS; playersNumber++)
+        for (int roundType = MIN_CARDS; roundType <= MAX_CARDS; roundType++) {
+            struct Round *round = fixture_createDealtRound(roundType,
+                                                           playersNumber,
+                                                           &random);
+
+            uint64_t allCards = 0;
+            for (int i = 0; i < playersNumber; i++) {
+                struct Player *player = round->players[i];
+                uint64_t cards = bitboard_getPlayerCards(player);
+                checkPlayerCards(cards, player);
+                cut_assert_true((allCards & cards) == 0);
+                allCards |= cards;
+
+                /* The bitboard follows the hand when cards are removed and
+                 * added back. */
+                int cardId = random_getBoundedNumber(&random, roundType);
+                struct Card card = player->hand[cardId];
+                player_removeCard(player, cardId);
+                cards = bitboard_getPlayerCards(player);
+                checkPlayerCards(cards, player);
+                cut_assert_true((cards & bitboard_getCardMask(card)) == 0);
+
+                player_addCard(player, card);
+                checkPlayerCards(bitboard_getPlayerCards(player), player);
+            }
+
+            fixture_deleteDealtRound(&round);
+        }
+}
+
+void test_bitboard_getSuitCards()
+{
+    struct Random random;
+    random_setSeed(&random, 2);
+
+    for (int test = 0; test < 1000; test++) {
+        uint64_t cards = 0;
+        for (int i = 0; i < DECK_SIZE; i++)
+            if (random_getBoundedNumber(&random, 2) == 1)
+                cards |= UINT64_C(1) << i;
+
+        uint64_t allSuits = 0;
+        for (int suit = DIAMONDS; suit < SuitEnd; suit++) {
+            uint64_t suitCards = bitboard_getSuitCards(cards, suit);
+            cut_assert_true((suitCards & ~cards) == 0);
+            cut_assert_true((allSuits & suitCards) == 0);
+            allSuits |= suitCards;
+
+            for (uint64_t rest = suitCards; rest != 0; rest &= rest - 1)
+                cut_assert_equal_int(suit,
+                                     bitboard_getSuit(__builtin_ctzll(rest)));
+        }
+        cut_assert_true(allSuits == cards);
+        cut_assert_true(bitboard_getSuitCards(cards, SuitEnd) == 0);
+    }
+}
+
+void test_bitboard_getCardMask()
+{
+    cut_assert_true(bitboard_getCardMask(EMPTY_CARD) == 0);
+    cut_assert_equal_int(SuitEnd, bitboard_getSuit(-1));
+    cut_assert_equal_int(SuitEnd, bitboard_getSuit(DECK_SIZE));
+    cut_assert_equal_int(ILLEGAL_VALUE, bitboard_getValue(-1));
+    cut_assert_equal_int(ILLEGAL_VALUE, bitboard_getValue(DECK_SIZE));
+
+    /* The lowest and the highest card of every suit are at the ends of the
+     * bits of the suit, so they mustn't be taken for cards of the suits
+     * next to it. */
+    for (int suit = DIAMONDS; suit < SuitEnd; suit++) {
+        struct Card lowest  = deck_createCard(suit, VALUES[0]);
+        struct Card highest = deck_createCard(suit, VALUES[RANKS_NUMBER - 1]);
+        uint64_t lowestMask  = bitboard_getCardMask(lowest);
+        uint64_t highestMask = bitboard_getCardMask(highest);
+
+        cut_assert_true(lowestMask == UINT64_C(1) << (suit * RANKS_NUMBER));
+        cut_assert_true(highestMask ==
+                        UINT64_C(1) << (suit * RANKS_NUMBER +
+                                        RANKS_NUMBER - 1));
+
+        int lowestIndex  = __builtin_ctzll(lowestMask);
+        int highestIndex = __builtin_ctzll(highestMask);
+        cut_assert_equal_int(suit, bitboard_getSuit(lowestIndex));
+        cut_assert_equal_int(suit, bitboard_getSuit(highestIndex));
+        cut_assert_equal_int(VALUES[0], bitboard_getValue(lowestIndex));
+        cut_assert_equal_int(VALUES[RANKS_NUMBER - 1],
+                             bitboard_getValue(highestIndex));
+
+        uint64_t cards = lowestMask | highestMask;
+        if (suit > DIAMONDS)
+            cards |= bitboard_getCardMask(deck_createCard(suit - 1,
+                                          VALUES[RANKS_NUMBER - 1]));
+        if (suit < SuitEnd - 1)
+            cards |= bitboard_getCardMask(deck_createCard(suit + 1,
+                                                          VALUES[0]));
+        cut_assert_equal_int(highestIndex,
+                             bitboard_getHighestCard(cards, suit));
+        cut_assert_equal_int(lowestIndex,
+                             bitboard_getLowestCard(cards, suit));
+        cut_assert_equal_int(NOT_FOUND,
+                             bitboard_getHighestCard(cards & ~lowestMask &
+                                                     ~highestMask, suit));
+    }
+}
@@ -0,0 +1,279 @@
+#include <deal.h>
+#include <round.h>
+#include <player.h>
+#include <bitboard.h>
+#include <random.h>
+#include <errors.h>
+
+#include <cutter.h>
+#include <string.h>
+
+#include "fixture.h"
+
+/**
+ * @brief Function checks that every index of a number of players and a round
+ *        type gives a different deal: the deal of every index is valid and
+ *        its rank is the index.
+ */
+static void checkAllDeals(int playersNumber, int roundType,
+                          DealIndex expectedNumber)
+{
+    DealIndex dealsNumber;
+    cut_assert_equal_int(FUNCTION_NO_ERROR,
+                         deal_getDealsNumber(playersNumber, roundType,
+                                             &dealsNumber));
+    cut_assert_true(dealsNumber == expectedNumber);
+
+    /* The loop stops at the first wrong index, there are too many indexes
+     * for an assertion on every one. */
+    struct Deal deal;
+    DealIndex index;
+    for (index = 0; index < dealsNumber; index++) {
+        DealIndex rank;
+        if (deal_unrankDeal(&deal, playersNumber, roundType, index) !=
+            FUNCTION_NO_ERROR || deal_rankDeal(&deal, &rank) !=
+            FUNCTION_NO_ERROR || rank != index)
+            break;
+    }
+    cut_assert_true(index == dealsNumber);
+
+    cut_assert_equal_int(ILLEGAL_VALUE,
+                         deal_unrankDeal(&deal, playersNumber, roundType,
+                                         dealsNumber));
+}
+
+void test_deal_getDealsNumber()
+{
+    DealIndex dealsNumber;
+
+    cut_assert_equal_int(POINTER_NULL, deal_getDealsNumber(3, 1, NULL));
+    cut_assert_equal_int(ILLEGAL_VALUE,
+                         deal_getDealsNumber(MIN_GAME_PLAYERS - 1, 1,
+                                             &dealsNumber));
+    cut_assert_equal_int(ILLEGAL_VALUE,
+                         deal_getDealsNumber(MAX_GAME_PLAYERS + 1, 1,
+                                             &dealsNumber));
+    cut_assert_equal_int(ILLEGAL_VALUE,
+                         deal_getDealsNumber(3, MIN_CARDS - 1,
+                                             &dealsNumber));
+    cut_assert_equal_int(ILLEGAL_VALUE,
+                         deal_getDealsNumber(3, MAX_CARDS + 1,
+                                             &dealsNumber));
+
+    /* All the cards are distributed, so there isn't a trump. */
+    DealIndex expected = 1;
+    for (int i = 0; i < MAX_GAME_PLAYERS; i++)
+        for (int j = 1; j <= MAX_CARDS; j++)
+            expected = expected * (MAX_GAME_PLAYERS * MAX_CARDS -
+                                   i * MAX_CARDS - j + 1) / j;
+    cut_assert_equal_int(FUNCTION_NO_ERROR,
+                         deal_getDealsNumber(MAX_GAME_PLAYERS, MAX_CARDS,
+                                             &dealsNumber));
+    cut_assert_true(dealsNumber == expected);
+}
+
+void test_deal_rankDeal()
+{
+    /* 3 players have 24 cards, 4 players 32 cards. */
+    checkAllDeals(3, 1, (DealIndex)24 * 23 * 22 * 21);
+    checkAllDeals(4, 1, (DealIndex)32 * 31 * 30 * 29 * 28);
+    checkAllDeals(3, 2, (DealIndex)276 * 231 * 190 * 18);
+
+    struct Deal deal;
+    DealIndex index;
+    cut_assert_equal_int(POINTER_NULL, deal_rankDeal(NULL, &index));
+    cut_assert_equal_int(POINTER_NULL, deal_rankDeal(&deal, NULL));
+    cut_assert_equal_int(POINTER_NULL, deal_unrankDeal(NULL, 3, 1, 0));
+
+    /* The deals with the same card twice, with a card out of the deck or
+     * with the trump in a hand aren't valid. */
+    deal_unrankDeal(&deal, 3, 1, 0);
+    struct Deal invalid = deal;
+    invalid.hands[1] = invalid.hands[0];
+    cut_assert_equal_int(ILLEGAL_VALUE, deal_rankDeal(&invalid, &index));
+    invalid = deal;
+    invalid.hands[0] = UINT64_C(1);
+    cut_assert_equal_int(ILLEGAL_VALUE, deal_rankDeal(&invalid, &index));
+    invalid = deal;
+    invalid.trump.id = __builtin_ctzll(invalid.hands[2]);
+    cut_assert_equal_int(ILLEGAL_VALUE, deal_rankDeal(&invalid, &index));
+}
+
+void test_deal_unrankDeal()
+{
+    struct Random random;
+    random_setSeed(&random, 1);
+
+    for (int playersNumber = MIN_GAME_PLAYERS;
+         playersNumber <= MAX_GAME_PLAYERS; playersNumber++)
+        for (int roundType = MIN_CARDS; roundType <= MAX_CARDS; roundType++) {
+            DealIndex dealsNumber;
+            deal_getDealsNumber(playersNumber, roundType, &dealsNumber);
+
+            for (int test = 0; test < 1000; test++) {
+                DealIndex index;
+                DealIndex rank;
+                struct Deal deal;
+                cut_assert_equal_int(FUNCTION_NO_ERROR,
+                                     deal_getRandomIndex(&random, dealsNumber,
+                                                         &index));
+                cut_assert_true(index < dealsNumber);
+                cut_assert_equal_int(FUNCTION_NO_ERROR,
+                                     deal_unrankDeal(&deal, playersNumber,
+                                                     roundType, index));
+                cut_assert_equal_int(FUNCTION_NO_ERROR,
+                                     deal_rankDeal(&deal, &rank));
+                cut_assert_true(rank == index);
+            }
+        }
+}
+
+/**
+ * @brief Function creates a round with players which don't have cards yet.
+ */
+static struct Round *createEmptyRound(int roundType, int playersNumber)
+{
+    struct Round *round = round_createRound(roundType);
+    for (int i = 0; i < playersNumber; i++) {
+        struct Player *player = player_createPlayer("A", 0);
+        player->seat = i;
+        round_addPlayer(round, player);
+    }
+
+    return round;
+}
+
+/**
+ * @brief Function checks that two deals have the same cards.
+ */
+static void checkSameDeal(const struct Deal *expected,
+                          const struct Deal *actual)
+{
+    cut_assert_equal_int(expected->playersNumber, actual->playersNumber);
+    cut_assert_equal_int(expected->roundType, actual->roundType);
+    cut_assert_equal_int(expected->trump.id, actual->trump.id);
+    for (int i = 0; i < expected->playersNumber; i++)
+        cut_assert_true(expected->hands[i] == actual->hands[i]);
+}
+
+void test_deal_readRound()
+{
+    struct Random random;
+    random_setSeed(&random, 2);
+
+    struct Deal deal;
+    struct Round *round = fixture_createDealtRound(3, 4, &random);
+    cut_assert_equal_int(POINTER_NULL, deal_readRound(NULL, round));
+    cut_assert_equal_int(ROUND_NULL, deal_readRound(&deal, NULL));
+    cut_assert_equal_int(POINTER_NULL, deal_distributeDeal(NULL, round));
+    cut_assert_equal_int(FUNCTION_NO_ERROR, deal_readRound(&deal, round));
+    cut_assert_equal_int(ROUND_NULL, deal_distributeDeal(&deal, NULL));
+
+    /* A deal can't be distributed in a round of other size, and a round in
+     * which a card was put down doesn't have a deal anymore. */
+    struct Round *other = createEmptyRound(3, 5);
+    cut_assert_equal_int(ILLEGAL_VALUE, deal_distributeDeal(&deal, other));
+    fixture_deleteDealtRound(&other);
+    other = createEmptyRound(4, 4);
+    cut_assert_equal_int(ILLEGAL_VALUE, deal_distributeDeal(&deal, other));
+    fixture_deleteDealtRound(&other);
+    fixture_placeRandomBids(round, &random);
+    fixture_applyRandomMove(round, &random);
+    cut_assert_equal_int(ILLEGAL_VALUE, deal_readRound(&deal, round));
+    fixture_deleteDealtRound(&round);
+
+    /* A deal distributed in a round is read back and has the same rank, and
+     * a round dealt from the deck gets the same cards when its deal is
+     * distributed again. */
+    for (int playersNumber = MIN_GAME_PLAYERS;
+         playersNumber <= MAX_GAME_PLAYERS; playersNumber++)
+        for (int roundType = MIN_CARDS; roundType <= MAX_CARDS; roundType++) {
+            DealIndex dealsNumber;
+            deal_getDealsNumber(playersNumber, roundType, &dealsNumber);
+
+            for (int test = 0; test < 20; test++) {
+                DealIndex index;
+                DealIndex rank;
+                struct Deal read;
+                deal_getRandomIndex(&random, dealsNumber, &index);
+                deal_unrankDeal(&deal, playersNumber, roundType, index);
+
+                round = createEmptyRound(roundType, playersNumber);
+                cut_assert_equal_int(FUNCTION_NO_ERROR,
+                                     deal_distributeDeal(&deal, round));
+                cut_assert_equal_int(deal.trump.id, round->trump.id);
+                cut_assert_equal_int(FUNCTION_NO_ERROR,
+                                     deal_readRound(&read, round));
+                checkSameDeal(&deal, &read);
+                cut_assert_equal_int(FUNCTION_NO_ERROR,
+                                     deal_rankDeal(&read, &rank));
+                cut_assert_true(rank == index);
+                fixture_deleteDealtRound(&round);
+
+                round = fixture_createDealtRound(roundType, playersNumber,
+                                                 &random);
+                cut_assert_equal_int(FUNCTION_NO_ERROR,
+                                     deal_readRound(&deal, round));
+                cut_assert_equal_int(FUNCTION_NO_ERROR,
+                                     deal_rankDeal(&deal, &index));
+                cut_assert_equal_int(FUNCTION_NO_ERROR,
+                                     deal_unrankDeal(&read, playersNumber,
+                                                     roundType, index));
+                other = createEmptyRound(roundType, playersNumber);
+                deal_distributeDeal(&read, other);
+                for (int i = 0; i < playersNumber; i++)
+                    cut_assert_true(
+                        bitboard_getPlayerCards(round->players[i]) ==
+                        bitboard_getPlayerCards(other->players[i]));
+                cut_assert_equal_int(round->trump.id, other->trump.id);
+                cut_assert_true(round->key == other->key);
+                fixture_deleteDealtRound(&other);
+                fixture_deleteDealtRound(&round);
+            }
+        }
+}
+
+void test_deal_parseIndex()
+{
+    const char *maxText = "340282366920938463463374607431768211455";
+    const char *overflowText = "340282366920938463463374607431768211456";
+    DealIndex maxIndex = ~(DealIndex)0;
+    char text[DEAL_INDEX_DIGITS + 1];
+    DealIndex index;
+
+    cut_assert_equal_int(POINTER_NULL, deal_formatIndex(0, NULL, 2));
+    cut_assert_equal_int(POINTER_NULL, deal_parseIndex(NULL, &index));
+    cut_assert_equal_int(POINTER_NULL, deal_parseIndex("1", NULL));
+
+    cut_assert_equal_int(FUNCTION_NO_ERROR,
+                         deal_formatIndex(0, text, sizeof(text)));
+    cut_assert_equal_string("0", text);
+    cut_assert_equal_int(FUNCTION_NO_ERROR,
+                         deal_formatIndex(maxIndex, text, sizeof(text)));
+    cut_assert_equal_string(maxText, text);
+    cut_assert_equal_int(FULL, deal_formatIndex(maxIndex, text,
+                                                sizeof(text) - 1));
+    cut_assert_equal_int(FULL, deal_formatIndex(10, text, 2));
+
+    cut_assert_equal_int(FUNCTION_NO_ERROR, deal_parseIndex(maxText, &index));
+    cut_assert_true(index == maxIndex);
+    cut_assert_equal_int(FUNCTION_NO_ERROR, deal_parseIndex("007", &index));
+    cut_assert_true(index == 7);
+    cut_assert_equal_int(ILLEGAL_VALUE, deal_parseIndex("", &index));
+    cut_assert_equal_int(ILLEGAL_VALUE, deal_parseIndex("12a", &index));
+    cut_assert_equal_int(ILLEGAL_VALUE, deal_parseIndex("-1", &index));
+    cut_assert_equal_int(ILLEGAL_VALUE, deal_parseIndex(overflowText, &index));
+
+    struct Random random;
+    random_setSeed(&random, 2);
+    for (int test = 0; test < 10000; test++) {
+        DealIndex value = (DealIndex)random_getNumber(&random) << 64 |
+                          random_getNumber(&random);
+        value >>= random_getBoundedNumber(&random, 128);
+        cut_assert_equal_int(FUNCTION_NO_ERROR,
+                             deal_formatIndex(value, text, sizeof(text)));
+        cut_assert_equal_int(FUNCTION_NO_ERROR, deal_parseIndex(text, &index));
+        cut_assert_true(index == value);
+        cut_assert_equal_int(strspn(text, "0123456789"), strlen(text));
+    }
+}
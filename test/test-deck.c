@@ -7,29 +7,21 @@
 
 void test_deck_createCard()
 {
-    struct Card *card;
-    cut_assert_equal_pointer(NULL, deck_createCard(SuitEnd, VALUES[0]));
-    cut_assert_equal_pointer(NULL, deck_createCard(DIAMONDS, -1));
-    cut_assert_equal_pointer(NULL, deck_createCard(SuitEnd, -1));
+    struct Card card;
+    cut_assert_equal_int(0, deck_isCard(deck_createCard(SuitEnd, VALUES[0])));
+    cut_assert_equal_int(0, deck_isCard(deck_createCard(DIAMONDS, -1)));
+    cut_assert_equal_int(0, deck_isCard(deck_createCard(SuitEnd, -1)));
 
     for (int i = 0; i < SuitEnd; i++)
         for (int j = 0; VALUES[j] != -1; j++) {
             card = deck_createCard(i, VALUES[j]);
-            cut_assert_equal_int(card->suit, i);
-            cut_assert_equal_int(card->value, VALUES[j]);
-            deck_deleteCard(&card);
+            cut_assert_equal_int(1, deck_isCard(card));
+            cut_assert_equal_int(i, deck_getCardSuit(card));
+            cut_assert_equal_int(j, deck_getCardRank(card));
+            cut_assert_equal_int(VALUES[j], deck_getCardValue(card));
         }
 }
 
-void test_deck_deleteCard()
-{
-    struct Card *card = deck_createCard(DIAMONDS, VALUES[0]);
-    cut_assert_equal_int(POINTER_NULL, deck_deleteCard(NULL));
-    cut_assert_equal_int(FUNCTIOON_NO_ERROR, deck_deleteCard(&card));
-    cut_assert_equal_pointer(NULL, card);
-    cut_assert_equal_int(CARD_NULL, deck_deleteCard(&card));
-}
-
 void test_deck_createDeck()
 {
     struct Deck *deck;
@@ -47,9 +39,9 @@ void test_deck_createDeck()
         int duplicates = 0;
         for (int j = 0; j < DECK_SIZE; j++)
             for (int k = 0; k < DECK_SIZE; k++)
-                if (k != j && deck->cards[k] != NULL && deck->cards[j] != NULL
-                    && deck->cards[k]->suit == deck->cards[j]->suit &&
-                    deck->cards[k]->value == deck->cards[j]->value)
+                if (k != j && deck_isCard(deck->cards[k]) &&
+                    deck_isCard(deck->cards[j]) &&
+                    deck->cards[k].id == deck->cards[j].id)
                     duplicates++;
         cut_assert_equal_int(0, duplicates);
         deck_deleteDeck(&deck);
@@ -60,7 +52,7 @@ void test_deck_deleteDeck()
 {
     cut_assert_equal_int(POINTER_NULL, deck_deleteDeck(NULL));
     struct Deck *deck = deck_createDeck(MAX_GAME_PLAYERS);
-    cut_assert_equal_int(FUNCTIOON_NO_ERROR, deck_deleteDeck(&deck));
+    cut_assert_equal_int(FUNCTION_NO_ERROR, deck_deleteDeck(&deck));
     cut_assert_equal_pointer(NULL, deck);
     cut_assert_equal_int(DECK_NULL, deck_deleteDeck(&deck));
 }
@@ -79,38 +71,65 @@ void test_deck_getDeckSize()
 
 void test_deck_shuffleDeck()
 {
-    cut_assert_equal_int(DECK_NULL, deck_shuffleDeck(NULL));
+    struct Random random;
+    random_setSeed(&random, 1);
+    cut_assert_equal_int(DECK_NULL, deck_shuffleDeck(NULL, &random));
     struct Deck *deck = deck_createDeck(MAX_GAME_PLAYERS);
+    cut_assert_equal_int(POINTER_NULL, deck_shuffleDeck(deck, NULL));
     struct Deck *shuffled_deck = malloc(sizeof(struct Deck));
     memcpy(shuffled_deck, deck, sizeof(struct Deck));
-    cut_assert_equal_int(FUNCTIOON_NO_ERROR, deck_shuffleDeck(shuffled_deck));
 
     int deckSize = deck_getDeckSize(deck);
     int differences = 0;
     for (int j = 0; j < 100; j++) {
+        cut_assert_equal_int(FUNCTION_NO_ERROR,
+                             deck_shuffleDeck(shuffled_deck, &random));
+        cut_assert_equal_int(deckSize, deck_getDeckSize(shuffled_deck));
         differences = 0;
         for (int i = 0; i < deckSize; i++)
-            if (deck->cards[i]->suit  != shuffled_deck->cards[i]->suit ||
-                deck->cards[i]->value != shuffled_deck->cards[i]->value)
+            if (deck->cards[i].id != shuffled_deck->cards[i].id)
                 differences++;
         cut_assert_not_equal_int(0, differences);
+
+        /* The shuffled deck has every card of the deck exactly once. */
+        int found[DECK_SIZE] = { 0 };
+        for (int i = 0; i < deckSize; i++)
+            found[shuffled_deck->cards[i].id]++;
+        for (int i = 0; i < deckSize; i++)
+            cut_assert_equal_int(1, found[deck->cards[i].id]);
     }
 
+    /* The same seed shuffles the deck in the same order. */
+    struct Deck *other_deck = malloc(sizeof(struct Deck));
+    memcpy(shuffled_deck, deck, sizeof(struct Deck));
+    memcpy(other_deck, deck, sizeof(struct Deck));
+    random_setSeed(&random, 2);
+    deck_shuffleDeck(shuffled_deck, &random);
+    random_setSeed(&random, 2);
+    deck_shuffleDeck(other_deck, &random);
+    cut_assert_equal_memory(shuffled_deck, sizeof(struct Deck), other_deck,
+                            sizeof(struct Deck));
+
+    free(other_deck);
+    free(shuffled_deck);
     deck_deleteDeck(&deck);
 }
 
 void test_deck_compareCards()
 {
-    struct Card *card1 = deck_createCard(DIAMONDS, VALUES[2]);
-    struct Card *card2 = deck_createCard(DIAMONDS, VALUES[2]);
+    struct Card card1 = deck_createCard(DIAMONDS, VALUES[2]);
+    struct Card card2 = deck_createCard(DIAMONDS, VALUES[2]);
 
-    cut_assert_equal_int(CARD_NULL, deck_compareCards(card1, NULL, DIAMONDS));
-    cut_assert_equal_int(CARD_NULL, deck_compareCards(NULL, card2, DIAMONDS));
-    cut_assert_equal_int(CARD_NULL, deck_compareCards(NULL, NULL, DIAMONDS));
+    cut_assert_equal_int(CARD_NULL,
+                         deck_compareCards(card1, EMPTY_CARD, DIAMONDS));
+    cut_assert_equal_int(CARD_NULL,
+                         deck_compareCards(EMPTY_CARD, card2, DIAMONDS));
+    cut_assert_equal_int(CARD_NULL,
+                         deck_compareCards(EMPTY_CARD, EMPTY_CARD, DIAMONDS));
 
     cut_assert_equal_int(0, deck_compareCards(card1, card2, SuitEnd));
 
-    card1->value = VALUES[3];
+    card1 = deck_createCard(DIAMONDS, VALUES[3]);
     cut_assert_equal_int(1, deck_compareCards(card1, card2, SuitEnd));
     cut_assert_equal_int(1, deck_compareCards(card1, card2, DIAMONDS));
     cut_assert_equal_int(1, deck_compareCards(card1, card2, CLUBS));
@@ -118,15 +137,11 @@ void test_deck_compareCards()
     cut_assert_equal_int(2, deck_compareCards(card2, card1, DIAMONDS));
     cut_assert_equal_int(2, deck_compareCards(card2, card1, CLUBS));
 
-    card2->suit = CLUBS;
+    card2 = deck_createCard(CLUBS, VALUES[2]);
     cut_assert_equal_int(1, deck_compareCards(card1, card2, DIAMONDS));
     cut_assert_equal_int(1, deck_compareCards(card1, card2, SuitEnd));
     cut_assert_equal_int(1, deck_compareCards(card1, card2, SPADES));
     cut_assert_equal_int(2, deck_compareCards(card2, card1, DIAMONDS));
     cut_assert_equal_int(1, deck_compareCards(card2, card1, SuitEnd));
     cut_assert_equal_int(1, deck_compareCards(card2, card1, SPADES));
-
-    deck_deleteCard(&card1);
-    deck_deleteCard(&card2);
 }
-
@@ -2,6 +2,10 @@
 #include <errors.h>
 
 #include <cutter.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fixture.h"
 
 void test_game_createGame()
 {
@@ -32,7 +36,7 @@ void test_game_deleteGame()
 {
     struct Game *game = game_createGame(1);
     cut_assert_equal_int(POINTER_NULL, game_deleteGame(NULL));
-    cut_assert_equal_int(FUNCTIOON_NO_ERROR, game_deleteGame(&game));
+    cut_assert_equal_int(FUNCTION_NO_ERROR, game_deleteGame(&game));
     cut_assert_equal_int(GAME_NULL, game_deleteGame(&game));
     cut_assert_equal_pointer(NULL, game);
 }
@@ -41,20 +45,19 @@ void test_game_addDeck()
 {
     struct Game *game = game_createGame(1);
     struct Deck *deck = deck_createDeck(MIN_GAME_PLAYERS);
-    struct Deck *deck2 = deck;
+    struct Deck deck2 = *deck;
 
     cut_assert_equal_int(GAME_NULL, game_addDeck(NULL, &deck));
     cut_assert_equal_int(POINTER_NULL, game_addDeck(game, NULL));
-    cut_assert_equal_int(FUNCTIOON_NO_ERROR, game_addDeck(game, &deck));
-    cut_assert_equal_pointer(deck2, game->deck);
+    cut_assert_equal_int(FUNCTION_NO_ERROR, game_addDeck(game, &deck));
+    cut_assert_equal_int(0, memcmp(&deck2, game->deck, sizeof(struct Deck)));
     cut_assert_equal_pointer(NULL, deck);
     cut_assert_equal_int(DECK_NULL, game_addDeck(game, &deck));
 
-    deck2 = NULL;
     game_deleteGame(&game);
 }
 
-void *getName(int i, char name[4])
+void getName(int i, char name[4])
 {
     i++;
     int j = 0;
@@ -75,15 +78,18 @@ void test_game_addPlayer()
     for (int i = 0; i < MAX_GAME_PLAYERS; i++) {
         getName(i, name);
         player1 = player_createPlayer(name, 1);
-        player2 = player1;
-        cut_assert_equal_int(FUNCTIOON_NO_ERROR,
+        cut_assert_equal_int(FUNCTION_NO_ERROR,
                              game_addPlayer(game, &player1));
 
         int check = 0;
         for (int j = 0; j < MAX_GAME_PLAYERS; j++)
-            if (game->players[j] == player2)
+            if (game->players[j] != NULL &&
+                strcmp(game->players[j]->name, name) == 0) {
+                player2 = game->players[j];
                 check++;
+            }
         cut_assert_equal_int(1, check);
+        cut_assert_equal_int(i, player2->seat);
         cut_assert_equal_pointer(NULL, player1);
         cut_assert_equal_int(DUPLICATE_POINTER, game_addPlayer(game, &player2));
         player1 = player_createPlayer(name, 1);
@@ -96,7 +102,6 @@ void test_game_addPlayer()
     cut_assert_equal_int(FULL, game_addPlayer(game, &player1));
 
     player_deletePlayer(&player1);
-    player2 = NULL;
     game_deleteGame(&game);
 }
 
@@ -114,10 +119,11 @@ void test_game_addRound()
 
     for (int i = 0; i < MAX_GAME_ROUNDS; i++) {
         round1 = round_createRound(1);
-        round2 = round1;
-        cut_assert_equal_int(FUNCTIOON_NO_ERROR, game_addRound(game, &round1));
-        cut_assert_equal_int(DUPLICATE_POINTER, game_addRound(game, &round2));
+        cut_assert_equal_int(FUNCTION_NO_ERROR, game_addRound(game, &round1));
         cut_assert_equal_pointer(NULL, round1);
+        round2 = game->rounds[i];
+        cut_assert_equal_int(1, round2->roundType);
+        cut_assert_equal_int(DUPLICATE_POINTER, game_addRound(game, &round2));
         int check = 0;
         for (int j = 0; j < MAX_GAME_ROUNDS; j++)
             if (game->rounds[j] == round2)
@@ -129,7 +135,6 @@ void test_game_addRound()
     cut_assert_equal_int(FULL, game_addRound(game, &round1));
     
     round_deleteRound(&round1);
-    round2 = NULL;
     game_deleteGame(&game);
 }
 
@@ -156,7 +161,7 @@ void test_game_addPlayersInRound()
 
     for (int i = 0; i < MAX_GAME_PLAYERS; i++) {
         round = round_createRound(1);
-        cut_assert_equal_int(FUNCTIOON_NO_ERROR,
+        cut_assert_equal_int(FUNCTION_NO_ERROR,
                              game_addPlayersInRound(game, round, i));
         int position = 0;
         for (int j = i; j < MAX_GAME_PLAYERS; j++)
@@ -177,7 +182,7 @@ void test_game_createAndAddRounds()
     game->playersNumber = MIN_GAME_PLAYERS;
 
     cut_assert_equal_int(GAME_NULL, game_createAndAddRounds(NULL));
-    cut_assert_equal_int(FUNCTIOON_NO_ERROR, game_createAndAddRounds(game));
+    cut_assert_equal_int(FUNCTION_NO_ERROR, game_createAndAddRounds(game));
     
     int i;
     for (i = 0; i < MIN_GAME_PLAYERS; i++)
@@ -203,7 +208,7 @@ void test_game_createAndAddRounds()
     game_deleteGame(&game);
     game = game_createGame(8);
     game->playersNumber = MIN_GAME_PLAYERS;
-    cut_assert_equal_int(FUNCTIOON_NO_ERROR, game_createAndAddRounds(game));
+    cut_assert_equal_int(FUNCTION_NO_ERROR, game_createAndAddRounds(game));
 
     for (i = 0; i < MIN_GAME_PLAYERS; i++)
         cut_assert_equal_int(8, game->rounds[i]->roundType);
@@ -242,48 +247,323 @@ void test_game_rewardsPlayer()
     cut_assert_equal_int(ILLEGAL_VALUE,
                          game_rewardsPlayer(game, game->players[0],
                                             MAX_GAME_ROUNDS));
-    cut_assert_equal_int(FUNCTIOON_NO_ERROR,
+    cut_assert_equal_int(ROUND_NULL,
                          game_rewardsPlayer(game, game->players[0],
                                             BONUS_ROUNDS_NUMBER - 2));
 
     game->playersNumber = 3;
     game_createAndAddRounds(game);
-    for (int i = 0; i <= 7; i++) {
+    for (int i = 0; i < game_getRoundsNumber(game); i++) {
         round_addPlayer(game->rounds[i], game->players[0]);
         game->rounds[i]->bids[0] = 2;
         game->rounds[i]->handsNumber[0] = 2;
     }
 
-    cut_assert_equal_int(FUNCTIOON_NO_ERROR,
-                         game_rewardsPlayer(game, game->players[0], 4));
+    /* The rounds with one card don't count, the streak starts with the
+     * round 3. */
+    for (int i = 0; i < 7; i++)
+        cut_assert_equal_int(FUNCTION_NO_ERROR,
+                             game_rewardsPlayer(game, game->players[0], i));
     cut_assert_equal_int(1, game_rewardsPlayer(game, game->players[0], 7));
     cut_assert_equal_int(BONUS, game->rounds[7]->pointsNumber[0]);
     cut_assert_equal_int(1, game->rounds[7]->bonus[0]);
-    game->rounds[4]->bonus[0] = 1;
-    cut_assert_equal_int(FUNCTIOON_NO_ERROR,
-                         game_rewardsPlayer(game, game->players[0], 7));
-    game->rounds[4]->bonus[0] = 0;
-    game->rounds[4]->handsNumber[0]++;
-    cut_assert_equal_int(FUNCTIOON_NO_ERROR,
+    cut_assert_equal_int(FUNCTION_NO_ERROR,
                          game_rewardsPlayer(game, game->players[0], 7));
+    cut_assert_equal_int(BONUS, game->rounds[7]->pointsNumber[0]);
 
-    for (int i = 3; i <= 7; i++)
+    for (int i = 8; i <= 13; i++)
         game->rounds[i]->handsNumber[0]++;
 
-    cut_assert_equal_int(FUNCTIOON_NO_ERROR,
-                         game_rewardsPlayer(game, game->players[0], 4));
-    game->rounds[7]->bonus[0] = 0;
-    cut_assert_equal_int(2, game_rewardsPlayer(game, game->players[0], 7));
-    cut_assert_equal_int(0, game->rounds[7]->pointsNumber[0]);
-    cut_assert_equal_int(2, game->rounds[7]->bonus[0]);
-    game->rounds[4]->bonus[0] = 1;
-    cut_assert_equal_int(FUNCTIOON_NO_ERROR,
-                         game_rewardsPlayer(game, game->players[0], 7));
-    game->rounds[4]->bonus[0] = 0;
-    game->rounds[4]->handsNumber[0] -= 2;
-    cut_assert_equal_int(FUNCTIOON_NO_ERROR,
-                         game_rewardsPlayer(game, game->players[0], 7));
+    /* The streak of the won rounds is interrupted by the round 8. */
+    for (int i = 8; i < 12; i++)
+        cut_assert_equal_int(FUNCTION_NO_ERROR,
+                             game_rewardsPlayer(game, game->players[0], i));
+    cut_assert_equal_int(2, game_rewardsPlayer(game, game->players[0], 12));
+    cut_assert_equal_int(-BONUS, game->rounds[12]->pointsNumber[0]);
+    cut_assert_equal_int(2, game->rounds[12]->bonus[0]);
+
+    /* A rewarded round interrupts the streak. */
+    for (int i = 13; i <= 17; i++)
+        game->rounds[i]->handsNumber[0]++;
+    game->rounds[15]->bonus[0] = 1;
+    for (int i = 13; i <= 17; i++)
+        cut_assert_equal_int(FUNCTION_NO_ERROR,
+                             game_rewardsPlayer(game, game->players[0], i));
+
+    game_deleteGame(&game);
+}
+
+/**
+ * @brief Function creates a game of type 1 with 3 players in which the first
+ *        player makes his bid of 2 in every round.
+ */
+static struct Game *createRewardGame()
+{
+    struct Game *game = game_createGame(1);
+    struct Player *player = player_createPlayer("A", 1);
+    game_addPlayer(game, &player);
+
+    game->playersNumber = 3;
+    game_createAndAddRounds(game);
+    for (int i = 0; i < game_getRoundsNumber(game); i++) {
+        round_addPlayer(game->rounds[i], game->players[0]);
+        game->rounds[i]->bids[0] = 2;
+        game->rounds[i]->handsNumber[0] = 2;
+    }
+
+    return game;
+}
+
+void test_game_checkIfPlayerIsAtReward()
+{
+    struct Game *game = createRewardGame();
+    struct Player *player = game->players[0];
+    struct Player *stranger = player_createPlayer("B", 1);
+
+    cut_assert_equal_int(GAME_NULL,
+                         game_checkIfPlayerIsAtReward(NULL, 0, player));
+    cut_assert_equal_int(PLAYER_NULL,
+                         game_checkIfPlayerIsAtReward(game, 0, NULL));
+    cut_assert_equal_int(ILLEGAL_VALUE,
+                         game_checkIfPlayerIsAtReward(game, -1, player));
+    cut_assert_equal_int(ILLEGAL_VALUE,
+                         game_checkIfPlayerIsAtReward(game, MAX_GAME_ROUNDS,
+                                                      player));
+    cut_assert_equal_int(NOT_FOUND,
+                         game_checkIfPlayerIsAtReward(game, 0, stranger));
+
+    /* The rounds 3 - 6 are won one after another, so the round 7 can give
+     * the bonus. The reward resets the streak. */
+    for (int i = 0; i < 7; i++) {
+        cut_assert_equal_int(FUNCTION_NO_ERROR,
+                             game_checkIfPlayerIsAtReward(game, i, player));
+        game_rewardsPlayer(game, player, i);
+    }
+    cut_assert_equal_int(1, game_checkIfPlayerIsAtReward(game, 7, player));
+    cut_assert_equal_int(1, game_rewardsPlayer(game, player, 7));
+    cut_assert_equal_int(FUNCTION_NO_ERROR,
+                         game_checkIfPlayerIsAtReward(game, 8, player));
+
+    /* The rounds 8 - 11 are lost, so the round 12 can give the penalty, but
+     * not if the round 12 is skipped. */
+    for (int i = 8; i < 12; i++) {
+        game->rounds[i]->handsNumber[0] = 0;
+        game_rewardsPlayer(game, player, i);
+    }
+    cut_assert_equal_int(2, game_checkIfPlayerIsAtReward(game, 12, player));
+    cut_assert_equal_int(FUNCTION_NO_ERROR,
+                         game_checkIfPlayerIsAtReward(game, 13, player));
+
+    /* The rounds already counted can't be checked anymore. */
+    cut_assert_equal_int(ILLEGAL_VALUE,
+                         game_checkIfPlayerIsAtReward(game, 11, player));
+    cut_assert_equal_int(ILLEGAL_VALUE,
+                         game_checkIfPlayerIsAtReward(game, 5, player));
+
+    /* A won round breaks the streak of the lost rounds. */
+    game->rounds[12]->handsNumber[0] = 2;
+    game_rewardsPlayer(game, player, 12);
+    for (int i = 13; i < 16; i++) {
+        game->rounds[i]->handsNumber[0] = 0;
+        game_rewardsPlayer(game, player, i);
+    }
+    cut_assert_equal_int(FUNCTION_NO_ERROR,
+                         game_checkIfPlayerIsAtReward(game, 16, player));
+
+    player_deletePlayer(&stranger);
+    game_deleteGame(&game);
+}
+
+void test_game_rewardsPlayerOutOfOrder()
+{
+    struct Game *game = createRewardGame();
+    struct Player *player = game->players[0];
+
+    /* A skipped round breaks the streak: after the rounds 3 - 6 the round 8
+     * starts a new streak, which gives the bonus at the round 12. */
+    for (int i = 0; i < 7; i++)
+        game_rewardsPlayer(game, player, i);
+    for (int i = 8; i < 12; i++)
+        cut_assert_equal_int(FUNCTION_NO_ERROR,
+                             game_rewardsPlayer(game, player, i));
+    cut_assert_equal_int(1, game_checkIfPlayerIsAtReward(game, 12, player));
+    cut_assert_equal_int(1, game_rewardsPlayer(game, player, 12));
+
+    /* The rounds already counted are left as they are. */
+    for (int i = 0; i <= 12; i++) {
+        int points = game->rounds[i]->pointsNumber[0];
+        cut_assert_equal_int(FUNCTION_NO_ERROR,
+                             game_rewardsPlayer(game, player, i));
+        cut_assert_equal_int(points, game->rounds[i]->pointsNumber[0]);
+    }
+    cut_assert_equal_int(0, game->rounds[7]->bonus[0]);
+    cut_assert_equal_int(FUNCTION_NO_ERROR,
+                         game_checkIfPlayerIsAtReward(game, 13, player));
+
+    game_deleteGame(&game);
+}
+
+/**
+ * @brief Function creates a game of 4 players stopped in the middle of a hand
+ *        of its first round.
+ */
+static struct Game *createPlayedGame()
+{
+    struct Game *game = game_createGame(8);
+    const char *names[] = { "Alice", "Bob", "Carol", "David" };
+    for (int i = 0; i < 4; i++) {
+        struct Player *player = player_createPlayer(names[i], i == 0);
+        game_addPlayer(game, &player);
+    }
+    game_setSeed(game, 1);
+    game_createAndAddRounds(game);
+    game_addPlayersInAllRounds(game);
+
+    game->currentRound = 0;
+    game_initializeDeck(game);
+    game_shuffleDeck(game);
+    struct Round *round = game->rounds[0];
+    round_distributeDeck(round, game->deck);
+
+    struct Random random;
+    random_setSeed(&random, 2);
+    for (int i = 0; i < round->playersNumber + 6; i++)
+        fixture_applyRandomMove(round, &random);
+    cut_assert_not_null(round->hand);
+    cut_assert_equal_int(2, round->hand->cardsNumber);
+
+    return game;
+}
+
+/**
+ * @brief Function checks that all the pointers of a game point in its arena.
+ */
+static void checkGameInArena(const struct Game *game)
+{
+    const struct Arena *arena = game->arena;
+    cut_assert_true(arena_contains(arena, game));
+    cut_assert_true(arena_contains(arena, game->deck));
+
+    for (int i = 0; i < MAX_GAME_PLAYERS; i++)
+        if (game->players[i] != NULL)
+            cut_assert_true(arena_contains(arena, game->players[i]));
+
+    for (int i = 0; i < MAX_GAME_ROUNDS; i++) {
+        const struct Round *round = game->rounds[i];
+        if (round == NULL)
+            continue;
+        cut_assert_true(arena_contains(arena, round));
+        if (round->hand != NULL)
+            cut_assert_equal_pointer(&(round->currentHand), round->hand);
+        for (int j = 0; j < MAX_GAME_PLAYERS; j++) {
+            if (round->players[j] != NULL)
+                cut_assert_true(arena_contains(arena, round->players[j]));
+            if (round->currentHand.players[j] != NULL)
+                cut_assert_true(arena_contains(arena,
+                                               round->currentHand.players[j]));
+        }
+    }
+}
+
+/**
+ * @brief Function checks that two games have the same players and rounds.
+ */
+static void checkSameGame(const struct Game *game1, const struct Game *game2)
+{
+    cut_assert_equal_int(game1->playersNumber, game2->playersNumber);
+    cut_assert_equal_int(game1->currentRound, game2->currentRound);
+    cut_assert_equal_memory(game1->deck, sizeof(struct Deck), game2->deck,
+                            sizeof(struct Deck));
 
+    for (int i = 0; i < MAX_GAME_PLAYERS; i++)
+        if (game1->players[i] != NULL)
+            cut_assert_equal_memory(game1->players[i], sizeof(struct Player),
+                                    game2->players[i], sizeof(struct Player));
+
+    for (int i = 0; i < game_getRoundsNumber(game1); i++) {
+        const struct Round *round1 = game1->rounds[i];
+        const struct Round *round2 = game2->rounds[i];
+        cut_assert_equal_int(round1->roundType, round2->roundType);
+        cut_assert_equal_int(round1->bidsNumber, round2->bidsNumber);
+        cut_assert_true(round1->key == round2->key);
+        cut_assert_equal_memory(round1->bids, sizeof(round1->bids),
+                                round2->bids, sizeof(round2->bids));
+        cut_assert_equal_int(round1->hand == NULL, round2->hand == NULL);
+        for (int j = 0; j < MAX_GAME_PLAYERS; j++) {
+            cut_assert_equal_int(game_getPlayerPosition(game1,
+                                                        round1->players[j]),
+                                 game_getPlayerPosition(game2,
+                                                        round2->players[j]));
+            cut_assert_equal_int(round1->currentHand.cards[j].id,
+                                 round2->currentHand.cards[j].id);
+        }
+    }
+}
+
+void test_game_cloneGame()
+{
+    cut_assert_equal_pointer(NULL, game_cloneGame(NULL));
+
+    struct Game *game = createPlayedGame();
+    size_t used = game->arena->used;
+    unsigned char *memory = malloc(used);
+    memcpy(memory, game->arena->memory, used);
+
+    struct Game *clone = game_cloneGame(game);
+    cut_assert_not_null(clone);
+    cut_assert_true(clone->arena != game->arena);
+    checkGameInArena(clone);
+    checkSameGame(game, clone);
+
+    /* The moves made in the clone don't reach the game. */
+    struct Random random;
+    random_setSeed(&random, 3);
+    struct Round *round = clone->rounds[0];
+    while (fixture_applyRandomMove(round, &random));
+    strcpy(clone->players[1]->name, "Eve");
+    clone->deck->cards[0] = EMPTY_CARD;
+    cut_assert_equal_int(used, game->arena->used);
+    cut_assert_equal_memory(memory, used, game->arena->memory, used);
+
+    game_deleteGame(&clone);
+    free(memory);
     game_deleteGame(&game);
 }
 
+void test_game_copyGame()
+{
+    struct Game *game = createPlayedGame();
+    struct Game *destination = game_createGame(1);
+    struct Game *address = destination;
+
+    cut_assert_equal_int(GAME_NULL, game_copyGame(NULL, game));
+    cut_assert_equal_int(GAME_NULL, game_copyGame(destination, NULL));
+    cut_assert_equal_int(FUNCTION_NO_ERROR, game_copyGame(game, game));
+
+    cut_assert_equal_int(FUNCTION_NO_ERROR, game_copyGame(destination, game));
+    cut_assert_equal_pointer(address, destination);
+    checkGameInArena(destination);
+    checkSameGame(game, destination);
+
+    /* An arena too small for the game is left as it was. */
+    struct Game *small = game_createGame(1);
+    struct Arena *arena = small->arena;
+    size_t size = arena->size;
+    arena->size = game->arena->used - 1;
+    unsigned char *memory = malloc(arena->used);
+    memcpy(memory, arena->memory, arena->used);
+    size_t used = arena->used;
+
+    cut_assert_equal_int(FULL, game_copyGame(small, game));
+    cut_assert_equal_int(used, arena->used);
+    cut_assert_equal_memory(memory, used, arena->memory, arena->used);
+    cut_assert_equal_int(1, small->gameType);
+    cut_assert_equal_int(0, small->playersNumber);
+    cut_assert_equal_pointer(arena, small->arena);
+
+    arena->size = size;
+    free(memory);
+    game_deleteGame(&small);
+    game_deleteGame(&destination);
+    game_deleteGame(&game);
+}
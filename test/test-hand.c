@@ -1,5 +1,6 @@
 #include <hand.h>
 #include <errors.h>
+#include <random.h>
 
 #include <cutter.h>
 
@@ -12,7 +13,7 @@ void test_hand_createHand()
     cut_assert_equal_int(1, check);
 
     for (int i = 0; i < MAX_GAME_PLAYERS; i++) {
-        cut_assert_equal_pointer(NULL, hand->cards[i]);
+        cut_assert_equal_int(0, deck_isCard(hand->cards[i]));
         cut_assert_equal_pointer(NULL, hand->players[i]);
     }
 
@@ -22,7 +23,7 @@ void test_hand_createHand()
 void test_hand_deleteHand()
 {
     struct Hand *hand = hand_createHand();
-    cut_assert_equal_int(FUNCTIOON_NO_ERROR, hand_deleteHand(&hand));
+    cut_assert_equal_int(FUNCTION_NO_ERROR, hand_deleteHand(&hand));
     cut_assert_equal_pointer(NULL, hand);
     cut_assert_equal_int(HAND_NULL, hand_deleteHand(&hand));
     cut_assert_equal_int(POINTER_NULL, hand_deleteHand(NULL));
@@ -40,7 +41,7 @@ void test_hand_addPlayer()
 
     for (int i = 1; i <= MAX_GAME_PLAYERS; i++) {
         players[i] = player_createPlayer("A", i);
-        cut_assert_equal_int(FUNCTIOON_NO_ERROR,
+        cut_assert_equal_int(FUNCTION_NO_ERROR,
                              hand_addPlayer(hand, players[i]));
         cut_assert_equal_int(DUPLICATE_POINTER,
                              hand_addPlayer(hand, players[i]));
@@ -66,21 +67,19 @@ void test_hand_addCard()
     for (int i = 0; i < MAX_GAME_PLAYERS; i++) {
         players[i] = player_createPlayer("A", i);
         hand_addPlayer(hand, players[i]);
-        struct Card *card  = deck->cards[i];
-        struct Card *card2 = deck->cards[i];
-        cut_assert_equal_int(FUNCTIOON_NO_ERROR, 
-                            hand_addCard(hand, players[i], &(deck->cards[i])));
-        cut_assert_equal_pointer(NULL, deck->cards[i]);
+        struct Card card = deck->cards[i];
+        cut_assert_equal_int(FUNCTION_NO_ERROR,
+                             hand_addCard(hand, players[i], deck->cards[i]));
         int check = 0;
         for (int j = 0; j < MAX_GAME_PLAYERS; j++)
-            if (players[i] == hand->players[j] && card == hand->cards[j])
+            if (players[i] == hand->players[j] && card.id == hand->cards[j].id)
                 check++;
         cut_assert_equal_int(1, check);
     }
     players[MAX_GAME_PLAYERS] = player_createPlayer("A", 1);
     cut_assert_equal_int(NOT_FOUND,
                          hand_addCard(hand, players[MAX_GAME_PLAYERS],
-                                      &deck->cards[MAX_GAME_PLAYERS]));
+                                      deck->cards[MAX_GAME_PLAYERS]));
 
     for (int i = 0; i <= MAX_GAME_PLAYERS; i++)
         player_deletePlayer(&players[i]);
@@ -92,7 +91,7 @@ void test_hand_checkCard()
 {
     struct Hand *hand = hand_createHand();
     struct Player *players[3];
-    struct Card *card;
+    struct Card card;
 
     for (int i = 0; i < 3; i++) {
         players[i] = player_createPlayer("A", i);
@@ -102,40 +101,120 @@ void test_hand_checkCard()
     for (int i = 0; i != SuitEnd; i++ )
         for (int j = 0; j < 6; j++) {
             card = deck_createCard(i, VALUES[j]);
-            player_addCard(players[j % 3], &card);
+            player_addCard(players[j % 3], card);
         }
 
-    cut_assert_equal_int(1, hand_checkCard(hand, players[0], 0, NULL));
-    cut_assert_equal_int(1, hand_checkCard(hand, players[0], 2, NULL));
-    cut_assert_equal_int(1, hand_checkCard(hand, players[0], 4, NULL));
-    cut_assert_equal_int(1, hand_checkCard(hand, players[0], 6, NULL));
-    hand_addCard(hand, players[0], &players[0]->hand[0]); 
-    cut_assert_equal_int(0, hand_checkCard(hand, players[1], 2, NULL));
-    cut_assert_equal_int(1, hand_checkCard(hand, players[1], 0, NULL));
-    deck_deleteCard(&(players[1]->hand[0]));
-    deck_deleteCard(&(players[1]->hand[1]));
-    cut_assert_equal_int(1, hand_checkCard(hand, players[1], 2, NULL));
-    hand_addCard(hand, players[1], &players[1]->hand[2]);
+    cut_assert_equal_int(1, hand_checkCard(hand, players[0], 0, EMPTY_CARD));
+    cut_assert_equal_int(1, hand_checkCard(hand, players[0], 2, EMPTY_CARD));
+    cut_assert_equal_int(1, hand_checkCard(hand, players[0], 4, EMPTY_CARD));
+    cut_assert_equal_int(1, hand_checkCard(hand, players[0], 6, EMPTY_CARD));
+    hand_addCard(hand, players[0], players[0]->hand[0]);
+    cut_assert_equal_int(0, hand_checkCard(hand, players[1], 2, EMPTY_CARD));
+    cut_assert_equal_int(1, hand_checkCard(hand, players[1], 0, EMPTY_CARD));
+    player_removeCard(players[1], 0);
+    player_removeCard(players[1], 1);
+    cut_assert_equal_int(1, hand_checkCard(hand, players[1], 2, EMPTY_CARD));
+    hand_addCard(hand, players[1], players[1]->hand[2]);
     card = deck_createCard(CLUBS, VALUES[6]);
     cut_assert_equal_int(0, hand_checkCard(hand, players[2], 2, card));
     cut_assert_equal_int(0, hand_checkCard(hand, players[2], 4, card));
     cut_assert_equal_int(1, hand_checkCard(hand, players[2], 0, card));
     cut_assert_equal_int(1, hand_checkCard(hand, players[2], 1, card));
-    deck_deleteCard(&(players[2]->hand[0]));
-    deck_deleteCard(&(players[2]->hand[1]));
+    player_removeCard(players[2], 0);
+    player_removeCard(players[2], 1);
     cut_assert_equal_int(1, hand_checkCard(hand, players[2], 2, card));
     cut_assert_equal_int(0, hand_checkCard(hand, players[2], 4, card));
-    deck_deleteCard(&(players[2]->hand[2]));
-    deck_deleteCard(&(players[2]->hand[3]));
+    player_removeCard(players[2], 2);
+    player_removeCard(players[2], 3);
     cut_assert_equal_int(1, hand_checkCard(hand, players[2], 4, card));
     cut_assert_equal_int(1, hand_checkCard(hand, players[2], 6, card));
 
-    deck_deleteCard(&card);
-    hand_deleteHand(&hand);     
-    for (int i = 0; i < 3; i++) {
-        for (int j = 0; j < MAX_CARDS; j++)
-            deck_deleteCard(&players[i]->hand[j]);
+    hand_deleteHand(&hand);
+    for (int i = 0; i < 3; i++)
         player_deletePlayer(&players[i]);
-    }
 }
 
+
+/**
+ * @brief Function determines the winner of a full hand comparing its cards in
+ *        the order of the players.
+ */
+static int getWinnerId(const struct Hand *hand)
+{
+    int winnerId = 0;
+    for (int i = 1; i < hand->playersNumber; i++)
+        if (deck_compareCards(hand->cards[winnerId], hand->cards[i],
+                              hand->trump) == 2)
+            winnerId = i;
+
+    return winnerId;
+}
+
+void test_hand_getWinnerId()
+{
+    struct Random random;
+    struct Player players[MAX_GAME_PLAYERS];
+    struct Hand hand;
+
+    random_setSeed(&random, 1);
+    cut_assert_equal_int(HAND_NULL, hand_getWinnerId(NULL));
+
+    for (int test = 0; test < 10000; test++) {
+        int playersNumber = MIN_GAME_PLAYERS + random_getBoundedNumber(
+                            &random, MAX_GAME_PLAYERS - MIN_GAME_PLAYERS + 1);
+        hand_initializeHand(&hand);
+        cut_assert_equal_int(NOT_FOUND, hand_getWinnerId(&hand));
+
+        int first = random_getBoundedNumber(&random, playersNumber);
+        for (int i = 0; i < playersNumber; i++) {
+            player_initializePlayer(&players[i], "A", 0);
+            players[i].seat = i;
+        }
+        for (int i = 0; i < playersNumber; i++)
+            hand_addPlayer(&hand, &players[(first + i) % playersNumber]);
+
+        struct Card trump = EMPTY_CARD;
+        if (random_getBoundedNumber(&random, 5) != 0)
+            trump.id = random_getBoundedNumber(&random, DECK_SIZE);
+        hand_setTrump(&hand, trump);
+
+        /* The cards are put down in the order of the players or, to check
+         * the cases in which the winner is determined again, in a random
+         * order. */
+        int order[MAX_GAME_PLAYERS];
+        for (int i = 0; i < playersNumber; i++)
+            order[i] = i;
+        if (random_getBoundedNumber(&random, 2) != 0)
+            for (int i = playersNumber - 1; i > 0; i--) {
+                int j = random_getBoundedNumber(&random, i + 1);
+                int aux = order[i];
+                order[i] = order[j];
+                order[j] = aux;
+            }
+
+        int used[DECK_SIZE] = {0};
+        for (int i = 0; i < playersNumber; i++) {
+            struct Card card;
+            do {
+                card.id = random_getBoundedNumber(&random, DECK_SIZE);
+            } while (used[card.id]);
+            used[card.id] = 1;
+            cut_assert_equal_int(FUNCTION_NO_ERROR,
+                                 hand_addCard(&hand, hand.players[order[i]],
+                                              card));
+            cut_assert_equal_int(i + 1, hand.cardsNumber);
+        }
+
+        cut_assert_equal_int(getWinnerId(&hand), hand_getWinnerId(&hand));
+        cut_assert_equal_int(hand.cards[hand.winnerId].id,
+                             hand.winningCard.id);
+
+        int removed = random_getBoundedNumber(&random, playersNumber);
+        struct Card card = hand.cards[removed];
+        cut_assert_equal_int(FUNCTION_NO_ERROR,
+                             hand_removeCard(&hand, hand.players[removed]));
+        cut_assert_equal_int(playersNumber - 1, hand.cardsNumber);
+        hand_addCard(&hand, hand.players[removed], card);
+        cut_assert_equal_int(getWinnerId(&hand), hand_getWinnerId(&hand));
+    }
+}
@@ -0,0 +1,214 @@
+#include <ismcts.h>
+#include <round.h>
+#include <random.h>
+#include <errors.h>
+#include <constants.h>
+
+#include <cutter.h>
+
+#include "fixture.h"
+
+/**
+ * @brief The time given to the robot for a move, in milliseconds.
+ */
+#define ISMCTS_TEST_MILLISECONDS 5
+
+/**
+ * @brief The time given to the robot when the search is stopped by
+ *        Ismcts::playoutsLimit, in milliseconds.
+ */
+#define ISMCTS_TEST_NO_DEADLINE 60000
+
+/**
+ * @brief Function plays a round with the ISMCTS robot for all the players,
+ *        the bids and the cards, and checks that every move is legal.
+ */
+static void playRound(struct Ismcts *ismcts, struct Round *round,
+                      int milliseconds)
+{
+    while (round->bidsNumber < round->playersNumber) {
+        struct Player *player = fixture_getPlayerToMove(round);
+        int bid = ismcts_getBid(ismcts, player, round, milliseconds);
+        cut_assert_equal_int(FUNCTION_NO_ERROR,
+                             round_checkBid(round, player, bid));
+        cut_assert_equal_int(FUNCTION_NO_ERROR,
+                             round_applyMove(round, player, BID_MOVE, bid));
+    }
+
+    round_initializeHand(round);
+    round_addPlayersInHand(round, 0);
+
+    struct Player *player = fixture_getPlayerToMove(round);
+    int cards = fixture_getLegalCards(round, player);
+    while (cards != 0) {
+        int cardId = ismcts_getCardId(ismcts, player, round, milliseconds);
+        cut_assert_operator_int(cardId, >=, 0);
+        cut_assert_operator_int(cardId, <, MAX_CARDS);
+        cut_assert_true((cards >> cardId) & 1);
+        cut_assert_equal_int(FUNCTION_NO_ERROR,
+                             round_applyMove(round, player, CARD_MOVE,
+                                             cardId));
+
+        player = fixture_getPlayerToMove(round);
+        cards = fixture_getLegalCards(round, player);
+    }
+}
+
+void test_ismcts_getBid()
+{
+    struct Ismcts *ismcts = ismcts_createIsmcts(1, ISMCTS_ROOT_PARALLEL, 1);
+    struct Random random;
+    random_setSeed(&random, 1);
+
+    cut_assert_not_null(ismcts);
+    cut_assert_equal_pointer(NULL, ismcts_createIsmcts(-1,
+                                       ISMCTS_ROOT_PARALLEL, 1));
+    cut_assert_equal_pointer(NULL, ismcts_createIsmcts(1, IsmctsModeEnd, 1));
+
+    struct Round *round = fixture_createDealtRound(MAX_CARDS,
+                                                   MIN_GAME_PLAYERS, &random);
+    struct Player *player = fixture_getPlayerToMove(round);
+
+    cut_assert_equal_int(POINTER_NULL, ismcts_getBid(NULL, player, round, 1));
+    cut_assert_equal_int(PLAYER_NULL, ismcts_getBid(ismcts, NULL, round, 1));
+    cut_assert_equal_int(ROUND_NULL, ismcts_getBid(ismcts, player, NULL, 1));
+    cut_assert_equal_int(ILLEGAL_VALUE,
+                         ismcts_getBid(ismcts, player, round, -1));
+
+    /* The bids can't be placed once the cards are put down. */
+    round_initializeHand(round);
+    cut_assert_equal_int(ILLEGAL_VALUE,
+                         ismcts_getBid(ismcts, player, round, 1));
+
+    fixture_deleteDealtRound(&round);
+    ismcts_deleteIsmcts(&ismcts);
+}
+
+void test_ismcts_getCardId()
+{
+    struct Ismcts *ismcts = ismcts_createIsmcts(1, ISMCTS_ROOT_PARALLEL, 2);
+    struct Random random;
+    random_setSeed(&random, 2);
+
+    struct Round *round = fixture_createDealtRound(MAX_CARDS,
+                                                   MIN_GAME_PLAYERS, &random);
+    fixture_placeRandomBids(round, &random);
+    struct Player *player = fixture_getPlayerToMove(round);
+
+    cut_assert_equal_int(HAND_NULL, ismcts_getCardId(ismcts, player, round,
+                                                     1));
+    round_initializeHand(round);
+    round_addPlayersInHand(round, 0);
+    cut_assert_equal_int(POINTER_NULL,
+                         ismcts_getCardId(NULL, player, round, 1));
+    cut_assert_equal_int(PLAYER_NULL,
+                         ismcts_getCardId(ismcts, NULL, round, 1));
+    cut_assert_equal_int(ROUND_NULL,
+                         ismcts_getCardId(ismcts, player, NULL, 1));
+    cut_assert_equal_int(ILLEGAL_VALUE,
+                         ismcts_getCardId(ismcts, player, round, -1));
+
+    fixture_deleteDealtRound(&round);
+    ismcts_deleteIsmcts(&ismcts);
+}
+
+void test_ismcts_legalMoves()
+{
+    struct Random random;
+    random_setSeed(&random, 3);
+
+    for (int mode = ISMCTS_ROOT_PARALLEL; mode < IsmctsModeEnd; mode++) {
+        struct Ismcts *ismcts = ismcts_createIsmcts(2, mode, mode);
+        cut_assert_not_null(ismcts);
+
+        for (int playersNumber = MIN_GAME_PLAYERS;
+             playersNumber <= MAX_GAME_PLAYERS; playersNumber++) {
+            int roundType = playersNumber % 2 == 0 ? MAX_CARDS : MIN_CARDS;
+            struct Round *round = fixture_createDealtRound(roundType,
+                                                           playersNumber,
+                                                           &random);
+            playRound(ismcts, round, ISMCTS_TEST_MILLISECONDS);
+            fixture_deleteDealtRound(&round);
+        }
+
+        cut_assert_operator_int(ismcts->decisionsNumber, >, 0);
+        cut_assert_operator_int(ismcts->playoutsNumber, >, 0);
+
+        ismcts_deleteIsmcts(&ismcts);
+    }
+}
+
+void test_ismcts_sameSeed()
+{
+    for (int mode = ISMCTS_ROOT_PARALLEL; mode < IsmctsModeEnd; mode++) {
+        struct Ismcts *ismcts[2];
+        struct Round *rounds[2];
+
+        /* With a single thread and without deadline the same seed makes the
+         * same moves. */
+        for (int i = 0; i < 2; i++) {
+            struct Random random;
+            random_setSeed(&random, 4);
+            rounds[i] = fixture_createDealtRound(MAX_CARDS, 4, &random);
+
+            ismcts[i] = ismcts_createIsmcts(1, mode, 5);
+            ismcts[i]->playoutsLimit = 300;
+            playRound(ismcts[i], rounds[i], ISMCTS_TEST_NO_DEADLINE);
+        }
+
+        cut_assert_equal_int(rounds[0]->movesNumber, rounds[1]->movesNumber);
+        for (int i = 0; i < rounds[0]->movesNumber; i++) {
+            cut_assert_equal_int(rounds[0]->moves[i].type,
+                                 rounds[1]->moves[i].type);
+            cut_assert_equal_int(rounds[0]->moves[i].value,
+                                 rounds[1]->moves[i].value);
+        }
+        cut_assert_equal_int(ismcts[0]->playoutsNumber,
+                             ismcts[1]->playoutsNumber);
+        cut_assert_equal_int(ismcts[0]->decisionsNumber * 300,
+                             ismcts[0]->playoutsNumber);
+
+        for (int i = 0; i < 2; i++) {
+            fixture_deleteDealtRound(&rounds[i]);
+            ismcts_deleteIsmcts(&ismcts[i]);
+        }
+    }
+}
+
+void test_ismcts_nodesExhausted()
+{
+    struct Random random;
+    random_setSeed(&random, 6);
+
+    /* When all the nodes are used the tree isn't expanded anymore, but the
+     * playouts go on and a legal move is still chosen. */
+    for (int mode = ISMCTS_ROOT_PARALLEL; mode < IsmctsModeEnd; mode++) {
+        struct Ismcts *ismcts = ismcts_createIsmcts(2, mode, 7);
+        int treesNumber = 2;
+        int size = ISMCTS_NODES_NUMBER;
+        if (mode == ISMCTS_TREE_PARALLEL) {
+            treesNumber = 1;
+            size = ISMCTS_NODES_NUMBER * 2;
+        }
+        cut_assert_equal_int(size, ismcts->trees[0].size);
+        for (int i = 0; i < treesNumber; i++)
+            ismcts->trees[i].size = 16;
+        ismcts->playoutsLimit = 400;
+
+        struct Round *round = fixture_createDealtRound(MAX_CARDS, 5, &random);
+        struct Player *player = fixture_getPlayerToMove(round);
+        int bid = ismcts_getBid(ismcts, player, round,
+                                ISMCTS_TEST_NO_DEADLINE);
+        cut_assert_equal_int(FUNCTION_NO_ERROR,
+                             round_checkBid(round, player, bid));
+        for (int i = 0; i < treesNumber; i++)
+            cut_assert_equal_int(16, ismcts->trees[i].nodesNumber);
+
+        playRound(ismcts, round, ISMCTS_TEST_NO_DEADLINE);
+        cut_assert_equal_int(ismcts->decisionsNumber * 400,
+                             ismcts->playoutsNumber);
+
+        fixture_deleteDealtRound(&round);
+        ismcts_deleteIsmcts(&ismcts);
+    }
+}
@@ -0,0 +1,168 @@
+#include <isomorphism.h>
+#include <random.h>
+#include <errors.h>
+
+#include <cutter.h>
+
+/**
+ * @brief Function deals the cards of a deck at random in the bitboards
+ *        from firstSet to setsNumber, some cards being left out.
+ */
+static void dealRandomSets(uint64_t *sets, int firstSet, int setsNumber,
+                           struct Random *random)
+{
+    for (int i = 0; i < setsNumber; i++)
+        sets[i] = 0;
+    for (int card = 0; card < DECK_SIZE; card++) {
+        int set = firstSet + random_getBoundedNumber(random,
+                                                     setsNumber - firstSet + 1);
+        if (set < setsNumber)
+            sets[set] |= UINT64_C(1) << card;
+    }
+}
+
+/**
+ * @brief Function gets the cards of a suit from a bitboard.
+ */
+static uint64_t getSuitCards(uint64_t cards, int suit)
+{
+    return (cards >> (suit * RANKS_NUMBER)) & BITBOARD_SUIT_MASK;
+}
+
+/**
+ * @brief Function compares the cards of two suits in some bitboards, the
+ *        first bitboard being the most significant.
+ */
+static int compareSuits(const uint64_t *sets, int setsNumber, int suit1,
+                        int suit2)
+{
+    for (int i = 0; i < setsNumber; i++) {
+        uint64_t cards1 = getSuitCards(sets[i], suit1);
+        uint64_t cards2 = getSuitCards(sets[i], suit2);
+        if (cards1 != cards2)
+            return cards1 < cards2 ? -1 : 1;
+    }
+
+    return 0;
+}
+
+void test_isomorphism_canonicalize()
+{
+    struct Random random;
+    struct SuitPermutation permutation;
+    uint64_t sets[ISOMORPHISM_MAX_SETS];
+    random_setSeed(&random, 1);
+
+    cut_assert_equal_int(POINTER_NULL,
+                         isomorphism_canonicalize(NULL, 1, SuitEnd, NULL));
+    cut_assert_equal_int(ILLEGAL_VALUE,
+                         isomorphism_canonicalize(sets, 0, SuitEnd, NULL));
+    cut_assert_equal_int(ILLEGAL_VALUE,
+                         isomorphism_canonicalize(sets,
+                                                  ISOMORPHISM_MAX_SETS + 1,
+                                                  SuitEnd, NULL));
+
+    for (int setsNumber = 1; setsNumber <= ISOMORPHISM_MAX_SETS; setsNumber++)
+        for (int trump = DIAMONDS; trump <= SuitEnd; trump++)
+            for (int test = 0; test < 50; test++) {
+                uint64_t canonical[ISOMORPHISM_MAX_SETS];
+                /* Half of the deals leave the first bitboards empty, so
+                 * the ties are broken by the last bitboard. */
+                dealRandomSets(sets, test % 2 ? setsNumber - 1 : 0,
+                               setsNumber, &random);
+                for (int i = 0; i < setsNumber; i++)
+                    canonical[i] = sets[i];
+                cut_assert_equal_int(FUNCTION_NO_ERROR,
+                                     isomorphism_canonicalize(canonical,
+                                                              setsNumber,
+                                                              trump,
+                                                              &permutation));
+
+                /* The canonical form is the permuted bitboards, with the
+                 * trump last and the other suits in ascending order. */
+                int suitsNumber = trump == SuitEnd ? SuitEnd : SuitEnd - 1;
+                for (int i = 0; i < setsNumber; i++) {
+                    cut_assert_true(canonical[i] ==
+                                    isomorphism_permuteCards(sets[i],
+                                                             &permutation));
+                    if (trump != SuitEnd)
+                        cut_assert_true(getSuitCards(sets[i], trump) ==
+                                        getSuitCards(canonical[i],
+                                                     SuitEnd - 1));
+                }
+                for (int suit = 1; suit < suitsNumber; suit++)
+                    cut_assert_operator_int(compareSuits(canonical,
+                                                         setsNumber,
+                                                         suit - 1, suit),
+                                            <=, 0);
+
+                /* The canonical form doesn't change when the suits other
+                 * than the trump are permuted. */
+                struct SuitPermutation other;
+                for (int i = 0; i < SuitEnd; i++)
+                    other.suits[i] = i;
+                for (int i = SuitEnd - 1; i > 0; i--) {
+                    int j = random_getBoundedNumber(&random, i + 1);
+                    if (i == trump || j == trump)
+                        continue;
+                    enum Suit suit = other.suits[i];
+                    other.suits[i] = other.suits[j];
+                    other.suits[j] = suit;
+                }
+
+                uint64_t permuted[ISOMORPHISM_MAX_SETS];
+                for (int i = 0; i < setsNumber; i++)
+                    permuted[i] = isomorphism_permuteCards(sets[i], &other);
+                isomorphism_canonicalize(permuted, setsNumber, trump, NULL);
+                for (int i = 0; i < setsNumber; i++)
+                    cut_assert_true(canonical[i] == permuted[i]);
+
+                /* Both ways of determining the permutation agree. */
+                struct SuitPermutation wide;
+                cut_assert_equal_int(FUNCTION_NO_ERROR,
+                                     isomorphism_getWidePermutation(
+                                         sets, setsNumber, trump, &wide));
+                for (int i = 0; i < setsNumber; i++)
+                    cut_assert_true(canonical[i] ==
+                                    isomorphism_permuteCards(sets[i], &wide));
+            }
+}
+
+void test_isomorphism_invertPermutation()
+{
+    struct Random random;
+    struct SuitPermutation permutation;
+    struct SuitPermutation inverse;
+    uint64_t sets[MAX_GAME_PLAYERS];
+    random_setSeed(&random, 2);
+
+    cut_assert_equal_int(POINTER_NULL,
+                         isomorphism_invertPermutation(NULL, &inverse));
+    cut_assert_equal_int(POINTER_NULL,
+                         isomorphism_invertPermutation(&permutation, NULL));
+
+    for (int trump = DIAMONDS; trump <= SuitEnd; trump++)
+        for (int test = 0; test < 100; test++) {
+            dealRandomSets(sets, 0, MAX_GAME_PLAYERS, &random);
+            uint64_t canonical[MAX_GAME_PLAYERS];
+            for (int i = 0; i < MAX_GAME_PLAYERS; i++)
+                canonical[i] = sets[i];
+            isomorphism_canonicalize(canonical, MAX_GAME_PLAYERS, trump,
+                                     &permutation);
+            cut_assert_equal_int(FUNCTION_NO_ERROR,
+                                 isomorphism_invertPermutation(&permutation,
+                                                               &inverse));
+
+            for (int i = 0; i < SuitEnd; i++)
+                cut_assert_equal_int(i, inverse.suits[permutation.suits[i]]);
+            for (int i = 0; i < MAX_GAME_PLAYERS; i++)
+                cut_assert_true(sets[i] ==
+                                isomorphism_permuteCards(canonical[i],
+                                                         &inverse));
+            for (int card = 0; card < DECK_SIZE; card++)
+                cut_assert_equal_int(card, isomorphism_permuteCard(
+                                     isomorphism_permuteCard(card,
+                                                             &permutation),
+                                     &inverse));
+        }
+}
@@ -0,0 +1,133 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <pimc.h>
+#include <round.h>
+#include <random.h>
+#include <errors.h>
+#include <constants.h>
+
+#include <cutter.h>
+#include <time.h>
+
+#include "fixture.h"
+
+/**
+ * @brief The time given to the robot for a card, in milliseconds.
+ */
+#define PIMC_TEST_MILLISECONDS 10
+
+/**
+ * @brief The time by which a decision can pass the deadline, in
+ *        microseconds: the card of the heuristic robot and the threads which
+ *        finish their positions after the deadline.
+ */
+#define PIMC_TEST_TOLERANCE 5000
+
+/**
+ * @brief Function gets the time of the monotonic clock in microseconds.
+ */
+static long getMicroseconds()
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+
+    return time.tv_sec * 1000000L + time.tv_nsec / 1000;
+}
+
+/**
+ * @brief Function deals a round, places the bids and starts the first hand,
+ *        as the game does before the robot puts down the first card.
+ */
+static struct Round *createPlayedRound(int playersNumber,
+                                       struct Random *random)
+{
+    struct Round *round = fixture_createDealtRound(MAX_CARDS, playersNumber,
+                                                   random);
+    fixture_placeRandomBids(round, random);
+    round_initializeHand(round);
+    round_addPlayersInHand(round, 0);
+
+    return round;
+}
+
+/**
+ * @brief Function plays a round with the Monte Carlo robot for all the
+ *        players and checks that every card is legal and is put down in time.
+ */
+static void checkPlayedRound(struct Pimc *pimc, struct Round *round)
+{
+    struct Player *player = fixture_getPlayerToMove(round);
+    int cards = fixture_getLegalCards(round, player);
+
+    while (cards != 0) {
+        long start = getMicroseconds();
+        int cardId = pimc_getCardId(pimc, player, round,
+                                    PIMC_TEST_MILLISECONDS);
+        long elapsed = getMicroseconds() - start;
+
+        cut_assert_operator_int(cardId, >=, 0);
+        cut_assert_operator_int(cardId, <, MAX_CARDS);
+        cut_assert_true((cards >> cardId) & 1);
+        cut_assert_operator_int(elapsed, <=, PIMC_TEST_MILLISECONDS * 1000 +
+                                             PIMC_TEST_TOLERANCE);
+
+        cut_assert_equal_int(FUNCTION_NO_ERROR,
+                             round_applyMove(round, player, CARD_MOVE,
+                                             cardId));
+        player = fixture_getPlayerToMove(round);
+        cards = fixture_getLegalCards(round, player);
+    }
+}
+
+void test_pimc_getCardId()
+{
+    struct Pimc *pimc = pimc_createPimc(1, 1);
+    struct Random random;
+    random_setSeed(&random, 1);
+
+    cut_assert_not_null(pimc);
+    cut_assert_equal_pointer(NULL, pimc_createPimc(-1, 1));
+
+    struct Round *round = createPlayedRound(MIN_GAME_PLAYERS, &random);
+    struct Player *player = fixture_getPlayerToMove(round);
+
+    cut_assert_equal_int(POINTER_NULL,
+                         pimc_getCardId(NULL, player, round, 1));
+    cut_assert_equal_int(PLAYER_NULL, pimc_getCardId(pimc, NULL, round, 1));
+    cut_assert_equal_int(ROUND_NULL, pimc_getCardId(pimc, player, NULL, 1));
+    cut_assert_equal_int(ILLEGAL_VALUE,
+                         pimc_getCardId(pimc, player, round, -1));
+
+    /* Without time no world is solved, the card of the heuristic robot is
+     * put down. */
+    int cardId = pimc_getCardId(pimc, player, round, 0);
+    cut_assert_operator_int(cardId, >=, 0);
+    cut_assert_true((fixture_getLegalCards(round, player) >> cardId) & 1);
+
+    fixture_deleteDealtRound(&round);
+    pimc_deletePimc(&pimc);
+}
+
+void test_pimc_deadline()
+{
+    struct Random random;
+    random_setSeed(&random, 2);
+
+    /* The deadline is kept by the calling thread and by the other threads. */
+    for (int threadsNumber = 1; threadsNumber <= 2; threadsNumber++) {
+        struct Pimc *pimc = pimc_createPimc(threadsNumber, threadsNumber);
+        cut_assert_not_null(pimc);
+
+        for (int playersNumber = MIN_GAME_PLAYERS;
+             playersNumber <= MAX_GAME_PLAYERS; playersNumber++) {
+            struct Round *round = createPlayedRound(playersNumber, &random);
+            checkPlayedRound(pimc, round);
+            fixture_deleteDealtRound(&round);
+        }
+
+        cut_assert_operator_int(pimc->decisionsNumber, >, 0);
+        cut_assert_operator_int(pimc->worldsNumber, >, 0);
+
+        pimc_deletePimc(&pimc);
+    }
+}
@@ -21,7 +21,7 @@ void test_player_createPlayer()
         cut_assert_equal_int(i, player->isHuman);
         cut_assert_equal_string(name[i], player->name);
         for (int j = 0; j < MAX_CARDS; j++)
-            if (player->hand[j] != NULL)
+            if (deck_isCard(player->hand[j]))
                 check++;
         cut_assert_equal_int(0, check);
         player_deletePlayer(&player);
@@ -32,7 +32,7 @@ void test_player_deletePlayer()
 {
     struct Player *player = player_createPlayer("A", 1);
     cut_assert_equal_int(POINTER_NULL, player_deletePlayer(NULL));
-    cut_assert_equal_int(FUNCTIOON_NO_ERROR, player_deletePlayer(&player));
+    cut_assert_equal_int(FUNCTION_NO_ERROR, player_deletePlayer(&player));
     cut_assert_equal_pointer(NULL, player);
     cut_assert_equal_int(PLAYER_NULL, player_deletePlayer(&player));
 }
@@ -42,18 +42,18 @@ void test_player_addCard()
     struct Deck *deck = deck_createDeck(MIN_GAME_PLAYERS);
     struct Player *player = player_createPlayer("A", 1);
 
-    cut_assert_equal_int(PLAYER_NULL, player_addCard(NULL, &deck->cards[0]));
-    cut_assert_equal_int(POINTER_NULL, player_addCard(player, NULL));
-    cut_assert_operator_int(0, >, player_addCard(NULL, NULL));
+    cut_assert_equal_int(PLAYER_NULL, player_addCard(NULL, deck->cards[0]));
+    cut_assert_equal_int(CARD_NULL, player_addCard(player, EMPTY_CARD));
+    cut_assert_operator_int(0, >, player_addCard(NULL, EMPTY_CARD));
 
     int i;
     for (i = 0; i < MAX_CARDS; i++) {
-        cut_assert_equal_int(FUNCTIOON_NO_ERROR,
-                             player_addCard(player, &deck->cards[i]));
-        cut_assert_equal_int(CARD_NULL, 
-                             player_addCard(player, &deck->cards[i]));
+        cut_assert_equal_int(FUNCTION_NO_ERROR,
+                             player_addCard(player, deck->cards[i]));
+        cut_assert_equal_int(DUPLICATE_CARD,
+                             player_addCard(player, deck->cards[i]));
     }
-    cut_assert_equal_int(FULL, player_addCard(player, &deck->cards[++i]));
+    cut_assert_equal_int(FULL, player_addCard(player, deck->cards[++i]));
 
     player_deletePlayer(&player);
     deck_deleteDeck(&deck);
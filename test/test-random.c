@@ -0,0 +1,78 @@
+#include <random.h>
+#include <errors.h>
+
+#include <cutter.h>
+#include <limits.h>
+
+void test_random_setSeed()
+{
+    struct Random random1, random2;
+
+    cut_assert_equal_int(POINTER_NULL, random_setSeed(NULL, 1));
+    cut_assert_true(random_getNumber(NULL) == 0);
+
+    /* The same seed gives the same numbers, another seed other numbers. */
+    for (uint64_t seed = 0; seed < 10; seed++) {
+        cut_assert_equal_int(FUNCTION_NO_ERROR, random_setSeed(&random1, seed));
+        cut_assert_equal_int(FUNCTION_NO_ERROR, random_setSeed(&random2, seed));
+        cut_assert_true((random1.state[0] | random1.state[1] |
+                         random1.state[2] | random1.state[3]) != 0);
+
+        for (int i = 0; i < 1000; i++)
+            cut_assert_true(random_getNumber(&random1) ==
+                            random_getNumber(&random2));
+
+        random_setSeed(&random1, seed);
+        random_setSeed(&random2, seed + 1);
+        int differences = 0;
+        for (int i = 0; i < 100; i++)
+            if (random_getNumber(&random1) != random_getNumber(&random2))
+                differences++;
+        cut_assert_operator_int(differences, >, 90);
+    }
+}
+
+void test_random_createSeed()
+{
+    uint64_t seeds[100];
+    for (int i = 0; i < 100; i++) {
+        seeds[i] = random_createSeed();
+        for (int j = 0; j < i; j++)
+            cut_assert_true(seeds[i] != seeds[j]);
+    }
+}
+
+void test_random_getBoundedNumber()
+{
+    struct Random random;
+    random_setSeed(&random, 1);
+
+    cut_assert_equal_int(POINTER_NULL, random_getBoundedNumber(NULL, 1));
+    cut_assert_equal_int(ILLEGAL_VALUE, random_getBoundedNumber(&random, 0));
+    cut_assert_equal_int(ILLEGAL_VALUE, random_getBoundedNumber(&random, -1));
+
+    for (int i = 0; i < 100; i++)
+        cut_assert_equal_int(0, random_getBoundedNumber(&random, 1));
+    for (int i = 0; i < 10000; i++) {
+        int number = random_getBoundedNumber(&random, INT_MAX);
+        cut_assert_operator_int(number, >=, 0);
+        cut_assert_operator_int(number, <, INT_MAX);
+    }
+
+    /* Every number below the bound comes out about as often as the others. */
+    int bounds[] = { 2, 3, 7, 48 };
+    for (size_t i = 0; i < sizeof(bounds) / sizeof(bounds[0]); i++) {
+        int counts[48] = { 0 };
+        int draws = 2000 * bounds[i];
+        for (int j = 0; j < draws; j++) {
+            int number = random_getBoundedNumber(&random, bounds[i]);
+            cut_assert_operator_int(number, >=, 0);
+            cut_assert_operator_int(number, <, bounds[i]);
+            counts[number]++;
+        }
+        for (int j = 0; j < bounds[i]; j++) {
+            cut_assert_operator_int(counts[j], >, 1700);
+            cut_assert_operator_int(counts[j], <, 2300);
+        }
+    }
+}
@@ -1,10 +1,13 @@
 #include <round.h>
 #include <errors.h>
 #include <constants.h>
+#include <random.h>
 
 #include <cutter.h>
 #include <stdlib.h>
 
+#include "fixture.h"
+
 void test_round_createRound()
 {
     cut_assert_equal_pointer(NULL, round_createRound(MIN_CARDS - 1));
@@ -26,7 +29,7 @@ void test_round_createRound()
 
     cut_assert_equal_int(MIN_CARDS, round->roundType);
     cut_assert_equal_pointer(NULL, round->hand);
-    cut_assert_equal_pointer(NULL, round->trump);
+    cut_assert_equal_int(0, deck_isCard(round->trump));
 
     round_deleteRound(&round);
 }
@@ -35,7 +38,7 @@ void test_round_deleteRound()
 {
     struct Round *round = round_createRound(MIN_CARDS);
     cut_assert_equal_int(POINTER_NULL, round_deleteRound(NULL));
-    cut_assert_equal_int(FUNCTIOON_NO_ERROR, round_deleteRound(&round));
+    cut_assert_equal_int(FUNCTION_NO_ERROR, round_deleteRound(&round));
     cut_assert_equal_int(ROUND_NULL, round_deleteRound(&round));
     cut_assert_equal_pointer(NULL, round);
 }
@@ -53,7 +56,7 @@ void test_round_addPlayer()
 
     for (int i = 0; i < MAX_GAME_PLAYERS; i++) {
         players[i] = player_createPlayer("A", i);
-        cut_assert_equal_int(FUNCTIOON_NO_ERROR,
+        cut_assert_equal_int(FUNCTION_NO_ERROR,
                              round_addPlayer(round, players[i]));
         cut_assert_equal_int(DUPLICATE_POINTER,
                              round_addPlayer(round, players[i]));
@@ -80,7 +83,7 @@ void test_round_addHand()
     cut_assert_equal_int(ROUND_NULL, round_addHand(NULL, &hand));
     cut_assert_equal_int(POINTER_NULL, round_addHand(round, NULL));
     cut_assert_operator_int(0, >, round_addHand(NULL, NULL));
-    cut_assert_equal_int(FUNCTIOON_NO_ERROR, round_addHand(round, &hand));
+    cut_assert_equal_int(FUNCTION_NO_ERROR, round_addHand(round, &hand));
     cut_assert_equal_int(HAND_NULL, round_addHand(round, &hand));
     cut_assert_equal_pointer(NULL, hand);
     int check = 0;
@@ -94,18 +97,22 @@ void test_round_addHand()
 void test_round_addTrump()
 {
     struct Round *round  = round_createRound(MIN_CARDS);
-    struct Card  *trump  = deck_createCard(DIAMONDS, VALUES[0]);
-    struct Card  *trump2 = trump;
-
-    cut_assert_equal_int(ROUND_NULL, round_addTrump(NULL, &trump));
-    cut_assert_equal_int(POINTER_NULL, round_addTrump(round, NULL));
-    cut_assert_operator_int(0, >, round_addTrump(NULL, NULL));
-    cut_assert_equal_int(FUNCTIOON_NO_ERROR, round_addTrump(round, &trump));
-    cut_assert_equal_pointer(NULL, trump);
-    cut_assert_equal_pointer(trump2, round->trump);
-    cut_assert_equal_int(FUNCTIOON_NO_ERROR, round_addTrump(round, &trump));
-    cut_assert_equal_pointer(NULL, trump);
-    cut_assert_equal_pointer(NULL, round->trump);
+    struct Card   trump  = deck_createCard(DIAMONDS, VALUES[0]);
+
+    cut_assert_equal_int(ROUND_NULL, round_addTrump(NULL, trump));
+    cut_assert_operator_int(0, >, round_addTrump(NULL, EMPTY_CARD));
+    cut_assert_equal_int(FUNCTION_NO_ERROR, round_addTrump(round, trump));
+    cut_assert_equal_int(trump.id, round->trump.id);
+    cut_assert_equal_int(FUNCTION_NO_ERROR, round_addTrump(round, EMPTY_CARD));
+    cut_assert_equal_int(0, deck_isCard(round->trump));
+
+    /* The trump set after the hand began is also the trump of the hand. */
+    round_initializeHand(round);
+    cut_assert_equal_int(SuitEnd, round->hand->trump);
+    round_addTrump(round, trump);
+    cut_assert_equal_int(DIAMONDS, round->hand->trump);
+    round_addTrump(round, deck_createCard(SPADES, VALUES[0]));
+    cut_assert_equal_int(SPADES, round->hand->trump);
 
     round_deleteRound(&round);
 }
@@ -118,7 +125,7 @@ void test_round_addPlayersInHand()
     cut_assert_equal_int(ILLEGAL_VALUE,
                          round_addPlayersInHand(round, MAX_GAME_PLAYERS + 1));
     cut_assert_equal_int(HAND_NULL, round_addPlayersInHand(round, 0));
-    round->hand = hand_createHand();
+    round_initializeHand(round);
     cut_assert_equal_int(INSUFFICIENT_PLAYERS,
                          round_addPlayersInHand(round, 0));
 
@@ -129,7 +136,7 @@ void test_round_addPlayersInHand()
     }
 
     for (int i = 0 ; i < MAX_GAME_PLAYERS; i++) {
-        cut_assert_equal_int(FUNCTIOON_NO_ERROR,
+        cut_assert_equal_int(FUNCTION_NO_ERROR,
                              round_addPlayersInHand(round, i));
         int position = 0;
         for (int j = i; j < MAX_GAME_PLAYERS; j++) {
@@ -142,8 +149,7 @@ void test_round_addPlayersInHand()
                                      round->hand->players[position]);
             position++;
         }
-        hand_deleteHand(&round->hand);
-        round->hand = hand_createHand(); 
+        round_initializeHand(round);
     }
 
     round_deleteRound(&round);
@@ -168,14 +174,14 @@ void test_round_disitrbuteCard()
     }
 
     for (int i = 0; i < MAX_CARDS; i++) {
-        cut_assert_equal_int(FUNCTIOON_NO_ERROR,
+        cut_assert_equal_int(FUNCTION_NO_ERROR,
                              round_distributeCard(round, deck));
         cut_assert_equal_int(DECK_SIZE - (i + 1) * MAX_GAME_PLAYERS,
                              deck_getDeckSize(deck));
         for (int j = 0; j < MAX_GAME_PLAYERS; j++) {
             int cardsNumber = 0;
             for (int k = 0; k < MAX_CARDS; k++)
-                if (round->players[j]->hand[k] != NULL)
+                if (deck_isCard(round->players[j]->hand[k]))
                     cardsNumber++;
             cut_assert_equal_int(i + 1, cardsNumber);
         }
@@ -201,17 +207,18 @@ void test_round_distributeDeck()
         round_addPlayer(round, players[i]);
     }
 
-    cut_assert_equal_int(FUNCTIOON_NO_ERROR, round_distributeDeck(round, deck));
-    cut_assert_equal_pointer(NULL, round->trump);
+    cut_assert_equal_int(FUNCTION_NO_ERROR, round_distributeDeck(round, deck));
+    cut_assert_equal_int(0, deck_isCard(round->trump));
     for (int i = 0; i < MAX_GAME_PLAYERS; i++) {
         int nullCards = 0;
         int duplicate = 0;
         for (int j = 0; j < MAX_CARDS; j++)
-            if (round->players[i]->hand[j] == NULL)
+            if (!deck_isCard(round->players[i]->hand[j]))
                 nullCards++;
         for (int j = 0; j < MAX_CARDS - 1; j++)
             for (int k = j + 1; k < MAX_CARDS; k++)
-                if (round->players[i]->hand[j] == round->players[i]->hand[k])
+                if (round->players[i]->hand[j].id ==
+                    round->players[i]->hand[k].id)
                     duplicate++;
         cut_assert_equal_int(0, nullCards);
         cut_assert_equal_int(0, duplicate);
@@ -283,13 +290,13 @@ void test_round_checkBid()
                          round_checkBid(round, players[0], MAX_CARDS + 1));
 
     for (int i = 0; i < MAX_GAME_PLAYERS - 1; i++) {
-        cut_assert_equal_int(FUNCTIOON_NO_ERROR,
+        cut_assert_equal_int(FUNCTION_NO_ERROR,
                              round_checkBid(round, players[i], 1));
         round->bids[i] = 1;
     }
 
     int i = MAX_GAME_PLAYERS - 1;
-    cut_assert_equal_int(FUNCTIOON_NO_ERROR,
+    cut_assert_equal_int(FUNCTION_NO_ERROR,
                          round_checkBid(round, players[i], 1));
     cut_assert_equal_int(ILLEGAL_BID,
                          round_checkBid(round, players[i], MAX_CARDS - i));
@@ -319,10 +326,24 @@ void test_round_placeBid()
     cut_assert_equal_int(ILLEGAL_BID,
                          round_placeBid(round, players[0], MAX_CARDS + 1));
 
+    /* The players bid in their order, every one of them once. */
+    cut_assert_equal_int(ILLEGAL_BID, round_placeBid(round, players[2], 1));
+    cut_assert_equal_int(0, round->bidsNumber);
+    cut_assert_equal_int(0, round->bids[2]);
+
     for (int i = 0; i < MAX_GAME_PLAYERS - 1; i++) {
-        cut_assert_equal_int(FUNCTIOON_NO_ERROR,
+        cut_assert_equal_int(FUNCTION_NO_ERROR,
                              round_placeBid(round, players[i], i));
         cut_assert_equal_int(i, round->bids[i]);
+        cut_assert_equal_int(i + 1, round->bidsNumber);
+
+        cut_assert_equal_int(ILLEGAL_BID,
+                             round_placeBid(round, players[i], i + 1));
+        cut_assert_equal_int(i, round->bids[i]);
+        if (i + 2 < MAX_GAME_PLAYERS)
+            cut_assert_equal_int(ILLEGAL_BID,
+                                 round_placeBid(round, players[i + 2], 0));
+        cut_assert_equal_int(i + 1, round->bidsNumber);
     }
 
     round_deleteRound(&round);
@@ -334,11 +355,11 @@ void test_round_getPlayerWhichWonHand()
 {
     struct Round *round = round_createRound(1);
     struct Player *player;
-    struct Card *cards[6];
+    struct Card cards[6];
 
     cut_assert_equal_pointer(NULL, round_getPlayerWhichWonHand(NULL));
     cut_assert_equal_pointer(NULL, round_getPlayerWhichWonHand(round));
-    round->hand = hand_createHand();
+    round_initializeHand(round);
     cut_assert_equal_pointer(NULL, round_getPlayerWhichWonHand(round));
 
     for (int i = 0; i < 6; i++) {
@@ -358,38 +379,36 @@ void test_round_getPlayerWhichWonHand()
     cut_assert_equal_pointer(NULL, round_getPlayerWhichWonHand(round));
     
     for (int i = 0; i < 6; i++)
-        hand_addCard(round->hand, round->hand->players[i], &cards[i]);
-
-    struct Card *trump = deck_createCard(DIAMONDS, 14);
+        hand_addCard(round->hand, round->hand->players[i], cards[i]);
 
     cut_assert_equal_pointer(round->hand->players[3],
                              round_getPlayerWhichWonHand(round));
-    round->trump = trump;
+    round_addTrump(round, deck_createCard(DIAMONDS, 14));
     cut_assert_equal_pointer(round->hand->players[3],
                              round_getPlayerWhichWonHand(round));
-    round->trump->suit = CLUBS;
+    round_addTrump(round, deck_createCard(CLUBS, 14));
     cut_assert_equal_pointer(round->hand->players[4], 
                              round_getPlayerWhichWonHand(round));
-    round->trump->suit = SPADES;
+    round_addTrump(round, deck_createCard(SPADES, 14));
     cut_assert_equal_pointer(round->hand->players[5],
                              round_getPlayerWhichWonHand(round));
-    round->trump->suit = HEARTS;
+    round_addTrump(round, deck_createCard(HEARTS, 14));
     cut_assert_equal_pointer(round->hand->players[3],
                              round_getPlayerWhichWonHand(round));
-    round->hand->cards[0]->suit = HEARTS;
+    hand_addCard(round->hand, round->hand->players[0],
+                 deck_createCard(HEARTS, 6));
     cut_assert_equal_pointer(round->hand->players[0],
                              round_getPlayerWhichWonHand(round));
-    round->trump = NULL; 
+    round_addTrump(round, EMPTY_CARD);
     cut_assert_equal_pointer(round->hand->players[0],
                              round_getPlayerWhichWonHand(round));
-    round->trump = trump;
-    round->trump->suit = DIAMONDS;
+    round_addTrump(round, deck_createCard(DIAMONDS, 14));
     cut_assert_equal_pointer(round->hand->players[3],
                              round_getPlayerWhichWonHand(round));
-    round->trump->suit = CLUBS;
+    round_addTrump(round, deck_createCard(CLUBS, 14));
     cut_assert_equal_pointer(round->hand->players[4],
                              round_getPlayerWhichWonHand(round));
-    round->trump->suit = SPADES;
+    round_addTrump(round, deck_createCard(SPADES, 14));
     cut_assert_equal_pointer(round->hand->players[5],
                              round_getPlayerWhichWonHand(round));
 
@@ -419,7 +438,7 @@ void test_round_determinesScore()
     round->bids[2]        = 2;
     round->handsNumber[2] = 3;
 
-    cut_assert_equal_int(FUNCTIOON_NO_ERROR, round_determinesScore(round));
+    cut_assert_equal_int(FUNCTION_NO_ERROR, round_determinesScore(round));
 
     cut_assert_equal_int(7, round->pointsNumber[0]);
     cut_assert_equal_int(-1, round->pointsNumber[1]);
@@ -448,7 +467,7 @@ void test_round_copyScore()
         round1->pointsNumber[i] = i;
     }
 
-    cut_assert_equal_int(FUNCTIOON_NO_ERROR, round_copyScore(round1, round2));
+    cut_assert_equal_int(FUNCTION_NO_ERROR, round_copyScore(round1, round2));
     for (int i = 0; i < MAX_GAME_PLAYERS; i++)
         cut_assert_equal_int(round1->pointsNumber[i], round2->pointsNumber[i]);
 
@@ -478,7 +497,7 @@ void test_round_repeatRound()
     cut_assert_equal_int(1, round_repeatRound(round));
 
     round->handsNumber[0] = 0;
-    cut_assert_equal_int(FUNCTIOON_NO_ERROR, round_repeatRound(round));
+    cut_assert_equal_int(FUNCTION_NO_ERROR, round_repeatRound(round));
 
     for (int i = 0; i < MAX_GAME_PLAYERS; i++)
         player_deletePlayer(&players[i]);
@@ -496,7 +515,7 @@ void test_round_reinitializeRound()
     }
 
     cut_assert_equal_int(ROUND_NULL, round_reinitializeRound(NULL));
-    cut_assert_equal_int(FUNCTIOON_NO_ERROR, round_reinitializeRound(round));
+    cut_assert_equal_int(FUNCTION_NO_ERROR, round_reinitializeRound(round));
 
     for (int i = 0; i < MAX_GAME_PLAYERS; i++) {
         cut_assert_equal_int(0, round->bids[i]);
@@ -506,3 +525,230 @@ void test_round_reinitializeRound()
     round_deleteRound(&round);
 }
 
+
+/**
+ * @struct RoundState
+ *
+ * @brief What a move can modify in a round, kept to check round_undoMove().
+ */
+struct RoundState {
+    int bids[MAX_GAME_PLAYERS];
+    int handsNumber[MAX_GAME_PLAYERS];
+    int bidsNumber;
+    int movesNumber;
+    uint64_t key;
+    int hasHand;
+    struct Card table[MAX_GAME_PLAYERS];
+    struct Player *handPlayers[MAX_GAME_PLAYERS];
+    int cardsNumber;
+    int winnerId;
+    struct Card cards[MAX_GAME_PLAYERS][MAX_CARDS];
+};
+
+static void saveRoundState(const struct Round *round, struct RoundState *state)
+{
+    for (int i = 0; i < MAX_GAME_PLAYERS; i++) {
+        state->bids[i]        = round->bids[i];
+        state->handsNumber[i] = round->handsNumber[i];
+        for (int j = 0; j < MAX_CARDS; j++)
+            state->cards[i][j] = round->players[i] != NULL ?
+                                 round->players[i]->hand[j] : EMPTY_CARD;
+    }
+    state->bidsNumber  = round->bidsNumber;
+    state->movesNumber = round->movesNumber;
+    state->key         = round->key;
+    state->hasHand     = round->hand != NULL;
+    for (int i = 0; i < MAX_GAME_PLAYERS; i++) {
+        state->table[i]       = state->hasHand ? round->hand->cards[i] :
+                                                 EMPTY_CARD;
+        state->handPlayers[i] = state->hasHand ? round->hand->players[i] :
+                                                 NULL;
+    }
+    state->cardsNumber = state->hasHand ? round->hand->cardsNumber : 0;
+    state->winnerId    = state->hasHand ? round->hand->winnerId : -1;
+}
+
+static void checkRoundState(const struct Round *round,
+                            const struct RoundState *state)
+{
+    struct RoundState current;
+    saveRoundState(round, &current);
+
+    for (int i = 0; i < MAX_GAME_PLAYERS; i++) {
+        cut_assert_equal_int(state->bids[i], current.bids[i]);
+        cut_assert_equal_int(state->handsNumber[i], current.handsNumber[i]);
+        cut_assert_equal_int(state->table[i].id, current.table[i].id);
+        cut_assert_equal_pointer(state->handPlayers[i],
+                                 current.handPlayers[i]);
+        for (int j = 0; j < MAX_CARDS; j++)
+            cut_assert_equal_int(state->cards[i][j].id,
+                                 current.cards[i][j].id);
+    }
+    cut_assert_equal_int(state->bidsNumber, current.bidsNumber);
+    cut_assert_equal_int(state->movesNumber, current.movesNumber);
+    cut_assert_true(state->key == current.key);
+    cut_assert_equal_int(state->hasHand, current.hasHand);
+    cut_assert_equal_int(state->cardsNumber, current.cardsNumber);
+    cut_assert_equal_int(state->winnerId, current.winnerId);
+}
+
+void test_round_applyMove()
+{
+    struct Random random;
+    random_setSeed(&random, 1);
+    struct Round *round = fixture_createDealtRound(2, 4, &random);
+    struct Player **players = round->players;
+    struct RoundState state;
+
+    cut_assert_equal_int(ROUND_NULL,
+                         round_applyMove(NULL, players[0], BID_MOVE, 0));
+    cut_assert_equal_int(PLAYER_NULL,
+                         round_applyMove(round, NULL, BID_MOVE, 0));
+    cut_assert_equal_int(ILLEGAL_VALUE,
+                         round_applyMove(round, players[0], CARD_MOVE + 1, 0));
+
+    /* A card can't be put down before the bids and a player can't bid out of
+     * turn. */
+    saveRoundState(round, &state);
+    cut_assert_equal_int(ILLEGAL_MOVE,
+                         round_applyMove(round, players[1], CARD_MOVE, 0));
+    cut_assert_equal_int(ILLEGAL_MOVE,
+                         round_applyMove(round, players[0], CARD_MOVE, 0));
+    cut_assert_equal_int(ILLEGAL_BID,
+                         round_applyMove(round, players[1], BID_MOVE, 0));
+    checkRoundState(round, &state);
+
+    for (int i = 0; i < 3; i++)
+        cut_assert_equal_int(FUNCTION_NO_ERROR,
+                             round_applyMove(round, players[i], BID_MOVE, 0));
+    cut_assert_equal_int(ILLEGAL_BID,
+                         round_applyMove(round, players[3], BID_MOVE, 2));
+    saveRoundState(round, &state);
+    cut_assert_equal_int(ILLEGAL_MOVE,
+                         round_applyMove(round, players[0], CARD_MOVE, 0));
+    checkRoundState(round, &state);
+    cut_assert_equal_int(FUNCTION_NO_ERROR,
+                         round_applyMove(round, players[3], BID_MOVE, 1));
+    cut_assert_equal_int(ILLEGAL_BID,
+                         round_applyMove(round, players[0], BID_MOVE, 1));
+
+    /* The first player of the round starts the first hand, after what a
+     * player can put down a card only in his turn. */
+    saveRoundState(round, &state);
+    cut_assert_equal_int(ILLEGAL_MOVE,
+                         round_applyMove(round, players[1], CARD_MOVE, 0));
+    checkRoundState(round, &state);
+    cut_assert_equal_int(FUNCTION_NO_ERROR,
+                         round_applyMove(round, players[0], CARD_MOVE, 0));
+    cut_assert_equal_int(1, round->hand->cardsNumber);
+
+    saveRoundState(round, &state);
+    cut_assert_equal_int(CARD_NULL,
+                         round_applyMove(round, players[0], CARD_MOVE, 0));
+    cut_assert_equal_int(ILLEGAL_MOVE,
+                         round_applyMove(round, players[0], CARD_MOVE, 1));
+    cut_assert_equal_int(ILLEGAL_MOVE,
+                         round_applyMove(round, players[2], CARD_MOVE, 0));
+    cut_assert_equal_int(ILLEGAL_VALUE,
+                         round_applyMove(round, players[1], CARD_MOVE, -1));
+    cut_assert_equal_int(CARD_NULL,
+                         round_applyMove(round, players[1], CARD_MOVE,
+                                         MAX_CARDS - 1));
+    checkRoundState(round, &state);
+
+    int legalCards = hand_getLegalCards(round->hand, players[1], round->trump);
+    for (int i = 0; i < round->roundType; i++)
+        if (((legalCards >> i) & 1) == 0) {
+            cut_assert_equal_int(ILLEGAL_VALUE,
+                                 round_applyMove(round, players[1],
+                                                 CARD_MOVE, i));
+            checkRoundState(round, &state);
+        }
+
+    fixture_deleteDealtRound(&round);
+}
+
+void test_round_undoMove()
+{
+    struct Random random;
+    struct RoundState states[ROUND_MOVES_NUMBER + 1];
+    random_setSeed(&random, 1);
+
+    cut_assert_equal_int(ROUND_NULL, round_undoMove(NULL));
+
+    for (int playersNumber = MIN_GAME_PLAYERS;
+         playersNumber <= MAX_GAME_PLAYERS; playersNumber++)
+        for (int roundType = MIN_CARDS; roundType <= MAX_CARDS; roundType++)
+            for (int test = 0; test < 20; test++) {
+                struct Round *round = fixture_createDealtRound(roundType,
+                                                       playersNumber,
+                                                       &random);
+                cut_assert_equal_int(NOT_FOUND, round_undoMove(round));
+
+                int movesNumber = 0;
+                saveRoundState(round, &states[0]);
+                while (fixture_applyRandomMove(round, &random)) {
+                    movesNumber++;
+                    cut_assert_equal_int(movesNumber, round->movesNumber);
+                    saveRoundState(round, &states[movesNumber]);
+                }
+                cut_assert_equal_int(playersNumber * (roundType + 1),
+                                     movesNumber);
+
+                int handsNumber = 0;
+                for (int i = 0; i < playersNumber; i++)
+                    handsNumber += round->handsNumber[i];
+                cut_assert_equal_int(roundType, handsNumber);
+
+                /* Some moves are undone and made again before all the moves
+                 * are undone. */
+                int undone = random_getBoundedNumber(&random,
+                                                     movesNumber + 1);
+                for (int i = movesNumber; i > movesNumber - undone; i--) {
+                    cut_assert_equal_int(FUNCTION_NO_ERROR,
+                                         round_undoMove(round));
+                    checkRoundState(round, &states[i - 1]);
+                }
+                while (fixture_applyRandomMove(round, &random))
+                    ;
+                while (round->movesNumber > 0) {
+                    cut_assert_equal_int(FUNCTION_NO_ERROR,
+                                         round_undoMove(round));
+                    if (round->movesNumber <= movesNumber - undone)
+                        checkRoundState(round, &states[round->movesNumber]);
+                }
+                checkRoundState(round, &states[0]);
+
+                fixture_deleteDealtRound(&round);
+            }
+}
+
+void test_round_computeKey()
+{
+    struct Random random;
+    random_setSeed(&random, 2);
+
+    cut_assert_true(round_computeKey(NULL) == 0);
+
+    for (int playersNumber = MIN_GAME_PLAYERS;
+         playersNumber <= MAX_GAME_PLAYERS; playersNumber++)
+        for (int roundType = MIN_CARDS; roundType <= MAX_CARDS; roundType++)
+            for (int test = 0; test < 20; test++) {
+                struct Round *round = fixture_createDealtRound(roundType,
+                                                       playersNumber,
+                                                       &random);
+                uint64_t firstKey = round->key;
+                cut_assert_true(round->key == round_computeKey(round));
+
+                while (fixture_applyRandomMove(round, &random))
+                    cut_assert_true(round->key == round_computeKey(round));
+
+                while (round->movesNumber > 0) {
+                    round_undoMove(round);
+                    cut_assert_true(round->key == round_computeKey(round));
+                }
+                cut_assert_true(round->key == firstKey);
+
+                fixture_deleteDealtRound(&round);
+            }
+}
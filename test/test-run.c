@@ -0,0 +1,182 @@
+#include <game.h>
+#include <robot.h>
+#include <errors.h>
+#include <constants.h>
+
+#include <cutter.h>
+#include <string.h>
+
+/**
+ * @struct RunLog
+ *
+ * @brief What the callbacks of game_run() saw during a game.
+ */
+struct RunLog {
+    int bidsNumber;
+    int cardsNumber;
+    int handsNumber;
+    int roundsNumber;
+    int lastRound;
+};
+
+static int getBid(const struct Player *player, const struct Round *round,
+                  void *data)
+{
+    ((struct RunLog*)data)->bidsNumber++;
+    return robot_getBid(player, round);
+}
+
+static int getCardId(const struct Player *player, const struct Round *round,
+                     void *data)
+{
+    ((struct RunLog*)data)->cardsNumber++;
+    return robot_getCardId(player, round);
+}
+
+static void endHand(const struct Game *game, int roundId, void *data)
+{
+    (void)game;
+    (void)roundId;
+    ((struct RunLog*)data)->handsNumber++;
+}
+
+static void endRound(const struct Game *game, int roundId, void *data)
+{
+    struct RunLog *log = data;
+    (void)game;
+
+    /* The rounds end one after the other, the repeated ones only once. */
+    cut_assert_equal_int(log->lastRound + 1, roundId);
+    log->lastRound = roundId;
+    log->roundsNumber++;
+}
+
+/**
+ * @brief Function creates a game with robots only and plays it to the end.
+ */
+static struct Game *runGame(int gameType, int playersNumber, uint64_t seed,
+                            struct RunLog *log)
+{
+    struct Game *game = game_createGame(gameType);
+    cut_assert_not_null(game);
+
+    for (int i = 0; i < playersNumber; i++) {
+        char name[] = "robot1";
+        name[5] = '1' + i;
+        struct Player *player = player_createPlayer(name, 0);
+        cut_assert_equal_int(FUNCTION_NO_ERROR, game_addPlayer(game, &player));
+    }
+    game_setSeed(game, seed);
+    cut_assert_equal_int(FUNCTION_NO_ERROR, game_createAndAddRounds(game));
+    cut_assert_equal_int(FUNCTION_NO_ERROR, game_addPlayersInAllRounds(game));
+
+    struct GameCallbacks callbacks = {
+        getBid, getCardId, endHand, endRound, log
+    };
+    memset(log, 0, sizeof(struct RunLog));
+    log->lastRound = -1;
+    cut_assert_equal_int(FUNCTION_NO_ERROR, game_run(game, &callbacks));
+
+    return game;
+}
+
+/**
+ * @brief Function checks that every round of a played game is over and that
+ *        the points of every round are the points of the round before plus
+ *        the score and the reward of the round.
+ */
+static void checkFinishedGame(const struct Game *game,
+                              const struct RunLog *log)
+{
+    int roundsNumber = game_getRoundsNumber(game);
+    cut_assert_equal_int(roundsNumber - 1, game->currentRound);
+    cut_assert_equal_int(roundsNumber, log->roundsNumber);
+
+    /* The repeated rounds are played again, so there can be more moves than
+     * the rounds of the game need. */
+    int handsNumber = 0;
+    for (int i = 0; i < roundsNumber; i++)
+        handsNumber += game->rounds[i]->roundType;
+    cut_assert_operator_int(log->handsNumber, >=, handsNumber);
+    cut_assert_equal_int(log->handsNumber * game->playersNumber,
+                         log->cardsNumber);
+
+    for (int i = 0; i < roundsNumber; i++) {
+        const struct Round *round = game->rounds[i];
+        int wonHands = 0;
+        int exactBids = 0;
+
+        for (int j = 0; j < game->playersNumber; j++) {
+            const struct Player *player = round->players[j];
+            cut_assert_equal_int(0, player_getCardsNumber(player));
+            wonHands += round->handsNumber[j];
+            if (round->bids[j] == round->handsNumber[j])
+                exactBids++;
+
+            int points = 0;
+            if (i > 0) {
+                const struct Round *previous = game->rounds[i - 1];
+                points = previous->pointsNumber[round_getPlayerId(previous,
+                                                                  player)];
+            }
+            int difference = round->handsNumber[j] - round->bids[j];
+            if (difference == 0)
+                points += POINTS_PER_ROUND + round->bids[j];
+            else
+                points -= difference < 0 ? -difference : difference;
+            if (round->bonus[j] == 1)
+                points += BONUS;
+            if (round->bonus[j] == 2)
+                points -= BONUS;
+
+            cut_assert_equal_int(points, round->pointsNumber[j]);
+        }
+
+        cut_assert_equal_int(round->roundType, wonHands);
+        cut_assert_operator_int(exactBids, >, 0);
+    }
+}
+
+void test_game_run()
+{
+    struct GameCallbacks callbacks = { NULL, NULL, NULL, NULL, NULL };
+    cut_assert_equal_int(GAME_NULL, game_run(NULL, &callbacks));
+
+    for (int gameType = 1; gameType <= 8; gameType += 7)
+        for (int playersNumber = MIN_GAME_PLAYERS;
+             playersNumber <= MAX_GAME_PLAYERS; playersNumber++) {
+            struct RunLog log1, log2;
+            uint64_t seed = 100 * gameType + playersNumber;
+            struct Game *game1 = runGame(gameType, playersNumber, seed,
+                                         &log1);
+            checkFinishedGame(game1, &log1);
+
+            struct GameCallbacks robots = { getBid, getCardId, NULL, NULL,
+                                            &log1 };
+            cut_assert_equal_int(GAME_OVER, game_playRound(game1, &robots));
+
+            /* The same seed plays the same game again. */
+            struct Game *game2 = runGame(gameType, playersNumber, seed,
+                                         &log2);
+            cut_assert_equal_memory(&log1, sizeof(log1), &log2,
+                                    sizeof(log2));
+            for (int i = 0; i < game_getRoundsNumber(game1); i++) {
+                const struct Round *round1 = game1->rounds[i];
+                const struct Round *round2 = game2->rounds[i];
+                cut_assert_equal_memory(round1->bids, sizeof(round1->bids),
+                                        round2->bids, sizeof(round2->bids));
+                cut_assert_equal_memory(round1->handsNumber,
+                                        sizeof(round1->handsNumber),
+                                        round2->handsNumber,
+                                        sizeof(round2->handsNumber));
+                cut_assert_equal_memory(round1->pointsNumber,
+                                        sizeof(round1->pointsNumber),
+                                        round2->pointsNumber,
+                                        sizeof(round2->pointsNumber));
+                cut_assert_equal_int(round1->trump.id, round2->trump.id);
+            }
+
+            game_deleteGame(&game1);
+            game_deleteGame(&game2);
+        }
+}
@@ -0,0 +1,162 @@
+#include <solver.h>
+#include <round.h>
+#include <random.h>
+#include <errors.h>
+#include <constants.h>
+
+#include <cutter.h>
+
+#include "fixture.h"
+
+/**
+ * @brief Function calculates by minimax, trying all the cards, how many of
+ *        the remaining hands a player wins.
+ */
+static int getHandsByMinimax(struct Round *round, int playerId, int maximize)
+{
+    struct Player *player = fixture_getPlayerToMove(round);
+    int cards = fixture_getLegalCards(round, player);
+    if (cards == 0)
+        return round->handsNumber[playerId];
+
+    int isPlayer = round_getPlayerId(round, player) == playerId;
+    int wantsMore = isPlayer == maximize;
+    int best = -1;
+    for (int i = 0; i < MAX_CARDS; i++)
+        if ((cards >> i) & 1) {
+            round_applyMove(round, player, CARD_MOVE, i);
+            int hands = getHandsByMinimax(round, playerId, maximize);
+            round_undoMove(round);
+            if (best == -1 || (wantsMore && hands > best) ||
+                (!wantsMore && hands < best))
+                best = hands;
+        }
+
+    return best;
+}
+
+/**
+ * @brief Function checks the result of solver_solveRound() for a round with
+ *        the results calculated by minimax.
+ */
+static void checkSolvedRound(struct Solver *solver, struct Round *round)
+{
+    struct SolverResult result;
+    cut_assert_equal_int(FUNCTION_NO_ERROR,
+                         solver_solveRound(solver, round, &result));
+
+    struct Player *player = fixture_getPlayerToMove(round);
+    int playerId = round_getPlayerId(round, player);
+    cut_assert_equal_int(round->playersNumber, result.playersNumber);
+    cut_assert_equal_int(playerId, result.playerId);
+
+    for (int i = 0; i < round->playersNumber; i++) {
+        int handsNumber = round->handsNumber[i];
+        cut_assert_equal_int(getHandsByMinimax(round, i, 1) - handsNumber,
+                             result.maxHands[i]);
+        cut_assert_equal_int(getHandsByMinimax(round, i, 0) - handsNumber,
+                             result.minHands[i]);
+    }
+
+    int cards = fixture_getLegalCards(round, player);
+    int handsNumber = round->handsNumber[playerId];
+    for (int i = 0; i < MAX_CARDS; i++) {
+        if (((cards >> i) & 1) == 0) {
+            cut_assert_equal_int(-1, result.cardMaxHands[i]);
+            cut_assert_equal_int(-1, result.cardMinHands[i]);
+            continue;
+        }
+        round_applyMove(round, player, CARD_MOVE, i);
+        int maxHands = getHandsByMinimax(round, playerId, 1);
+        int minHands = getHandsByMinimax(round, playerId, 0);
+        round_undoMove(round);
+        cut_assert_equal_int(maxHands - handsNumber, result.cardMaxHands[i]);
+        cut_assert_equal_int(minHands - handsNumber, result.cardMinHands[i]);
+    }
+}
+
+void test_solver_solveRound()
+{
+    struct Solver *solver = solver_createSolver();
+    struct SolverResult result;
+    struct Random random;
+    random_setSeed(&random, 1);
+
+    cut_assert_equal_int(POINTER_NULL, solver_solveRound(NULL, NULL, &result));
+
+    /* The rounds are small enough to be searched by minimax, and they are
+     * checked at every card, so also from the middle of the hands. */
+    for (int playersNumber = MIN_GAME_PLAYERS;
+         playersNumber <= MAX_GAME_PLAYERS; playersNumber++)
+        for (int roundType = MIN_CARDS; roundType <= 3; roundType++)
+            for (int test = 0; test < 4; test++) {
+                struct Round *round =
+                    fixture_createDealtRound(roundType, playersNumber,
+                                             &random);
+                fixture_placeRandomBids(round, &random);
+                struct Player *player = fixture_getPlayerToMove(round);
+                int cards = fixture_getLegalCards(round, player);
+
+                while (cards != 0) {
+                    checkSolvedRound(solver, round);
+
+                    int cardId;
+                    do {
+                        cardId = random_getBoundedNumber(&random, MAX_CARDS);
+                    } while (((cards >> cardId) & 1) == 0);
+                    round_applyMove(round, player, CARD_MOVE, cardId);
+
+                    player = fixture_getPlayerToMove(round);
+                    cards = fixture_getLegalCards(round, player);
+                }
+
+                fixture_deleteDealtRound(&round);
+            }
+
+    solver_deleteSolver(&solver);
+}
+
+void test_solver_getHands()
+{
+    struct Solver *solver = solver_createSolver();
+    struct Random random;
+    random_setSeed(&random, 2);
+
+    cut_assert_equal_int(POINTER_NULL, solver_loadRound(NULL, NULL));
+    cut_assert_equal_int(ROUND_NULL, solver_loadRound(solver, NULL));
+
+    for (int test = 0; test < 20; test++) {
+        struct Round *round = fixture_createDealtRound(4, MIN_GAME_PLAYERS,
+                                                       &random);
+        fixture_placeRandomBids(round, &random);
+
+        cut_assert_equal_int(FUNCTION_NO_ERROR,
+                             solver_loadRound(solver, round));
+        cut_assert_equal_int(0, solver_getPlayerToMove(solver));
+        for (int i = 0; i < MIN_GAME_PLAYERS; i++) {
+            cut_assert_equal_int(getHandsByMinimax(round, i, 1),
+                                 solver_getHands(solver, i, 1));
+            cut_assert_equal_int(getHandsByMinimax(round, i, 0),
+                                 solver_getHands(solver, i, 0));
+        }
+
+        /* The solver follows the cards put down in the round. */
+        struct Player *player = fixture_getPlayerToMove(round);
+        int cards = fixture_getLegalCards(round, player);
+        int cardId = 0;
+        while (((cards >> cardId) & 1) == 0)
+            cardId++;
+        int card = player->hand[cardId].id;
+        round_applyMove(round, player, CARD_MOVE, cardId);
+        cut_assert_equal_int(FUNCTION_NO_ERROR,
+                             solver_playCard(solver, card));
+        cut_assert_equal_int(1, solver_getPlayerToMove(solver));
+        for (int i = 0; i < MIN_GAME_PLAYERS; i++)
+            cut_assert_equal_int(getHandsByMinimax(round, i, 1),
+                                 solver_getHands(solver, i, 1));
+
+        fixture_deleteDealtRound(&round);
+    }
+
+    solver_deleteSolver(&solver);
+}
@@ -0,0 +1,257 @@
+#include <world.h>
+#include <round.h>
+#include <deck.h>
+#include <bitboard.h>
+#include <random.h>
+#include <errors.h>
+#include <constants.h>
+
+#include <cutter.h>
+
+#include "fixture.h"
+
+/**
+ * @brief Function gets the cards of all the players from a round as
+ *        bitboards.
+ */
+static void getHands(const struct Round *round, uint64_t *hands)
+{
+    for (int i = 0; i < MAX_GAME_PLAYERS; i++)
+        hands[i] = 0;
+    for (int i = 0; i < round->playersNumber; i++)
+        hands[i] = bitboard_getPlayerCards(round->players[i]);
+}
+
+/**
+ * @brief Function checks a world read by a player from a round: the cards
+ *        which he doesn't see, the suits which the other players showed
+ *        that they don't have and the order in which they get cards.
+ */
+static void checkWorld(const struct World *world, const struct Round *round,
+                       int playerId, uint64_t played, const uint64_t *voids)
+{
+    struct Deck deck;
+    deck_initializeDeck(&deck, round->playersNumber);
+    uint64_t hands[MAX_GAME_PLAYERS];
+    getHands(round, hands);
+
+    cut_assert_equal_int(round->playersNumber, world->playersNumber);
+    cut_assert_equal_int(playerId, world->playerId);
+
+    uint64_t unknown = bitboard_getDeckCards(&deck) & ~played &
+                       ~hands[playerId] & ~bitboard_getCardMask(round->trump);
+    cut_assert_equal_int(1, unknown == world->unknown);
+
+    int ordered = 0;
+    int previous = 0;
+    for (int i = 0; i < round->playersNumber; i++) {
+        cut_assert_equal_int(player_getCardsNumber(round->players[i]),
+                             world->cardsNumber[i]);
+        cut_assert_equal_int(1, voids[i] == world->voids[i]);
+        /* The voids are read from the cards really put down. */
+        cut_assert_equal_int(0, hands[i] & world->voids[i]);
+        if (i != playerId)
+            cut_assert_equal_int(0, hands[i] & ~world->unknown);
+
+        if (i == round->playersNumber - 1)
+            continue;
+        int id = world->order[i];
+        cut_assert_not_equal_int(playerId, id);
+        cut_assert_equal_int(0, (ordered >> id) & 1);
+        ordered |= 1 << id;
+        int count = bitboard_countCards(world->unknown & ~world->voids[id]);
+        cut_assert_operator_int(previous, <=, count);
+        previous = count;
+    }
+}
+
+/**
+ * @brief Function checks the cards dealt from a world: the player keeps his
+ *        cards and the other players get from the unknown cards as many
+ *        cards as they have, of the suits which they can have if withVoids.
+ */
+static void checkDealtCards(const struct World *world, const uint64_t *known,
+                            const uint64_t *hands, int withVoids)
+{
+    uint64_t dealt = 0;
+    for (int i = 0; i < world->playersNumber; i++) {
+        if (i == world->playerId) {
+            cut_assert_equal_int(1, known[i] == hands[i]);
+            continue;
+        }
+        cut_assert_equal_int(world->cardsNumber[i],
+                             bitboard_countCards(hands[i]));
+        cut_assert_equal_int(0, hands[i] & ~world->unknown);
+        cut_assert_equal_int(0, hands[i] & dealt);
+        if (withVoids)
+            cut_assert_equal_int(0, hands[i] & world->voids[i]);
+        dealt |= hands[i];
+    }
+}
+
+/**
+ * @brief Function plays a card at random and adds to voids the suits which
+ *        the player showed that he doesn't have, as it is seen from the
+ *        current hand of the round.
+ *
+ * @return The number of the cards played, 0 if the round is over.
+ */
+static int playRandomCard(struct Round *round, struct Random *random,
+                          uint64_t *played, uint64_t *voids)
+{
+    struct Player *player = fixture_getPlayerToMove(round);
+    int playerId = round_getPlayerId(round, player);
+    enum Suit trump = deck_getCardSuit(round->trump);
+    enum Suit leadSuit = SuitEnd;
+    if (round->hand != NULL && round->hand->cardsNumber > 0)
+        leadSuit = deck_getCardSuit(round->hand->cards[0]);
+
+    if (!fixture_applyRandomMove(round, random))
+        return 0;
+
+    struct Card card = round->moves[round->movesNumber - 1].card;
+    enum Suit suit = deck_getCardSuit(card);
+    *played |= bitboard_getCardMask(card);
+    if (leadSuit != SuitEnd && suit != leadSuit) {
+        voids[playerId] |= bitboard_getSuitMask(leadSuit);
+        if (suit != trump)
+            voids[playerId] |= bitboard_getSuitMask(trump);
+    }
+
+    return 1;
+}
+
+void test_world_readRound()
+{
+    struct World world;
+    struct Random random;
+    random_setSeed(&random, 1);
+
+    struct Round *round = fixture_createDealtRound(5, 4, &random);
+    cut_assert_equal_int(POINTER_NULL, world_readRound(NULL, round, 0));
+    cut_assert_equal_int(ROUND_NULL, world_readRound(&world, NULL, 0));
+    cut_assert_equal_int(ILLEGAL_VALUE, world_readRound(&world, round, -1));
+    cut_assert_equal_int(ILLEGAL_VALUE, world_readRound(&world, round, 4));
+    fixture_deleteDealtRound(&round);
+
+    /* The voids are found from the hands of the round, the world must find
+     * them from Round::moves. */
+    int voidsNumber = 0;
+    for (int playersNumber = MIN_GAME_PLAYERS;
+         playersNumber <= MAX_GAME_PLAYERS; playersNumber++)
+        for (int test = 0; test < 10; test++) {
+            round = fixture_createDealtRound(5 + test % 4, playersNumber,
+                                             &random);
+            fixture_placeRandomBids(round, &random);
+
+            uint64_t voids[MAX_GAME_PLAYERS] = {0};
+            uint64_t played = 0;
+            do {
+                for (int i = 0; i < playersNumber; i++) {
+                    cut_assert_equal_int(FUNCTION_NO_ERROR,
+                                         world_readRound(&world, round, i));
+                    checkWorld(&world, round, i, played, voids);
+                }
+            } while (playRandomCard(round, &random, &played, voids));
+
+            for (int i = 0; i < playersNumber; i++)
+                if (voids[i] != 0)
+                    voidsNumber++;
+            fixture_deleteDealtRound(&round);
+        }
+
+    cut_assert_operator_int(voidsNumber, >, 0);
+}
+
+void test_world_dealCards()
+{
+    struct World world;
+    struct Random random, dealRandom, sameRandom;
+    random_setSeed(&random, 2);
+
+    uint64_t hands[MAX_GAME_PLAYERS];
+    uint64_t known[MAX_GAME_PLAYERS];
+    uint64_t same[MAX_GAME_PLAYERS];
+
+    struct Round *round = fixture_createDealtRound(5, 4, &random);
+    world_readRound(&world, round, 0);
+    cut_assert_equal_int(POINTER_NULL, world_dealCards(NULL, &random, hands));
+    cut_assert_equal_int(POINTER_NULL, world_dealCards(&world, NULL, hands));
+    cut_assert_equal_int(POINTER_NULL, world_dealCards(&world, &random,
+                                                       NULL));
+    fixture_deleteDealtRound(&round);
+
+    for (int playersNumber = MIN_GAME_PLAYERS;
+         playersNumber <= MAX_GAME_PLAYERS; playersNumber++)
+        for (int test = 0; test < 4; test++) {
+            round = fixture_createDealtRound(MAX_CARDS - test, playersNumber,
+                                             &random);
+            fixture_placeRandomBids(round, &random);
+
+            uint64_t voids[MAX_GAME_PLAYERS] = {0};
+            uint64_t played = 0;
+            do {
+                int playerId = round_getPlayerId(round,
+                                   fixture_getPlayerToMove(round));
+                cut_assert_equal_int(FUNCTION_NO_ERROR,
+                                     world_readRound(&world, round,
+                                                     playerId));
+                getHands(round, known);
+
+                /* The real cards of the round keep the voids, so a deal
+                 * which keeps them is found. */
+                for (int deal = 0; deal < 10; deal++) {
+                    random_setSeed(&dealRandom, deal);
+                    random_setSeed(&sameRandom, deal);
+                    for (int i = 0; i < MAX_GAME_PLAYERS; i++)
+                        hands[i] = same[i] = known[i];
+
+                    cut_assert_equal_int(FUNCTION_NO_ERROR,
+                                         world_dealCards(&world, &dealRandom,
+                                                         hands));
+                    checkDealtCards(&world, known, hands, 1);
+
+                    /* The same seed deals the same cards. */
+                    world_dealCards(&world, &sameRandom, same);
+                    for (int i = 0; i < playersNumber; i++)
+                        cut_assert_equal_int(1, hands[i] == same[i]);
+                }
+            } while (playRandomCard(round, &random, &played, voids));
+
+            fixture_deleteDealtRound(&round);
+        }
+}
+
+void test_world_dealCardsWithoutVoids()
+{
+    struct World world;
+    struct Random random;
+    random_setSeed(&random, 3);
+
+    struct Round *round = fixture_createDealtRound(MAX_CARDS, 4, &random);
+    fixture_placeRandomBids(round, &random);
+    cut_assert_equal_int(FUNCTION_NO_ERROR, world_readRound(&world, round, 0));
+
+    uint64_t known[MAX_GAME_PLAYERS];
+    uint64_t hands[MAX_GAME_PLAYERS];
+    getHands(round, known);
+
+    /* A player which can't have any suit can't get cards while the voids are
+     * kept, so after WORLD_DEAL_ATTEMPTS attempts they are ignored. */
+    for (int i = 0; i < SuitEnd; i++)
+        world.voids[1] |= bitboard_getSuitMask(i);
+    for (int deal = 0; deal < 10; deal++) {
+        for (int i = 0; i < MAX_GAME_PLAYERS; i++)
+            hands[i] = known[i];
+        cut_assert_equal_int(FUNCTION_NO_ERROR,
+                             world_dealCards(&world, &random, hands));
+        checkDealtCards(&world, known, hands, 0);
+        cut_assert_equal_int(0, hands[2] & world.voids[2]);
+    }
+
+    /* Without enough unknown cards no deal is possible. */
+    world.cardsNumber[1]++;
+    cut_assert_equal_int(NOT_FOUND, world_dealCards(&world, &random, hands));
+
+    fixture_deleteDealtRound(&round);
+}